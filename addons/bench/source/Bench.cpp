@@ -0,0 +1,745 @@
+#include "./Bench.hpp"
+
+namespace ml
+{
+	struct ML_PLUGIN_API bench final : addon
+	{
+	public:
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// a named measurement, results go to the log
+		struct benchmark final
+		{
+			cstring								name; // 
+			method<void(std::string_view)>		proc; // 
+		};
+
+		bool				m_show_benchmarks	{ false }; // benchmarks window
+		char				m_args[64]			{}; // passed to the next run
+		list<benchmark>		m_benchmarks		{}; // 
+		ImGuiExt::TextLog	m_textlog			{}; // filled by textlog
+		float32				m_textlog_ms		{}; // text log draw time
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		bench(addon_manager * manager, void * userptr) : addon{ manager, userptr }
+		{
+			subscribe<
+				runtime_gui_event
+			>();
+
+			m_benchmarks.push_back({ "targets", [&](std::string_view line) {
+				gfx::render_device * const device{ ML_get_global(gfx::render_device) };
+				if (line == "sweep") {
+					// resize a target one pixel at a time, like dragging a panel edge
+					gfx::target_pool_stats const before{ device->get_target_pool_stats() };
+					for (int32 i = 0; i < 512; ++i) {
+						(void)device->get_transient_framebuffer({ { 640 + i, 360 + i / 2 } });
+						device->update_transients();
+					}
+					gfx::target_pool_stats const & after{ device->get_target_pool_stats() };
+					debug::puts("sweep: {0} allocations, {1} reuses over 512 sizes",
+						after.allocations - before.allocations,
+						after.reuses - before.reuses);
+				}
+				auto const & stats{ device->get_target_pool_stats() };
+				debug::puts("targets: {0} pooled, {1} allocations, {2} reuses, {3} releases",
+					stats.pooled, stats.allocations, stats.reuses, stats.releases);
+			} });
+			m_benchmarks.push_back({ "transforms", [&](std::string_view line) {
+				// 100k node hierarchy, 1% of nodes moving each frame
+				size_t constexpr node_count{ 100'000 }, frame_count{ 100 }, moved_count{ node_count / 100 };
+				uint32 seed{ 1 };
+				auto const next{ [&seed]() noexcept { return (seed = seed * 1664525u + 1013904223u) >> 8; } };
+				transform_system xs{};
+				list<transform_system::id_type> ids{};
+				ids.reserve(node_count);
+				for (size_t i = 0; i < node_count; ++i) {
+					ids.push_back(xs.create(i ? ids[next() % i] : transform_system::npos, { (float32)(next() % 16), 0.f, 0.f }));
+				}
+				(void)xs.update();
+				size_t written{};
+				timer t{ true };
+				for (size_t f = 0; f < frame_count; ++f) {
+					for (size_t i = 0; i < moved_count; ++i) {
+						xs.set_position(ids[next() % node_count], { (float32)(next() % 16), (float32)f, 0.f });
+					}
+					written += xs.update();
+				}
+				t.stop();
+				debug::puts("transforms: {0} nodes, {1} ms/frame, {2} matrices/frame",
+					node_count,
+					t.elapsed().count() * 1000.f / frame_count,
+					written / frame_count);
+			} });
+			m_benchmarks.push_back({ "culling", [&](std::string_view line) {
+				// 100k boxes scattered around the camera
+				size_t constexpr box_count{ 100'000 };
+				uint32 seed{ 1 };
+				auto const next{ [&seed]() noexcept { return (float32)((seed = seed * 1664525u + 1013904223u) >> 8) / (float32)(1u << 24); } };
+				list<aabb> boxes{};
+				boxes.reserve(box_count);
+				dynamic_bvh bvh{};
+				for (size_t i = 0; i < box_count; ++i) {
+					vec3 const c{ next() * 400.f - 200.f, next() * 400.f - 200.f, next() * 400.f - 200.f };
+					bvh.create_proxy(boxes.emplace_back(aabb::from_sphere(c, .5f + next())), (uint32)i);
+				}
+				// seen from where the sandbox camera starts
+				float_rect const view{ 0, 0, 1280, 720 };
+				camera cam{};
+				cam.set_eye({ -5.f, 3.f, -5.f });
+				cam.recalculate_proj();
+				cam.recalculate_view();
+				frustum const f{ frustum::from_camera(cam.get_view_matrix(), cam.get_proj_matrix()) };
+
+				// brute force
+				size_t brute{};
+				timer t{ true };
+				for (aabb const & b : boxes) { if (f.test(b) != frustum::outside) { ++brute; } }
+				float32 const brute_ms{ t.stop().elapsed().count() * 1000.f };
+
+				// bvh
+				size_t submitted{};
+				t.restart();
+				bvh.query(f, [&](uint32) { ++submitted; });
+				float32 const bvh_ms{ t.stop().elapsed().count() * 1000.f };
+
+				// pick through the middle of the view
+				ray const r{ ray::from_screen(view.center(), view, cam.get_view_matrix(), cam.get_proj_matrix()) };
+				t.restart();
+				uint32 hit{};
+				bool const picked{ bvh.raycast(r, [&](uint32 i) { return r.intersect(boxes[i]); }, &hit) };
+				float32 const pick_ms{ t.stop().elapsed().count() * 1000.f };
+
+				debug::puts("culling: {0} submitted, {1} culled, bvh {2} ms, brute force {3} ms ({4} visible), height {5}",
+					submitted, box_count - submitted, bvh_ms, brute_ms, brute, bvh.get_height());
+				debug::puts("picking: {0} in {1} ms", picked ? std::to_string(hit) : "nothing", pick_ms);
+			} });
+			m_benchmarks.push_back({ "scenes", [&](std::string_view line) {
+				// 10k entities, saved and loaded as binary and as json
+				size_t constexpr entity_count{ 10'000 };
+				scene_tree src{ "benchmark" };
+				for (size_t i = 0; i < entity_count; ++i) {
+					ref<node> const & n{ src.get_root()->new_child(util::format("entity_{0}", i)) };
+					auto & ent{ n->emplace<entity>(&src) };
+					ent.add<tag_component>(n->get_name());
+					ent.add<transform_component>(transform_component{ { (float32)i, 0.f, 0.f }, {}, vec3::one() });
+					ent.add<bounds_component>(bounds_component{ aabb::from_sphere({}, 1.f) });
+				}
+				fs::path const bin_path{ fs::temp_directory_path() / "modus_benchmark.scene" };
+				fs::path const json_path{ fs::temp_directory_path() / "modus_benchmark.json" };
+				timer t{ true };
+
+				// binary
+				t.restart(); bool const bin_saved{ save_scene(bin_path, src) };
+				float32 const bin_save_ms{ t.stop().elapsed().count() * 1000.f };
+				scene_tree bin_dst{ "" };
+				t.restart(); bool const bin_loaded{ load_scene(bin_path, bin_dst) };
+				float32 const bin_load_ms{ t.stop().elapsed().count() * 1000.f };
+
+				// streaming, 64k per frame
+				scene_tree stream_dst{ "" };
+				size_t frames{};
+				for (scene_loader loader{ bin_path }; loader.is_open() && !loader.has_error() && !loader.step(stream_dst, 64 * 1024); ++frames) {}
+
+				// json
+				t.restart();
+				json j{}; to_json(j, src);
+				std::ofstream{ json_path } << j;
+				float32 const json_save_ms{ t.stop().elapsed().count() * 1000.f };
+				scene_tree json_dst{ "" };
+				t.restart();
+				if (std::ifstream f{ json_path }) { from_json(json::parse(f), json_dst); }
+				float32 const json_load_ms{ t.stop().elapsed().count() * 1000.f };
+
+				debug::puts("binary: save {0} ms, load {1} ms, streamed over {2} frames ({3})", bin_save_ms, bin_load_ms, frames + 1, bin_saved && bin_loaded ? "ok" : "failed");
+				debug::puts("json: save {0} ms, load {1} ms", json_save_ms, json_load_ms);
+			} });
+			m_benchmarks.push_back({ "format", [&](std::string_view line) {
+				// 100k typical log lines, old stringstream path vs new engine
+				size_t constexpr line_count{ 100'000 };
+				string const name{ "bench" };
+				size_t total{};
+				timer t{ true };
+
+				t.restart();
+				for (size_t i = 0; i < line_count; ++i) {
+					stringstream ss{};
+					ss << name << '\n' << i << '\n' << 16.6f << '\n';
+					total += util::format("[{0}] frame {1} took {2} ms", ss).size();
+				}
+				float32 const old_ms{ t.stop().elapsed().count() * 1000.f };
+
+				t.restart();
+				for (size_t i = 0; i < line_count; ++i) {
+					total += util::format("[{0}] frame {1} took {2} ms", name, i, 16.6f).size();
+				}
+				float32 const new_ms{ t.stop().elapsed().count() * 1000.f };
+
+				t.restart();
+				char buf[256];
+				for (size_t i = 0; i < line_count; ++i) {
+					total += util::format_to_n(buf, sizeof(buf), ML_format("[{0}] frame {1} took {2} ms"), name, i, 16.6f);
+				}
+				float32 const fixed_ms{ t.stop().elapsed().count() * 1000.f };
+
+				debug::puts("stringstream: {0} ms, format: {1} ms, pattern + buffer: {2} ms ({3})", old_ms, new_ms, fixed_ms, total);
+			} });
+			m_benchmarks.push_back({ "logging", [&](std::string_view line) {
+				// 4 threads flooding a private logger, then the same lines written synchronously
+				size_t constexpr thread_count{ 4 }, message_count{ 100'000 };
+				auto const flood{ [&](auto && fn) {
+					std::atomic<uint64> worst{};
+					timer t{ true };
+					list<std::thread> threads{};
+					for (size_t i = 0; i < thread_count; ++i) {
+						threads.emplace_back([&, i]() {
+							for (size_t j = 0; j < message_count; ++j) {
+								if (j % 64) { fn(i, j); continue; }
+								auto const t0{ std::chrono::high_resolution_clock::now() };
+								fn(i, j);
+								uint64 const ns{ (uint64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - t0).count() };
+								for (uint64 w{ worst }; w < ns && !worst.compare_exchange_weak(w, ns);) {}
+							}
+						});
+					}
+					for (auto & e : threads) { e.join(); }
+					return std::make_pair(t.stop().elapsed().count() * 1000.f, worst.load());
+				} };
+				for (bool const blocking : { false, true }) {
+					std::atomic<size_t> lines{};
+					logger bench{};
+					bench.set_blocking(blocking);
+					bench.add_sink([&](int32, std::string_view) { ++lines; });
+					auto const [ms, worst] { flood([&](size_t i, size_t j) {
+						bench.submit(log_level_info, ML_format("thread {0} message {1} took {2} ms"), i, j, 16.6f);
+					}) };
+					timer t{ true };
+					bench.flush();
+					float32 const drain_ms{ t.stop().elapsed().count() * 1000.f };
+					logger::stats const st{ bench.get_stats() };
+					debug::puts("async ({0}): {1} msgs in {2} ms, {3} ns/call avg, {4} ns worst sampled, drained {5} ms later, {6} dropped",
+						blocking ? "blocking" : "dropping", st.submitted, ms, ms * 1e6f / (thread_count * message_count), worst, drain_ms, st.dropped);
+				}
+				std::mutex sync_mutex{};
+				stringstream sync_stream{};
+				auto const [ms, worst] { flood([&](size_t i, size_t j) {
+					std::lock_guard<std::mutex> lock{ sync_mutex };
+					util::format_to(sync_stream << ML_DEBUG_MSG_SUCCESS, "thread {0} message {1} took {2} ms", i, j, 16.6f) << std::endl;
+					if (sync_stream.tellp() > (1 << 20)) { sync_stream.str({}); }
+				}) };
+				debug::puts("sync: {0} ms, {1} ns/call avg, {2} ns worst sampled", ms, ms * 1e6f / (thread_count * message_count), worst);
+			} });
+			m_benchmarks.push_back({ "textlog", [&](std::string_view line) {
+				// fill the log below, draw time is shown above it
+				size_t const line_count{ line.empty() ? 1'000'000 : (size_t)std::stoull((std::string)line) };
+				string text{};
+				for (size_t i = 0; i < line_count; ++i) {
+					util::format_to(std::back_inserter(text), "{0} line {1} of {2}\n", (i % 3) ? "" : ML_DEBUG_MSG_WARNING, i, line_count);
+				}
+				timer t{ true };
+				m_textlog.Print(text);
+				debug::puts("printed {0} lines in {1} ms, {2} kept", line_count, t.stop().elapsed().count() * 1000.f, m_textlog.GetLineCount());
+			} });
+			m_benchmarks.push_back({ "hashmap", [&](std::string_view line) {
+				// insert, find and erase hashed keys, lookups in scattered order
+				for (size_t const count : { 16, 256, 4096, 32768 }) {
+					list<hash_t> keys{};
+					for (size_t i = 0; i < count; ++i) { string const s{ util::format("key_{0}", i) }; keys.push_back(hashof(s.data(), s.size())); }
+					auto const bench{ [&](auto & m, auto && ins, auto && get, auto && del) {
+						uint64 found{};
+						timer t{ true };
+						t.restart(); for (size_t i = 0; i < count; ++i) { ins(m, keys[i], i); }
+						float32 const ins_ms{ t.stop().elapsed().count() * 1000.f };
+						t.restart(); for (size_t i = 0; i < count; ++i) { found += get(m, keys[(i * 7919) % count]); }
+						float32 const get_ms{ t.stop().elapsed().count() * 1000.f };
+						t.restart(); for (size_t i = 0; i < count; ++i) { del(m, keys[(i * 7919) % count]); }
+						float32 const del_ms{ t.stop().elapsed().count() * 1000.f };
+						return util::format("insert {0} ms, find {1} ms, erase {2} ms ({3})", ins_ms, get_ms, del_ms, found == count ? "ok" : "failed");
+					} };
+					flat_map<hash_t, size_t> fm{};
+					debug::puts("{0} flat_map: {1}", count, bench(fm,
+						[](auto & m, hash_t k, size_t v) { m.insert(k, v); },
+						[](auto & m, hash_t k) { return (bool)m.find(k); },
+						[](auto & m, hash_t k) { if (auto const it{ m.find(k) }) { m.erase(it->first); } }));
+					dense_hash_map<hash_t, size_t> dm{};
+					debug::puts("{0} dense_hash_map: {1}", count, bench(dm,
+						[](auto & m, hash_t k, size_t v) { m.insert(k, v); },
+						[](auto & m, hash_t k) { return (bool)m.find(k); },
+						[](auto & m, hash_t k) { m.erase(k); }));
+					pmr::unordered_map<hash_t, size_t> um{};
+					debug::puts("{0} unordered_map: {1}", count, bench(um,
+						[](auto & m, hash_t k, size_t v) { m.emplace(k, v); },
+						[](auto & m, hash_t k) { return m.find(k) != m.end(); },
+						[](auto & m, hash_t k) { m.erase(k); }));
+				}
+			} });
+			m_benchmarks.push_back({ "hashing", [&](std::string_view line) {
+				// 64MB of keys per size through each hash
+				size_t constexpr total_bytes{ 64 << 20 };
+				string data(4096 + 64, '\0');
+				for (size_t i = 0; i < data.size(); ++i) { data[i] = (char)('a' + (i * 7) % 26); }
+				for (size_t const size : { 4, 16, 64, 256, 1024, 4096 }) {
+					size_t const count{ total_bytes / size };
+					auto const bench{ [&](auto && fn) {
+						hash_t sum{};
+						timer t{ true };
+						for (size_t i = 0; i < count; ++i) { sum += fn(data.data() + (i & 63), size); }
+						float32 const s{ t.stop().elapsed().count() };
+						return util::format("{0} GB/s ({1})", total_bytes / (s * 1e9f), sum & 0xFF);
+					} };
+					debug::puts("{0} bytes, fnv1a: {1}, fast_hash: {2}, std::hash: {3}", size,
+						bench([](cstring p, size_t n) { return hashof(p, n); }),
+						bench([](cstring p, size_t n) { return fast_hash{}(p, n); }),
+						bench([](cstring p, size_t n) { return (hash_t)std::hash<std::string_view>{}({ p, n }); }));
+				}
+			} });
+			m_benchmarks.push_back({ "tokenize", [&](std::string_view line) {
+				// allocations and time for owning vs view tokens
+				size_t constexpr iterations{ 10'000 };
+				passthrough_resource * const res{ ML_get_global(memory_manager)->get_resource() };
+				std::string_view const text{ "#pragma shader vertex" };
+				size_t count{};
+
+				size_t allocs{ res->total_allocations() };
+				timer t{ true };
+				for (size_t i = 0; i < iterations; ++i) { count += util::tokenize(text, "# ").size(); }
+				float32 const owning_ms{ t.stop().elapsed().count() * 1000.f };
+				size_t const owning_allocs{ res->total_allocations() - allocs };
+
+				allocs = res->total_allocations();
+				t.restart();
+				for (size_t i = 0; i < iterations; ++i) { count += util::tokenize_view(text, "# ").size(); }
+				float32 const view_ms{ t.stop().elapsed().count() * 1000.f };
+				size_t const view_allocs{ res->total_allocations() - allocs };
+
+				debug::puts("tokenize: {0} ms, {1} allocations", owning_ms, owning_allocs);
+				debug::puts("tokenize_view: {0} ms, {1} allocations ({2})", view_ms, view_allocs, count);
+			} });
+			m_benchmarks.push_back({ "signatures", [&](std::string_view line) {
+				// filter 1M entity signatures per entity vs batched
+				using signature = ds::bitset<32>;
+				size_t constexpr entity_count{ 1'000'000 };
+				uint32 seed{ 7 };
+				list<signature> sigs{};
+				sigs.reserve(entity_count);
+				for (size_t i = 0; i < entity_count; ++i) { sigs.emplace_back((seed = seed * 1664525u + 1013904223u) >> 8); }
+				signature const mask{ 0b1011 };
+				list<int8> out(entity_count);
+
+				timer t{ true };
+				size_t scalar{};
+				for (size_t i = 0; i < entity_count; ++i) { scalar += (out[i] = sigs[i].contains(mask)); }
+				float32 const scalar_ms{ t.stop().elapsed().count() * 1000.f };
+
+				t.restart();
+				size_t const batched{ ds::match_bitsets(mask, sigs.data(), sigs.size(), reinterpret_cast<bool *>(out.data())) };
+				float32 const batched_ms{ t.stop().elapsed().count() * 1000.f };
+
+				debug::puts("per entity: {0} ms, batched: {1} ms ({2} / {3} matches)", scalar_ms, batched_ms, scalar, batched);
+			} });
+			m_benchmarks.push_back({ "soa", [&](std::string_view line) {
+				// push / erase / iterate, batch_vector columns vs one soa block
+				size_t constexpr row_count{ 1'000'000 }, erase_count{ 1'000 };
+				batch_vector<float32, float32, float32, uint32> bv{};
+				soa_vector<float32, float32, float32, uint32> sv{};
+
+				timer t{ true };
+				for (uint32 i = 0; i < row_count; ++i) { bv.push_back((float32)i, 1.f, 2.f, i); }
+				float32 const bv_push_ms{ t.stop().elapsed().count() * 1000.f };
+				t.restart();
+				for (uint32 i = 0; i < row_count; ++i) { sv.push_back((float32)i, 1.f, 2.f, i); }
+				float32 const sv_push_ms{ t.stop().elapsed().count() * 1000.f };
+
+				t.restart();
+				for (size_t i = 0; i < erase_count; ++i) { bv.erase((i * 7919) % bv.size()); }
+				float32 const bv_erase_ms{ t.stop().elapsed().count() * 1000.f };
+				t.restart();
+				for (size_t i = 0; i < erase_count; ++i) { sv.swap_remove((i * 7919) % sv.size()); }
+				float32 const sv_erase_ms{ t.stop().elapsed().count() * 1000.f };
+
+				float32 bv_sum{}, sv_sum{};
+				t.restart();
+				for (size_t r = 0; r < 10; ++r) {
+					auto const & x{ bv.get<0>() }; auto const & y{ bv.get<1>() }; auto const & z{ bv.get<2>() };
+					for (size_t i = 0, n = x.size(); i < n; ++i) { bv_sum += x[i] * y[i] + z[i]; }
+				}
+				float32 const bv_iter_ms{ t.stop().elapsed().count() * 1000.f };
+				t.restart();
+				for (size_t r = 0; r < 10; ++r) {
+					float32 const * x{ sv.data<0>() }, * y{ sv.data<1>() }, * z{ sv.data<2>() };
+					for (size_t i = 0, n = sv.size(); i < n; ++i) { sv_sum += x[i] * y[i] + z[i]; }
+				}
+				float32 const sv_iter_ms{ t.stop().elapsed().count() * 1000.f };
+
+				debug::puts("push: batch {0} ms, soa {1} ms", bv_push_ms, sv_push_ms);
+				debug::puts("erase x{0}: batch {1} ms, soa swap_remove {2} ms", erase_count, bv_erase_ms, sv_erase_ms);
+				debug::puts("iterate x10: batch {0} ms, soa {1} ms ({2}, {3})", bv_iter_ms, sv_iter_ms, bv_sum, sv_sum);
+			} });
+			m_benchmarks.push_back({ "matrix", [&](std::string_view line) {
+				// mat4 kernels for each instruction set against glm
+				size_t constexpr count{ 100'000 };
+				list<mat4> a(count), b(count), m_out(count);
+				list<vec4> v(count), v_out(count);
+				list<vec3> p(count), p_out(count);
+				for (size_t i = 0; i < count; ++i) {
+					float32 const f{ (float32)(i % 100) * 0.01f };
+					a[i] = util::compose(vec3{ f, 1.f, 2.f }, util::quaternion(vec3{ f, 0.5f, -f }), vec3{ 1.f + f, 1.f, 2.f });
+					b[i] = util::compose(vec3{ -f, 0.f, f }, util::quaternion(vec3{ 0.25f, f, f }), vec3::one());
+					v[i] = { f, 1.f - f, 2.f, 1.f };
+					p[i] = { f, 1.f - f, 2.f };
+				}
+
+				timer t{ true };
+				for (int32 level = simd_level_scalar; level <= util::get_simd_level(); ++level) {
+					mat4_kernels const & k{ util::get_mat4_kernels(level) };
+					t.restart();
+					for (size_t i = 0; i < count; ++i) { k.multiply(a[i], b[i], m_out[i]); }
+					float32 const mul_ms{ t.stop().elapsed().count() * 1000.f };
+					t.restart();
+					for (size_t i = 0; i < count; ++i) { k.inverse(a[i], m_out[i]); }
+					float32 const inv_ms{ t.stop().elapsed().count() * 1000.f };
+					t.restart();
+					k.transform(a[0], v.data(), count, v_out.data());
+					float32 const vec_ms{ t.stop().elapsed().count() * 1000.f };
+					t.restart();
+					k.transform_points(a[0], p.data(), count, p_out.data());
+					float32 const pt_ms{ t.stop().elapsed().count() * 1000.f };
+					debug::puts("{0}: multiply {1} ms, inverse {2} ms, vec4 {3} ms, points {4} ms", k.name, mul_ms, inv_ms, vec_ms, pt_ms);
+				}
+
+				t.restart();
+				for (size_t i = 0; i < count; ++i) { m_out[i] = util::glm_cast((glm::mat4)a[i] * (glm::mat4)b[i]); }
+				float32 const mul_ms{ t.stop().elapsed().count() * 1000.f };
+				t.restart();
+				for (size_t i = 0; i < count; ++i) { m_out[i] = util::glm_cast(glm::inverse((glm::mat4)a[i])); }
+				float32 const inv_ms{ t.stop().elapsed().count() * 1000.f };
+				glm::mat4 const g{ (glm::mat4)a[0] };
+				t.restart();
+				for (size_t i = 0; i < count; ++i) { v_out[i] = util::glm_cast(g * (glm::vec4)v[i]); }
+				float32 const vec_ms{ t.stop().elapsed().count() * 1000.f };
+				debug::puts("glm: multiply {0} ms, inverse {1} ms, vec4 {2} ms", mul_ms, inv_ms, vec_ms);
+			} });
+			m_benchmarks.push_back({ "jobs", [&](std::string_view line) {
+				// fib task tree, layered dependency graph and parallel_for at 1..N threads
+				struct fib final {
+					static int64 serial(int32 n) { return n < 2 ? n : serial(n - 1) + serial(n - 2); }
+					static void run(job_system & js, int32 n, int64 * out) {
+						if (n < 20) { *out = serial(n); return; }
+						int64 a{}, b{};
+						job_counter c{};
+						js.run([&js, n, &a]() { run(js, n - 1, &a); }, &c);
+						run(js, n - 2, &b);
+						js.wait(c);
+						*out = a + b;
+					}
+				};
+				size_t constexpr layer_count{ 8 }, layer_size{ 100 }, element_count{ 10'000'000 };
+				list<float32> data(element_count, 2.f, pmr::new_delete_resource());
+				size_t const max_threads{ ML_max(std::thread::hardware_concurrency(), 1u) };
+				for (size_t n = 1; ; n = ML_min(n * 2, max_threads)) {
+					job_system js{ n, pmr::new_delete_resource() };
+
+					timer t{ true };
+					int64 f{};
+					fib::run(js, 32, &f);
+					float32 const fib_ms{ t.stop().elapsed().count() * 1000.f };
+
+					t.restart();
+					std::atomic<int64> work{};
+					job_counter layers[layer_count]{};
+					for (size_t i = 0; i < layer_count; ++i) {
+						for (size_t j = 0; j < layer_size; ++j) {
+							auto const task{ [&work, i, j]() { work.fetch_add(fib::serial(16 + (int32)((i + j) % 4)), std::memory_order_relaxed); } };
+							if (!i) { js.run(task, &layers[i]); }
+							else { js.run_after(layers[i - 1], task, &layers[i]); }
+						}
+					}
+					js.wait(layers[layer_count - 1]);
+					float32 const graph_ms{ t.stop().elapsed().count() * 1000.f };
+
+					t.restart();
+					js.parallel_for(0, element_count, 64 * 1024, [&data](size_t first, size_t last) {
+						for (size_t i = first; i < last; ++i) { data[i] = std::sqrt(data[i] * data[i] + 1.f); }
+					});
+					float32 const for_ms{ t.stop().elapsed().count() * 1000.f };
+
+					job_system::stats const s{ js.get_stats() };
+					debug::puts("{0} threads: fib(32) {1} ms, graph {2} ms, parallel_for {3} ms (stolen {4}, inlined {5})",
+						n, fib_ms, graph_ms, for_ms, s.stolen, s.inlined);
+					if (n == max_threads) { break; }
+				}
+			} });
+			m_benchmarks.push_back({ "pybuffers", [&](std::string_view line) {
+				// x * 2 + 1 over n vertices, per element through the address api vs buffer views
+				size_t const n{ line.empty() ? 100'000 : (size_t)std::stoull((std::string)line) };
+				py::gil_scoped_acquire gil{};
+				py::dict scope{};
+				scope["n"] = n;
+				py::exec(R"(
+import struct
+from modus import memory
+addr = memory.malloc(n * 12)
+memory.memset(addr, 0, n * 12)
+)", scope);
+				timer t{ true };
+				py::exec(R"(
+for i in range(n * 3):
+    p = addr + i * 4
+    x = struct.unpack('f', struct.pack('I', memory.memget(p, 3)))[0] * 2 + 1
+    for j, b in enumerate(struct.pack('f', x)):
+        memory.memset(p + j, b, 1)
+)", scope);
+				float32 const address_ms{ t.stop().elapsed().count() * 1000.f };
+				t.restart();
+				py::exec(R"(
+mv = memoryview(memory.view(addr, n * 3, 'f'))
+for i in range(n * 3):
+    mv[i] = mv[i] * 2 + 1
+mv.release()
+)", scope);
+				float32 const view_ms{ t.stop().elapsed().count() * 1000.f };
+				t.restart();
+				py::exec(R"(
+try:
+    import numpy
+    a = numpy.asarray(memory.view(addr, n * 3, 'f'))
+    a *= 2
+    a += 1
+    has_numpy = True
+except ImportError:
+    has_numpy = False
+)", scope);
+				float32 const numpy_ms{ t.stop().elapsed().count() * 1000.f };
+
+				// the engine's own columns, copied out per call vs read in place inside a main scope
+				ref<scene_tree> const columns{ make_ref<scene_tree>("pybuffers") };
+				for (size_t i = 0; i < n; ++i) {
+					columns->get_reg().emplace<transform_component>(columns->get_reg().create(), transform_component{ { (float32)i, 0.f, 0.f }, {}, vec3::one() });
+				}
+				scope["columns"] = make_scene_handle(columns);
+				py::exec(R"(
+from modus import gfx, main_scope
+vb = gfx.vertexbuffer(memory.view(addr, n * 3, 'f'))
+def read(get, reps = 20):
+    for _ in range(reps):
+        mv = memoryview(get())
+        x = mv[len(mv) - 1]
+        mv.release()
+)", scope);
+				auto const time_reads{ [&](cstring code) {
+					t.restart();
+					py::exec(code, scope);
+					return t.stop().elapsed().count() * 1000.f;
+				} };
+				float32 const vb_copy_ms{ time_reads("read(vb.view)") };
+				float32 const vb_scope_ms{ time_reads("with main_scope(): read(vb.view)") };
+				float32 const xf_copy_ms{ time_reads("read(columns.transforms)") };
+				float32 const xf_scope_ms{ time_reads("with main_scope(): read(columns.transforms)") };
+				py::exec("del vb, columns\nmemory.free(addr)", scope);
+
+				debug::puts("{0} vertices: address api {1} ms, memoryview {2} ms, numpy {3}", n, address_ms, view_ms,
+					scope["has_numpy"].cast<bool>() ? util::format("{0} ms", numpy_ms) : string{ "unavailable" });
+				debug::puts("20 reads: vertexbuffer copied {0} ms, in place {1} ms, transforms copied {2} ms, in place {3} ms",
+					vb_copy_ms, vb_scope_ms, xf_copy_ms, xf_scope_ms);
+			} });
+			m_benchmarks.push_back({ "pyjson", [&](std::string_view line) {
+				// a settings document with n sections, round tripped through text vs walked directly
+				size_t const n{ line.empty() ? 2'000 : (size_t)std::stoull((std::string)line) };
+				json doc{ json::object() };
+				for (size_t i = 0; i < n; ++i)
+				{
+					json & s{ doc[util::format("section_{0}", i).c_str()] };
+					s["enabled"] = (i % 2) == 0;
+					s["rate"] = 60.0 / (float64)(i + 1);
+					s["count"] = (int64)i;
+					s["name"] = util::format("entry {0}", i).c_str();
+					s["tags"] = { "alpha", "beta", "gamma" };
+					s["size"] = { { "x", (int64)i }, { "y", (int64)i * 2 } };
+				}
+				py::gil_scoped_acquire gil{};
+				py::module const pyjson{ py::module::import("json") };
+
+				timer t{ true };
+				py::object const text_obj{ pyjson.attr("loads")(doc.dump()) };
+				json const text_back{ json::parse(pyjson.attr("dumps")(text_obj).cast<std::string>()) };
+				float32 const text_ms{ t.stop().elapsed().count() * 1000.f };
+
+				t.restart();
+				py::object const direct_obj{ util::to_python(doc) };
+				json const direct_back{ util::from_python(direct_obj) };
+				float32 const direct_ms{ t.stop().elapsed().count() * 1000.f };
+
+				// one leaf through the proxy, only the touched scalar is converted
+				py::object const proxy{ py::cast(&doc, py::return_value_policy::reference) };
+				t.restart();
+				py::object const leaf{ proxy[util::format("section_{0}", n / 2).c_str()]["size"]["y"] };
+				float32 const lazy_ms{ t.stop().elapsed().count() * 1000.f };
+
+				debug::puts("{0} sections: text {1} ms, direct {2} ms, lazy leaf {3} ms, equal {4}",
+					n, text_ms, direct_ms, lazy_ms, (text_back == doc) && (direct_back == doc) && (leaf.cast<int64>() == (int64)(n / 2) * 2));
+			} });
+			m_benchmarks.push_back({ "pyheavy", [&](std::string_view line) {
+				// cpu bound python, stalling one frame inline vs running beside the frames on the script thread
+				size_t const n{ line.empty() ? 5'000'000 : (size_t)std::stoull((std::string)line) };
+				application * const app{ ML_get_global(application) };
+				std::string const code{ util::format("sum(i * i for i in range({0}))", n) };
+
+				timer t{ true };
+				{
+					py::gil_scoped_acquire gil{};
+					py::exec(code);
+				}
+				debug::puts("inline: one frame stalled {0} ms", t.stop().elapsed().count() * 1000.f);
+
+				app->get_frame_times()->clear();
+				app->get_scripts()->post([app, code]()
+				{
+					timer t{ true };
+					py::exec(code);
+					float32 const script_ms{ t.stop().elapsed().count() * 1000.f };
+					app->get_scripts()->post_main([app, script_ms]()
+					{
+						frame_histogram const & h{ *app->get_frame_times() };
+						debug::puts("script thread: {0} ms, frames meanwhile p50 {1} ms, p99 {2} ms over {3} frames", script_ms,
+							h.percentile(0.5f).count() * 1000.f, h.percentile(0.99f).count() * 1000.f, h.total);
+					});
+				});
+			} });
+			m_benchmarks.push_back({ "assets", [&](std::string_view line) {
+				asset_service::stats const s{ ML_get_global(asset_service)->get_stats() };
+				debug::puts("assets: {0} watched, {1} reloads, last {2} ms, worst {3} ms", s.watched, s.reloads,
+					s.last.count() * 1000.f, s.worst.count() * 1000.f);
+			} });
+			m_benchmarks.push_back({ "interning", [&](std::string_view line) {
+				// 100k nodes sharing 1k names, strings vs interned handles
+				size_t constexpr node_count{ 100'000 }, name_count{ 1'000 };
+				struct counting_resource final : pmr::memory_resource {
+					size_t bytes{};
+					void * do_allocate(size_t n, size_t a) override { bytes += n; return pmr::new_delete_resource()->allocate(n, a); }
+					void do_deallocate(void * p, size_t n, size_t a) override { bytes -= n; pmr::new_delete_resource()->deallocate(p, n, a); }
+					bool do_is_equal(pmr::memory_resource const & o) const noexcept override { return this == &o; }
+				} heap{};
+				string_table::stats const before{ ML_get_global(string_table)->get_stats() };
+				list<string> strings{ &heap };
+				list<interned_string> handles{};
+				strings.reserve(node_count); handles.reserve(node_count);
+				for (size_t i = 0; i < node_count; ++i) {
+					strings.emplace_back(util::format("props/environment/rock_large_{0}", i % name_count));
+					handles.emplace_back(strings.back());
+				}
+				string_table::stats const after{ ML_get_global(string_table)->get_stats() };
+				size_t const string_bytes{ heap.bytes }, handle_bytes{ handles.size() * sizeof(interned_string) + after.bytes - before.bytes };
+
+				// find the last name by linear search, as node::find does
+				size_t found{};
+				timer t{ true };
+				string const needle_str{ strings.back() };
+				for (size_t r = 0; r < 10; ++r) { found += std::count(strings.begin(), strings.end(), needle_str); }
+				float32 const string_find_ms{ t.stop().elapsed().count() * 1000.f };
+				interned_string const needle{ needle_str };
+				t.restart();
+				for (size_t r = 0; r < 10; ++r) { found += std::count(handles.begin(), handles.end(), needle); }
+				float32 const handle_find_ms{ t.stop().elapsed().count() * 1000.f };
+
+				// keyed lookups
+				pmr::unordered_map<string, size_t> string_map{};
+				hash_map<interned_string, size_t> handle_map{};
+				for (size_t i = 0; i < name_count; ++i) { string_map[strings[i]] = i; handle_map[handles[i]] = i; }
+				t.restart();
+				for (string const & e : strings) { found += string_map.find(e)->second; }
+				float32 const string_map_ms{ t.stop().elapsed().count() * 1000.f };
+				t.restart();
+				for (interned_string const & e : handles) { found += handle_map.find(e)->second; }
+				float32 const handle_map_ms{ t.stop().elapsed().count() * 1000.f };
+
+				debug::puts("memory: strings {0} bytes, interned {1} bytes ({2} new table bytes)", string_bytes + strings.size() * sizeof(string), handle_bytes, after.bytes - before.bytes);
+				debug::puts("linear find: strings {0} ms, interned {1} ms", string_find_ms, handle_find_ms);
+				debug::puts("map lookup: strings {0} ms, interned {1} ms ({2})", string_map_ms, handle_map_ms, found);
+			} });
+		}
+
+		void on_event(event const & value) final
+		{
+			switch (value)
+			{
+			case runtime_gui_event		::ID: return on_runtime_gui((runtime_gui_event const &)value);
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// bump whenever the layout below changes, older state is dropped
+		static constexpr uint32 state_version{ 1 };
+
+		uint32 on_unload(json & state) final
+		{
+			state["window"] = m_show_benchmarks;
+			state["args"] = m_args;
+			return state_version;
+		}
+
+		void on_reload(json const & state, uint32 version) final
+		{
+			if (version != state_version) { return; }
+
+			state["window"].get_to(m_show_benchmarks);
+			std::strncpy(m_args, state["args"].get<std::string>().c_str(), sizeof(m_args) - 1);
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		void on_runtime_gui(runtime_gui_event const & ev)
+		{
+			// MAIN MENU BAR
+			if (ImGui::BeginMainMenuBar()) {
+				if (ImGui::BeginMenu("view")) {
+					if (ImGui::MenuItem("benchmarks", "", &m_show_benchmarks)) {}
+					ImGui::EndMenu();
+				}
+				ImGui::EndMainMenuBar();
+			}
+
+			// BENCHMARKS
+			if (!m_show_benchmarks) { return; }
+			ImGui::SetNextWindowSize({ 480, 640 }, ImGuiCond_Once);
+			if (ImGui::Begin("benchmarks", &m_show_benchmarks))
+			{
+				ImGui::InputText("args", m_args, sizeof(m_args));
+				for (benchmark const & e : m_benchmarks)
+				{
+					if (ImGui::Button(e.name, { -1.f, 0.f })) { e.proc(m_args); }
+				}
+				ImGui::Separator();
+				ImGui::Text("text log: %.3f ms ( %zu lines )", m_textlog_ms, m_textlog.GetLineCount());
+				ImGui::SameLine();
+				if (ImGui::SmallButton("clear")) { m_textlog.Clear(); }
+				if (ImGui::BeginChild("##textlog"))
+				{
+					timer t{ true };
+					m_textlog.Draw();
+					m_textlog_ms = t.stop().elapsed().count() * 1000.f;
+				}
+				ImGui::EndChild();
+			}
+			ImGui::End();
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+extern "C"
+{
+	ML_PLUGIN_API ml::addon * ml_create_addon(ml::addon_manager * manager, void * userptr)
+	{
+		return manager->allocate<ml::bench>(userptr);
+	}
+
+	ML_PLUGIN_API void ml_destroy_addon(ml::addon_manager * manager, ml::addon * ptr)
+	{
+		manager->deallocate<ml::bench>(ptr);
+	}
+}
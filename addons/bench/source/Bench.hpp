@@ -0,0 +1,28 @@
+#ifndef _ML_BENCH_HPP_
+#define _ML_BENCH_HPP_
+
+#include <modus_core/detail/BatchVector.hpp>
+#include <modus_core/detail/Bitset.hpp>
+#include <modus_core/detail/DenseHashMap.hpp>
+#include <modus_core/detail/FlatMap.hpp>
+#include <modus_core/detail/Hash.hpp>
+#include <modus_core/detail/MatrixMath.hpp>
+#include <modus_core/detail/SoaVector.hpp>
+#include <modus_core/detail/StringUtility.hpp>
+#include <modus_core/detail/Timer.hpp>
+#include <modus_core/embed/Python.hpp>
+#include <modus_core/graphics/AssetService.hpp>
+#include <modus_core/graphics/Camera.hpp>
+#include <modus_core/graphics/RenderAPI.hpp>
+#include <modus_core/gui/TextLog.hpp>
+#include <modus_core/runtime/Application.hpp>
+#include <modus_core/scene/DynamicBVH.hpp>
+#include <modus_core/scene/SceneSerializer.hpp>
+#include <modus_core/scene/TransformSystem.hpp>
+#include <modus_core/system/JobSystem.hpp>
+#include <modus_core/system/Logger.hpp>
+
+// events
+#include <modus_core/events/RuntimeEvents.hpp>
+
+#endif // !_ML_BENCH_HPP_
@@ -0,0 +1,117 @@
+-- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * --
+-- reload test, two builds of one addon and a runner that swaps them
+-- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * --
+
+local reload_test_includedirs = {
+	"%{wks.location}/source",
+	"%{wks.location}/vendor/source",
+	"%{wks.location}/vendor/source/json/include",
+	"%{wks.location}/vendor/source/entt/src",
+}
+
+local reload_test_libdirs = {
+	"%{wks.location}/bin-lib/",
+	"%{wks.location}/bin-lib/%{cfg.platform}/",
+	"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/",
+}
+
+local function reload_test_addon(name, build)
+	group			"addons"
+	project			(name)
+	targetname 		"%{prj.name}"
+	targetdir		"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/addons/"
+	objdir			"%{wks.location}/bin-obj/%{cfg.platform}/%{cfg.buildcfg}/addons/%{prj.name}/"
+	location		"%{wks.location}/project/%{_ACTION}/addons/%{prj.name}/"
+	kind			"SharedLib"
+	language		"C++"
+	cppdialect 		"C++17"
+	staticruntime	"Off"
+	rtti			"On"
+	systemversion	"latest"
+
+	dependson{ "modus_core", }
+
+	defines{
+		"_CRT_SECURE_NO_WARNINGS", "NOMINMAX",
+		"RELOAD_TEST_BUILD=" .. build,
+	}
+
+	undefines{ "NDEBUG", }
+
+	libdirs(reload_test_libdirs)
+	links{ "modus_core", }
+	includedirs(reload_test_includedirs)
+
+	files{
+		"%{wks.location}/addons/reload_test/build/**.**",
+		"%{wks.location}/addons/reload_test/source/**.**",
+	}
+
+	filter{ "configurations:Debug" }
+		symbols "On"
+	filter{ "configurations:Release" }
+		optimize "Speed"
+	filter{}
+end
+
+reload_test_addon("reload_test", 1)
+reload_test_addon("reload_test_v2", 2)
+
+-- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * --
+
+group			"addons"
+project			"reload_test_runner"
+targetname 		"%{prj.name}"
+targetdir		"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/"
+objdir			"%{wks.location}/bin-obj/%{cfg.platform}/%{cfg.buildcfg}/%{prj.name}/"
+location		"%{wks.location}/project/%{_ACTION}/addons/%{prj.name}/"
+debugdir 		"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/"
+kind			"ConsoleApp"
+language		"C++"
+cppdialect 		"C++17"
+staticruntime	"Off"
+rtti			"On"
+systemversion	"latest"
+
+dependson{
+	"reload_test",
+	"reload_test_v2",
+}
+
+defines{
+	"_CRT_SECURE_NO_WARNINGS", "NOMINMAX",
+}
+
+undefines{
+	"NDEBUG",
+}
+
+libdirs(reload_test_libdirs)
+
+links{
+	"modus_core",
+}
+
+includedirs(reload_test_includedirs)
+
+files{
+	"%{wks.location}/addons/reload_test/runner/**.**",
+}
+
+-- runs the swap after every build, a failed check fails the build
+postbuildcommands{
+	"\"%{cfg.buildtarget.abspath}\" \"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/addons\"",
+}
+
+filter{ "configurations:Debug" }
+	symbols "On"
+
+filter{ "configurations:Release" }
+	optimize "Speed"
+
+filter{ "system:Linux" }
+	runpathdirs{
+		"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/",
+	}
+
+-- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * --
@@ -0,0 +1,107 @@
+#include "../source/ReloadTest.hpp"
+
+#ifndef ML_os_windows
+#include <modus_core/backends/posix/Posix_Platform.hpp>
+#endif
+
+using namespace ml;
+using namespace ml::byte_literals;
+
+// MEMORY
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static array<byte, 16_MiB>					g_data{};
+static pmr::monotonic_buffer_resource		g_mono{ g_data.data(), g_data.size() };
+static pmr::unsynchronized_pool_resource	g_pool{ &g_mono };
+static passthrough_resource					g_view{ &g_pool, g_data.data(), g_data.size() };
+static memory_manager						g_mman{ &g_view };
+
+// CHECKS
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static int32 g_failures{};
+
+#define RT_check(expr) \
+	do { if (!(expr)) { ++g_failures; std::cerr << "failed: " << #expr << " (line " << __LINE__ << ")\n"; } } while (0)
+
+// puts one build of the test addon where the manager watches it
+static bool place_build(fs::path const & dir, cstring build, fs::path const & target)
+{
+	std::error_code ec{};
+	fs::path source{ dir / build };
+	source += native_library::default_extension;
+	fs::copy_file(source, target, fs::copy_options::overwrite_existing, ec);
+	if (ec) { std::cerr << "can't copy " << source.string() << ": " << ec.message() << "\n"; }
+	return !ec;
+}
+
+// MAIN
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// usage: reload_test_runner [addon dir], both builds of the test addon are expected there
+int32 main(int32 argc, char * argv[])
+{
+	pmr::set_default_resource(g_mman.get_resource());
+
+	fs::path const dir{ 1 < argc ? fs::path{ argv[1] } : fs::path{ argv[0] }.parent_path() / "addons" };
+	fs::path const work{ fs::temp_directory_path() / "modus_reload_test" };
+	fs::path target{ work / "reload_test" };
+	target += native_library::default_extension;
+
+	std::error_code ec{};
+	fs::remove_all(work, ec);
+	fs::create_directories(work / "shadow", ec);
+	if (!place_build(dir, "reload_test", target)) { return 1; }
+
+#ifndef ML_os_windows
+	// the raw platform layer sees both entry points
+	library_handle const handle{ posix_platform::load_library(target) };
+	RT_check(handle);
+	if (handle)
+	{
+		RT_check(posix_platform::get_proc_address(handle, "ml_create_addon"));
+		RT_check(posix_platform::get_proc_address(handle, "ml_destroy_addon"));
+		RT_check(posix_platform::free_library(handle));
+	}
+#endif
+
+	{
+		event_bus bus{};
+		addon_manager addons{ &bus };
+		addons.set_shadow_path(work / "shadow");
+
+		// first build starts fresh
+		reload_test_report report{};
+		hash_t const id{ addons.watch_addon(target, &report) };
+		RT_check(id);
+		RT_check(report.build == 1);
+		RT_check(!report.reloaded);
+
+		// second build replaces it, state and version come from the first
+		if (id && place_build(dir, "reload_test_v2", target))
+		{
+			RT_check(addons.reload_addon(id));
+			RT_check(report.build == 2);
+			RT_check(report.reloaded);
+			RT_check(report.version == 1);
+			RT_check(report.state.value("build", 0) == 1);
+			RT_check(report.state.value("counter", 0) == 1);
+			RT_check(report.counter == 1);
+
+			// and again over itself, the counter keeps going
+			RT_check(addons.reload_addon(id));
+			RT_check(report.build == 2);
+			RT_check(report.version == 2);
+			RT_check(report.counter == 2);
+		}
+
+		RT_check(addons.uninstall_addon(id));
+		RT_check(!addons.contains(id));
+	}
+
+	fs::remove_all(work, ec);
+	pmr::set_default_resource(nullptr);
+
+	std::cout << (g_failures ? "reload test: failed\n" : "reload test: passed\n");
+	return g_failures ? 1 : 0;
+}
@@ -0,0 +1,52 @@
+#include "./ReloadTest.hpp"
+
+namespace ml
+{
+	// keeps a counter across reloads and reports what each instance was handed
+	struct ML_PLUGIN_API reload_test final : addon
+	{
+		int32 m_counter{};
+
+		reload_test(addon_manager * manager, void * userptr) : addon{ manager, userptr }
+		{
+			get_report() = { RELOAD_TEST_BUILD, false, {}, 0, m_counter };
+		}
+
+		ML_NODISCARD reload_test_report & get_report() const noexcept
+		{
+			return *static_cast<reload_test_report *>(get_user_pointer());
+		}
+
+		void on_event(event const &) final {}
+
+		uint32 on_unload(json & state) final
+		{
+			state["counter"] = m_counter + 1;
+			state["build"] = RELOAD_TEST_BUILD;
+			return RELOAD_TEST_BUILD;
+		}
+
+		void on_reload(json const & state, uint32 version) final
+		{
+			m_counter = state.value("counter", 0);
+			get_report() = { RELOAD_TEST_BUILD, true, state, version, m_counter };
+		}
+	};
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+extern "C"
+{
+	ML_PLUGIN_API ml::addon * ml_create_addon(ml::addon_manager * manager, void * userptr)
+	{
+		return manager->allocate<ml::reload_test>(userptr);
+	}
+
+	ML_PLUGIN_API void ml_destroy_addon(ml::addon_manager * manager, ml::addon * ptr)
+	{
+		manager->deallocate<ml::reload_test>(ptr);
+	}
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
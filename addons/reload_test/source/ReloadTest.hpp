@@ -0,0 +1,24 @@
+#ifndef _ML_RELOAD_TEST_HPP_
+#define _ML_RELOAD_TEST_HPP_
+
+#include <modus_core/embed/AddonManager.hpp>
+
+// the same source builds twice, the runner swaps one build for the other
+#ifndef RELOAD_TEST_BUILD
+#define RELOAD_TEST_BUILD 1
+#endif
+
+namespace ml
+{
+	// filled in by the test addon through its user pointer
+	struct reload_test_report final
+	{
+		uint32	build		; // build of the running instance
+		bool	reloaded	; // the running instance came from on_reload
+		json	state		; // state it was handed
+		uint32	version		; // state version it was handed
+		int32	counter		; // carried across every reload
+	};
+}
+
+#endif // !_ML_RELOAD_TEST_HPP_
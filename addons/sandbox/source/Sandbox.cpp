@@ -36,7 +36,12 @@ namespace ml
 		float32	m_overlay_alpha				{ 0.35f };
 		
 		stream_sniper m_cout{ &std::cout }; // 
+		std::mutex m_log_mutex{}; // guards pending log text
+		string m_log_pending{}, m_log_buffer{}; // log text for the terminal
+		size_t m_log_sink{ static_cast<size_t>(-1) }; // terminal sink
 		ImGuiExt::Terminal m_terminal{}; // 
+		float32 m_terminal_ms{}; // terminal draw time
+		size_t m_alloc_total{}, m_alloc_frame{}; // allocations, total and last frame
 		ImGuiExt::TransformEditor m_xeditor{}; // 
 
 		bool	m_grid_enabled{ true }; // 
@@ -46,9 +51,11 @@ namespace ml
 		// scenes
 		scene_editor m_scene_editor{};
 		hash_map<string, ref<scene_tree>> m_scenes{};
+		weak<scene_tree> m_picked_scene{}; // scene of the picked entity
+		entt::entity m_picked{ entt::null }; // entity under the last click in the viewport
 
 		// resources
-		list<ref<gfx::framebuffer>> m_framebuffers{}; // framebuffers
+		ref<gfx::framebuffer> m_view_target{}; // viewport target (transient)
 		hash_map<string, ref<gfx::texture>> m_textures{}; // textures
 		hash_map<string, ref<gfx::program>> m_programs{}; // programs
 		hash_map<string, ref<gfx::shader>> m_shaders{}; // shaders
@@ -94,7 +101,10 @@ namespace ml
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-		~sandbox() noexcept final {}
+		~sandbox() noexcept final
+		{
+			if (logger * const l{ ML_get_global(logger) }) { l->remove_sink(m_log_sink); }
+		}
 
 		sandbox(addon_manager * manager, void * userptr) : addon{ manager, userptr }
 		{
@@ -102,6 +112,7 @@ namespace ml
 				runtime_startup_event,
 				runtime_shutdown_event,
 				runtime_idle_event,
+				runtime_fixed_update_event,
 				dockspace_builder_event,
 				runtime_gui_event,
 				runtime_end_frame_event,
@@ -121,6 +132,7 @@ namespace ml
 			case runtime_startup_event	::ID: return on_runtime_startup((runtime_startup_event const &)value);
 			case runtime_shutdown_event	::ID: return on_runtime_shutdown((runtime_shutdown_event const &)value);
 			case runtime_idle_event		::ID: return on_runtime_update((runtime_idle_event const &)value);
+			case runtime_fixed_update_event::ID: return on_runtime_fixed_update((runtime_fixed_update_event const &)value);
 			case dockspace_builder_event::ID: return on_dockspace_builder((dockspace_builder_event const &)value);
 			case runtime_gui_event		::ID: return on_runtime_gui((runtime_gui_event const &)value);
 			case runtime_end_frame_event::ID: return on_runtime_frame_end((runtime_end_frame_event const &)value);
@@ -135,6 +147,65 @@ namespace ml
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+		// bump whenever the layout below changes, older state is dropped
+		static constexpr uint32 state_version{ 1 };
+
+		uint32 on_unload(json & state) final
+		{
+			{
+				// the old build's globals shouldn't linger, the next one publishes its own scene
+				py::gil_scoped_acquire gil{};
+				py::globals()["scene"] = py::none();
+			}
+			state["panels"] = {
+				m_show_imgui_demo, m_show_imgui_metrics, m_show_imgui_style_editor, m_show_imgui_about,
+				m_show_viewport, m_show_terminal, m_show_scene_editor
+			};
+			state["overlay"] = { m_show_overlay, m_overlay_corner, m_overlay_offset, m_overlay_alpha };
+			state["grid"] = { m_grid_enabled, m_grid_size };
+			state["camera"] = { m_cc.get_position(), m_cc.get_yaw(), m_cc.get_pitch() };
+			state["objects"] = { m_object_count, m_object_index };
+			json & history{ state["history"] = json::array() };
+			for (string const & e : m_terminal.History) { history.push_back(e.c_str()); }
+			return state_version;
+		}
+
+		void on_reload(json const & state, uint32 version) final
+		{
+			on_runtime_startup(ML_get_global(application));
+			if (version != state_version) { return; }
+
+			json const & panels{ state["panels"] };
+			panels[0].get_to(m_show_imgui_demo);
+			panels[1].get_to(m_show_imgui_metrics);
+			panels[2].get_to(m_show_imgui_style_editor);
+			panels[3].get_to(m_show_imgui_about);
+			panels[4].get_to(m_show_viewport);
+			panels[5].get_to(m_show_terminal);
+			panels[6].get_to(m_show_scene_editor);
+
+			json const & overlay{ state["overlay"] };
+			overlay[0].get_to(m_show_overlay);
+			overlay[1].get_to(m_overlay_corner);
+			overlay[2].get_to(m_overlay_offset);
+			overlay[3].get_to(m_overlay_alpha);
+
+			state["grid"][0].get_to(m_grid_enabled);
+			state["grid"][1].get_to(m_grid_size);
+
+			json const & cam{ state["camera"] };
+			m_cc.set_position(cam[0].get<vec3>());
+			m_cc.set_yaw(cam[1].get<float32>());
+			m_cc.set_pitch(cam[2].get<float32>());
+
+			state["objects"][0].get_to(m_object_count);
+			state["objects"][1].get_to(m_object_index);
+
+			for (json const & e : state["history"]) { m_terminal.History.emplace_back(e.get<std::string>().c_str()); }
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 		void on_runtime_startup(runtime_startup_event const & ev)
 		{
 			// path to
@@ -146,12 +217,17 @@ namespace ml
 				ev->get_main_window()->set_icons(1, i.width(), i.height(), i.data());
 			}
 
-			// framebuffers
-			m_framebuffers.push_back(gfx::framebuffer::create({ 1280, 720 }));
+			// assets saved while running are rebuilt in place
+			asset_service * const assets{ ML_get_global(asset_service) };
 
 			// textures
-			m_textures["earth_dm_2k"] = gfx::texture2d::create(path2("assets/textures/earth/earth_dm_2k.png"), gfx::texture_flags_default);
-			m_textures["earth_sm_2k"] = gfx::texture2d::create(path2("assets/textures/earth/earth_sm_2k.png"), gfx::texture_flags_default);
+			for (cstring name : { "earth_dm_2k", "earth_sm_2k" })
+			{
+				fs::path const file{ path2(util::format("assets/textures/earth/{0}.png", name)) };
+				ref<gfx::texture2d> const tex{ gfx::texture2d::create(file, gfx::texture_flags_default) };
+				assets->watch(tex, file);
+				m_textures[name] = tex;
+			}
 
 			// shaders
 			if (gfx::program_source src{}
@@ -162,12 +238,25 @@ namespace ml
 			}
 			
 			// programs
-			m_programs["2D"] = gfx::parse_program(path2("addons/sandbox/resource/shaders/basic_2D.shader"));
-			m_programs["3D"] = gfx::parse_program(path2("addons/sandbox/resource/shaders/basic_3D.shader"));
+			fs::path const pgm_files[]{
+				path2("addons/sandbox/resource/shaders/basic_2D.shader"),
+				path2("addons/sandbox/resource/shaders/basic_3D.shader")
+			};
+			if (auto const pgms{ gfx::parse_programs<fs::path>({ pgm_files[0], pgm_files[1] }) }
+			; 2 == pgms.size())
+			{
+				m_programs["2D"] = pgms[0];
+				m_programs["3D"] = pgms[1];
+				assets->watch(pgms[0], pgm_files[0]);
+				assets->watch(pgms[1], pgm_files[1]);
+			}
 
 			// meshes
-			m_meshes["sphere8x6"] = make_ref<mesh>(path2("assets/models/sphere8x6.obj"));
-			m_meshes["sphere32x24"] = make_ref<mesh>(path2("assets/models/sphere32x24.obj"));
+			for (cstring name : { "sphere8x6", "sphere32x24" })
+			{
+				fs::path const file{ path2(util::format("assets/models/{0}.obj", name)) };
+				assets->watch(m_meshes[name] = make_ref<mesh>(file), file);
+			}
 
 			// viewport
 			m_viewport.set_rect({ 0, 0, 1280, 720 });
@@ -192,13 +281,28 @@ namespace ml
 				auto & cam = ent.add<camera_component>();
 				auto & scr = ent.add<behavior_component>();
 			}
+			{
+				// scripts run on their own thread and may outlive the scene, they get a handle that empties
+				py::gil_scoped_acquire gil{};
+				py::globals()["scene"] = make_scene_handle(tree);
+			}
 			
+			// log to terminal
+			m_log_sink = ev->get_logger().add_sink([&, app = ev.ptr](int32 level, std::string_view line)
+			{
+				{
+					std::lock_guard<std::mutex> lock{ m_log_mutex };
+					m_log_pending.append(debug::get_prefix(level)).append(line).push_back('\n');
+				}
+				app->wake(); // lines can arrive from any thread while the loop is blocked
+			});
+
 			// terminal
 			m_terminal.UserName = "root";
 			m_terminal.HostName = "localhost";
 			m_terminal.PathName = "~";
 			m_terminal.ModeName = "";
-			m_terminal.Commands.push_back({ "clear", {}, [&](auto line) { m_terminal.Output.Lines.clear(); } });
+			m_terminal.Commands.push_back({ "clear", {}, [&](auto line) { m_terminal.Output.Clear(); } });
 			m_terminal.Commands.push_back({ "exit", {}, [&](auto line) { ML_get_global(application)->quit(); } });
 			m_terminal.Commands.push_back({ "help", {}, [&](auto line) { for (auto const & e : m_terminal.Commands) { debug::puts("/{0}", e.name); } } });
 			m_terminal.Commands.push_back({ "history", {}, [&](auto line) { for (auto const & e : m_terminal.History) { debug::puts(e); } } });
@@ -209,7 +313,7 @@ namespace ml
 				else if (m_terminal.ModeName == line && line == "python") {
 					m_terminal.ModeName.clear(); return; // unlock
 				}
-				py::exec((std::string)line); // execute
+				ML_get_global(application)->get_scripts()->exec(string{ line }); // execute on the script thread
 			} });
 		}
 
@@ -220,9 +324,21 @@ namespace ml
 
 		void on_runtime_update(runtime_idle_event const & ev)
 		{
+			// without a fixed rate scenes step once per frame instead
+			if (ev->get_fixed_delta_time() <= 0.f)
+			{
+				for (auto & [name, tree] : m_scenes) { if (tree) { tree->on_runtime_update(ev->get_delta_time()); } }
+			}
+
 			string const str{ m_cout.str() };
 			m_terminal.Output.Print(str);
 			m_cout.str({});
+			{
+				std::lock_guard<std::mutex> lock{ m_log_mutex };
+				m_log_buffer.swap(m_log_pending);
+			}
+			m_terminal.Output.Print(m_log_buffer);
+			m_log_buffer.clear();
 
 			duration const dt{ ev->get_delta_time() };
 
@@ -230,11 +346,18 @@ namespace ml
 
 			vec2 const view_size{ m_viewport.get_rect().size() };
 
-			for (auto const & fb : m_framebuffers) { fb->resize(view_size); }
+			// viewport target, last frame's is handed back first so the pool can return it again
+			gfx::render_device * const device{ ML_get_global(gfx::render_device) };
+			device->release_transient(m_view_target);
+			m_view_target = device->get_transient_framebuffer({ (vec2i)view_size });
 
-			if (m_shift_bg_hue) { m_camera.set_background(util::rotate_hue(m_camera.get_background(), dt * 10)); }
+			if (m_shift_bg_hue) {
+				m_camera.set_background(util::rotate_hue(m_camera.get_background(), dt * 10));
+				ev->request_redraw();
+			}
 
 			if (m_dragging_view) {
+				ev->request_redraw();
 				vec2 const md{ input->mouse_delta * (dt * 50) };
 				m_cc.yaw(-md[0]);
 				m_cc.pitch(+md[1]);
@@ -252,28 +375,88 @@ namespace ml
 			static auto const & tex{ m_textures["earth_dm_2k"] };
 			static auto const & msh{ m_meshes["sphere32x24"] };
 			static auto const & vs{ m_shaders["vs"] }, & ps{ m_shaders["ps"] };
+			float32 const alpha{ ev->get_interpolation() };
+			frustum const view_frustum{ frustum::from_camera(m_camera.get_view_matrix(), m_camera.get_proj_matrix()) };
 			ev->get_render_context()->execute
 			(
-				gfx::command::bind_framebuffer(m_framebuffers[0]),
+				gfx::command::bind_framebuffer(m_view_target),
+				gfx::command::set_viewport({ {}, (vec2i)view_size }),
 				gfx::command::set_clear_color(m_camera.get_background()),
 				gfx::command::clear(m_camera.get_clear_flags()),
 				[&](gfx::render_context * ctx)
 				{
-					if (0 == m_object_count) { return; }
+					if (!pgm->is_ready()) { return; }
 					pgm->bind();
-					pgm->set_uniform("u_model", m_object_matrix[0]);
 					pgm->set_uniform("u_view", m_camera.get_view_matrix());
 					pgm->set_uniform("u_proj", m_camera.get_proj_matrix());
 					pgm->set_uniform("u_color", (vec4)colors::white);
 					pgm->set_uniform("u_texture", tex);
 					pgm->bind_textures();
-					ctx->draw(msh->get_vertexarray());
+					if (0 < m_object_count)
+					{
+						pgm->set_uniform("u_model", m_object_matrix[0]);
+						ctx->draw(msh->get_vertexarray());
+					}
+
+					// only what the bvh finds in view is submitted, drawn between fixed steps
+					// so motion stays smooth above the step rate
+					for (auto & [name, tree] : m_scenes)
+					{
+						if (!tree) { continue; }
+						scene_tree & scene{ *tree };
+						scene.cull(view_frustum, [&](entt::entity e)
+						{
+							pgm->set_uniform("u_model", scene.get_world_matrix(e, alpha));
+							ctx->draw(msh->get_vertexarray());
+						});
+					}
 					pgm->unbind();
 				},
 				gfx::command::bind_framebuffer(0)
 			);
 		}
 		
+		// nearest entity under a point in the viewport, through each scene's bvh
+		void pick_entity(vec2 const & pos)
+		{
+			ray const r{ ray::from_screen(pos, m_viewport.get_rect(), m_camera.get_view_matrix(), m_camera.get_proj_matrix()) };
+			m_picked_scene.reset();
+			m_picked = entt::null;
+			float32 nearest{ FLT_MAX };
+			for (auto & [name, tree] : m_scenes)
+			{
+				float32 distance{};
+				if (entt::entity const e{ tree ? tree->pick(r, &distance) : entt::null }; e != entt::null && distance < nearest)
+				{
+					nearest = distance;
+					m_picked_scene = tree;
+					m_picked = e;
+				}
+			}
+		}
+
+		// gizmo on the picked entity, edits its transform in the space of its parent
+		void edit_picked(scene_tree & scene, mat4 const & view_matrix, mat4 const & proj_matrix)
+		{
+			transform_component & xf{ scene.get_reg().get<transform_component>(m_picked) };
+			mat4 const local{ xf.get_transform() };
+			mat4 const parent{ util::multiply(scene.get_world_matrix(m_picked), util::inverse(local)) };
+			mat4 world{ util::multiply(parent, local) };
+			if (!m_xeditor.Manipulate(view_matrix, proj_matrix, world)) { return; }
+
+			vec3 t, r, s;
+			ImGuizmo::DecomposeMatrixToComponents(util::multiply(util::inverse(parent), world), t, r, s);
+			xf.position = t;
+			xf.rotation = { util::deg2rad(r[0]), util::deg2rad(r[1]), util::deg2rad(r[2]), 0.f };
+			xf.scale = s;
+		}
+
+		void on_runtime_fixed_update(runtime_fixed_update_event const & ev)
+		{
+			duration const dt{ ev->get_fixed_delta_time() };
+			for (auto & [name, tree] : m_scenes) { if (tree) { tree->on_runtime_update(dt); } }
+		}
+
 		void on_dockspace_builder(dockspace_builder_event const & ev)
 		{
 			ImGuiID right{ ev->ID };
@@ -303,6 +486,10 @@ namespace ml
 			float32 const &			mouse_wheel		{ input->mouse_wheel };
 			mat4 const &			view_matrix		{ m_camera.get_view_matrix() };
 			mat4 const &			proj_matrix		{ m_camera.get_proj_matrix() };
+
+			// allocations since last frame
+			size_t const alloc_total{ ML_get_global(memory_manager)->get_resource()->total_allocations() };
+			m_alloc_frame = alloc_total - std::exchange(m_alloc_total, alloc_total);
 			
 			// GIZMOS
 			ImGuizmo::SetOrthographic(m_camera.is_orthographic());
@@ -408,14 +595,19 @@ namespace ml
 					ImRect const bb{ imgui->CurrentWindow->InnerRect };
 					m_viewport.set_rect((vec4)bb.ToVec4());
 					ImGui::ItemSize(bb);
-					if (ImGui::ItemAdd(bb, NULL)) {
+					if (ImGui::ItemAdd(bb, NULL) && m_view_target) {
+						// target is rounded up, only show the part that was drawn to
+						vec2 const uv{ work_size / (vec2)m_view_target->get_size() };
 						imgui->CurrentWindow->DrawList->AddImage(
-							m_framebuffers[0]->get_color_attachments()[0]->get_handle(),
-							bb.Min, bb.Max, { 0, 1 }, { 1, 0 }, 0xffffffff);
+							m_view_target->get_color_attachments()[0]->get_handle(),
+							bb.Min, bb.Max, { 0, uv[1] }, { uv[0], 0 }, 0xffffffff);
 						m_dragging_view =
 							!ImGuizmo::IsUsing() &&
 							ImGui::IsItemHovered() &&
 							ImGui::IsMouseDragging(0);
+						if (ImGui::IsItemClicked(0) && !ImGuizmo::IsOver() && !ImGuizmo::IsUsing()) {
+							pick_entity(ImGui::GetMousePos());
+						}
 					}
 
 					// gizmos
@@ -433,6 +625,11 @@ namespace ml
 							m_object_index = i;
 						}
 					}
+					if (ref<scene_tree> const scene{ m_picked_scene.lock() }; scene && scene->get_reg().valid(m_picked) &&
+						scene->get_reg().has<transform_component>(m_picked)) {
+						ImGuizmo::SetID(m_object_count);
+						edit_picked(*scene, view_matrix, proj_matrix);
+					}
 				}
 				ImGui::End();
 			}
@@ -442,7 +639,9 @@ namespace ml
 			{
 				ImGui::SetNextWindowSize(winsize / 2, ImGuiCond_Once);
 				ImGui::SetNextWindowPos(winsize / 2, ImGuiCond_Once, { 0.5f, 0.5f });
+				timer t{ true };
 				m_terminal.Draw("terminal", &m_show_terminal, ImGuiWindowFlags_MenuBar);
+				m_terminal_ms = t.stop().elapsed().count() * 1000.f;
 			}
 
 			// OVERLAY
@@ -484,6 +683,19 @@ namespace ml
 					ImGui::TextDisabled("debug");
 					ImGui::Text("%.3f ms/frame ( %.1f fps )", 1000.f / fps, fps);
 					ImGui::Text("time: %.2f", time);
+					ImGui::Text("allocations: %zu / frame", m_alloc_frame);
+					if (float32 const step{ app->get_fixed_delta_time() }; 0.f < step) { ImGui::Text("fixed: %.0f hz ( alpha %.2f )", 1.f / step, app->get_interpolation()); }
+					if (frame_histogram const & h{ *app->get_frame_times() }; 0 < h.total) {
+						ImGui::Text("update %.3f ms, render %.3f ms",
+							app->get_update_time().count() * 1000.f, app->get_render_time().count() * 1000.f);
+						ImGui::Text("p50 %.0f ms, p99 %.0f ms", h.percentile(0.5f).count() * 1000.f, h.percentile(0.99f).count() * 1000.f);
+						ImGui::PlotHistogram("##frame times", h.buckets, (int32)frame_histogram::bucket_count, 0, nullptr, 0.f, FLT_MAX, { 0.f, 40.f });
+					}
+					if (frame_report const & r{ app->get_frame_report() }; 0 < r.rendered + r.skipped) {
+						ImGui::Text("cpu: %.1f%% ( %.0f frames / min, %llu skipped, %llu waits )",
+							r.cpu_usage * 100.f, r.rendered_per_minute, r.skipped, r.waits);
+					}
+					if (m_show_terminal) { ImGui::Text("terminal: %.3f ms ( %zu lines )", m_terminal_ms, m_terminal.Output.GetLineCount()); }
 					ImGui::Text("view rect: (%.1f,%.1f,%.1f,%.1f)", view_rect[0], view_rect[1], view_rect[2], view_rect[3]);
 					if (ImGui::IsItemHovered()) {
 						ImGui::GetForegroundDrawList()->AddRect(view_rect.min(), view_rect.max(), IM_COL32(255, 155, 0, 255));
@@ -8,7 +8,7 @@
 #include <modus_core/graphics/Mesh.hpp>
 #include <modus_core/gui/Terminal.hpp>
 #include <modus_core/runtime/Application.hpp>
-#include <modus_core/scene/Components.hpp>
+#include <modus_core/scene/SceneSerializer.hpp>
 
 // editors
 #include <modus_core/editor/CameraEditor.hpp>
@@ -117,6 +117,9 @@ filter{ "system:Windows" }
 	buildoptions{
 		"/bigobj"
 	}
+	removefiles{
+		"%{wks.location}/source/%{prj.name}/backends/posix/**.**",
+	}
 
 filter{ "system:Windows", "configurations:Debug" }
 	linkoptions{
@@ -128,4 +131,14 @@ filter{ "system:Windows", "configurations:Release" }
 		"/NODEFAULTLIB:LIBCMT.lib"
 	}
 
+-- LINUX
+
+filter{ "system:Linux" }
+	links{
+		"dl",
+	}
+	removefiles{
+		"%{wks.location}/source/%{prj.name}/backends/win32/**.**",
+	}
+
 -- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * --
\ No newline at end of file
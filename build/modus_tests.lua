@@ -0,0 +1,69 @@
+-- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * --
+-- unit tests for the core containers, hashing, matrix kernels, jobs and scene loading
+-- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * --
+
+group			""
+project			"modus_tests"
+targetname 		"%{prj.name}"
+targetdir		"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/"
+objdir			"%{wks.location}/bin-obj/%{cfg.platform}/%{cfg.buildcfg}/%{prj.name}/"
+location		"%{wks.location}/project/%{_ACTION}/modus/%{prj.name}/"
+debugdir 		"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/"
+kind			"ConsoleApp"
+language		"C++"
+cppdialect 		"C++17"
+staticruntime	"Off"
+rtti			"On"
+systemversion	"latest"
+
+dependson{
+	"modus_core",
+}
+
+defines{
+	"_CRT_SECURE_NO_WARNINGS", "NOMINMAX",
+}
+
+undefines{
+	"NDEBUG",
+}
+
+libdirs{
+	"%{wks.location}/bin-lib/",
+	"%{wks.location}/bin-lib/%{cfg.platform}/",
+	"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/",
+}
+
+links{
+	"modus_core",
+}
+
+includedirs{
+	"%{wks.location}/source",
+	"%{wks.location}/vendor/source",
+	"%{wks.location}/vendor/source/json/include",
+	"%{wks.location}/vendor/source/entt/src",
+}
+
+files{
+	"%{wks.location}/build/%{prj.name}.**",
+	"%{wks.location}/source/%{prj.name}/**.**",
+}
+
+-- runs after every build, a failed check fails the build
+postbuildcommands{
+	"\"%{cfg.buildtarget.abspath}\"",
+}
+
+filter{ "configurations:Debug" }
+	symbols "On"
+
+filter{ "configurations:Release" }
+	optimize "Speed"
+
+filter{ "system:Linux" }
+	runpathdirs{
+		"%{wks.location}/bin-lib/%{cfg.platform}/%{cfg.buildcfg}/",
+	}
+
+-- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * --
@@ -39,6 +39,9 @@ dofile "./vendor/build/glfw.lua"
 dofile "./vendor/build/imgui.lua"
 dofile "./build/modus_core.lua"
 dofile "./build/modus_launcher.lua"
+dofile "./build/modus_tests.lua"
 dofile "./addons/sandbox/build/sandbox.lua"
+dofile "./addons/bench/build/bench.lua"
+dofile "./addons/reload_test/build/reload_test.lua"
 		
 -- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * --
\ No newline at end of file
@@ -158,6 +158,13 @@
 #   error "unable to detect platform architecture"
 #endif
 
+#if defined(__SSE2__) || defined(ML_x64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+//                              SSE2
+#   define ML_has_sse2          1
+#else
+#   define ML_has_sse2          0
+#endif
+
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 // COMPILER
@@ -318,6 +325,22 @@
 #   define ML_NOINLINE
 #endif
 
+// constant evaluation
+#if (defined(ML_cc_msvc) && (ML_cc_msvc >= 1925)) || (defined(ML_cc_gcc) && (ML_cc_gcc >= 9)) || (defined(ML_cc_clang) && (__clang_major__ >= 9))
+#   define ML_has_constant_evaluated    1
+#   define ML_is_constant_evaluated()   __builtin_is_constant_evaluated()
+#else
+#   define ML_has_constant_evaluated    0
+#   define ML_is_constant_evaluated()   true
+#endif
+
+// functions allowed to use avx without building everything with it
+#if defined(ML_cc_clang) || defined(ML_cc_gcc)
+#   define ML_TARGET_AVX        __attribute__((target("avx")))
+#else
+#   define ML_TARGET_AVX
+#endif
+
 // visibility
 #ifndef ML_STATIC
 #   ifdef ML_cc_msvc
@@ -4,23 +4,30 @@
 #include <modus_core/Preprocessor.hpp>
 
 static_assert(ML_has_cxx14);
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cwchar>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <unordered_map>
 #include <stdarg.h>
+#include <thread>
 #include <vector>
 
 static_assert(ML_has_cxx17);
 #include <any>
+#include <charconv>
 #include <filesystem>
 #include <memory_resource>
 #include <optional>
+#include <shared_mutex>
 #include <string_view>
 #include <variant>
 
@@ -37,6 +37,16 @@ namespace ml
 		glfwPollEvents();
 	}
 
+	void glfw_platform::wait_events(float64 timeout)
+	{
+		glfwWaitEventsTimeout(timeout);
+	}
+
+	void glfw_platform::post_empty_event()
+	{
+		glfwPostEmptyEvent();
+	}
+
 	void glfw_platform::swap_buffers(window_handle handle)
 	{
 		glfwSwapBuffers((GLFWwindow *)handle);
@@ -26,6 +26,10 @@ namespace ml
 
 		static void poll_events();
 
+		static void wait_events(float64 timeout);
+
+		static void post_empty_event();
+
 		static void swap_buffers(window_handle value);
 
 		static void swap_interval(int32 value);
@@ -96,6 +96,18 @@
 #define ML_glValidateProgram(p)						glValidateProgramARB( p )
 #define ML_glGetProgramValidateStatus(p, i)			glGetObjectParameterivARB( p, GL_OBJECT_VALIDATE_STATUS_ARB, i )
 
+// parallel compile functions
+#if defined(GL_KHR_parallel_shader_compile)
+#define ML_glMaxShaderCompilerThreads(count)		glMaxShaderCompilerThreadsKHR( count )
+#define ML_glGetProgramCompletionStatus(p, i)		glGetProgramiv( p, GL_COMPLETION_STATUS_KHR, i )
+#elif defined(GL_ARB_parallel_shader_compile)
+#define ML_glMaxShaderCompilerThreads(count)		glMaxShaderCompilerThreadsARB( count )
+#define ML_glGetProgramCompletionStatus(p, i)		glGetProgramiv( p, GL_COMPLETION_STATUS_ARB, i )
+#else
+#define ML_glMaxShaderCompilerThreads(count)		((void)(count))
+#define ML_glGetProgramCompletionStatus(p, i)		(*(i) = 1)
+#endif
+
 // uniform functions
 #define ML_glGetUniformLocation(obj, name)			glGetUniformLocationARB( obj, name )
 #define ML_glUniform1i(loc, x)						glUniform1iARB( loc, x )
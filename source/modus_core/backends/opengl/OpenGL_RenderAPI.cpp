@@ -13,7 +13,9 @@ namespace ml::gfx
 {
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	opengl_render_device::opengl_render_device(spec_type const & desc, allocator_type alloc) : render_device{}
+	opengl_render_device::opengl_render_device(spec_type const & desc, allocator_type alloc)
+		: render_device	{}
+		, m_desc		{ desc }
 	{
 		static bool const opengl_init{ ML_IMPL_OPENGL_INIT() };
 		ML_verify("failed initializing opengl device" && opengl_init);
@@ -85,6 +87,24 @@ namespace ml::gfx
 		// shading language version
 		ML_glCheck(m_info.shading_language_version = (cstring)glGetString(GL_SHADING_LANGUAGE_VERSION));
 #endif
+
+		// parallel shader compile available
+#if defined(GL_KHR_parallel_shader_compile) \
+|| defined(GL_ARB_parallel_shader_compile)
+		m_info.parallel_shader_compile_available = std::any_of(
+			m_info.extensions.begin(),
+			m_info.extensions.end(),
+			[](string const & e) noexcept
+		{
+			return e == "GL_KHR_parallel_shader_compile" || e == "GL_ARB_parallel_shader_compile";
+		});
+
+		// let the driver pick the number of compiler threads
+		if (m_info.parallel_shader_compile_available)
+		{
+			ML_glCheck(ML_glMaxShaderCompilerThreads(0xFFFFFFFF));
+		}
+#endif
 	}
 
 	opengl_render_device::~opengl_render_device() {}
@@ -171,6 +191,150 @@ namespace ml::gfx
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	list<ref<program>> opengl_render_device::new_programs(list<spec<program>> const & desc, allocator_type alloc) noexcept
+	{
+		// submit every compile and link before asking for any status
+		list<ref<program>> temp{ alloc };
+		temp.reserve(desc.size());
+		for (spec<program> e : desc)
+		{
+			e.deferred = true;
+			temp.push_back(new_program(e, alloc));
+		}
+		return temp;
+	}
+
+	size_t opengl_render_device::poll_programs() noexcept
+	{
+		size_t pending{};
+		for (weak<program> const & e : m_objs.get<weak<program>>())
+		{
+			if (ref<program> const p{ e.lock() }; p && (p->poll() == program_status_pending))
+			{
+				++pending;
+			}
+		}
+		return pending;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// round target size up so small resizes land in the same bucket
+	static vec2i transient_bucket(vec2i const & size, int32 granularity) noexcept
+	{
+		if (granularity <= 1) { return size; }
+		auto const round_up{ [granularity](int32 v) noexcept
+		{
+			return ((std::max(v, 1) + granularity - 1) / granularity) * granularity;
+		} };
+		return { round_up(size[0]), round_up(size[1]) };
+	}
+
+	template <class Desc
+	> static bool transient_match(Desc const & a, Desc const & b) noexcept
+	{
+		return (a.size == b.size)
+			&& (a.format.color == b.format.color)
+			&& (a.format.pixel == b.format.pixel)
+			&& (a.format.type == b.format.type)
+			&& (a.flags == b.flags);
+	}
+
+	// find a free target matching desc, or make a new one
+	template <class T, class Pool, class Fn
+	> static ref<T> transient_acquire(Pool & pool, spec<T> const & desc, size_t frame, target_pool_stats & stats, Fn && fn) noexcept
+	{
+		auto & descs{ pool.template get<0>() };
+		auto & frames{ pool.template get<1>() };
+		auto & released{ pool.template get<2>() };
+		auto & values{ pool.template get<3>() };
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			// nobody else may hold it, and inside its frame only a released target can be aliased
+			if (transient_match(descs[i], desc) && values[i].use_count() == 1 && (frames[i] != frame || released[i]))
+			{
+				frames[i] = frame;
+				released[i] = false;
+				++stats.reuses;
+				return values[i];
+			}
+		}
+		++stats.allocations;
+		pool.push_back(desc, frame, false, fn(desc));
+		return values.back();
+	}
+
+	template <class T, class Pool
+	> static void transient_give_back(Pool & pool, ref<T> & value) noexcept
+	{
+		if (!value) { return; }
+		auto & values{ pool.template get<3>() };
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			if (values[i] == value) { pool.template get<2>()[i] = true; break; }
+		}
+		value.reset();
+	}
+
+	template <class Pool
+	> static size_t transient_release(Pool & pool, size_t frame, size_t lifetime) noexcept
+	{
+		size_t count{};
+		for (size_t i = 0; i < pool.size(); )
+		{
+			if (frame - pool.template get<1>()[i] > lifetime) { pool.erase(i); ++count; }
+			else { ++i; }
+		}
+		return count;
+	}
+
+	ref<framebuffer> opengl_render_device::get_transient_framebuffer(spec<framebuffer> const & desc) noexcept
+	{
+		spec<framebuffer> temp{ desc };
+		temp.size = transient_bucket(desc.size, m_desc.target_granularity);
+		return transient_acquire<framebuffer>(m_transient_framebuffers, temp, m_frame, m_pool_stats, [&](auto const & d)
+		{
+			return new_framebuffer(d, {});
+		});
+	}
+
+	ref<texture2d> opengl_render_device::get_transient_texture2d(spec<texture2d> const & desc) noexcept
+	{
+		spec<texture2d> temp{ desc };
+		temp.size = transient_bucket(desc.size, m_desc.target_granularity);
+		temp.data = nullptr;
+		return transient_acquire<texture2d>(m_transient_textures, temp, m_frame, m_pool_stats, [&](auto const & d)
+		{
+			return new_texture2d(d, {});
+		});
+	}
+
+	void opengl_render_device::release_transient(ref<framebuffer> & value) noexcept
+	{
+		transient_give_back<framebuffer>(m_transient_framebuffers, value);
+	}
+
+	void opengl_render_device::release_transient(ref<texture2d> & value) noexcept
+	{
+		transient_give_back<texture2d>(m_transient_textures, value);
+	}
+
+	size_t opengl_render_device::update_transients() noexcept
+	{
+		++m_frame;
+
+		size_t const count
+		{
+			transient_release(m_transient_framebuffers, m_frame, m_desc.target_lifetime) +
+			transient_release(m_transient_textures, m_frame, m_desc.target_lifetime)
+		};
+		m_pool_stats.releases += count;
+		m_pool_stats.pooled = m_transient_framebuffers.size() + m_transient_textures.size();
+		return count;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -822,7 +986,8 @@ namespace ml::gfx
 	{
 		if (!m_locked) { return (void)debug::fail("texture2d is not locked"); }
 
-		if (m_handle && (m_size == size)) { return; }
+		// same size without new pixels is a no-op, new pixels are always uploaded
+		if (m_handle && (m_size == size) && !data) { return; }
 		else { m_size = size; }
 
 		revalue(); bind();
@@ -1174,13 +1339,13 @@ namespace ml::gfx
 
 	opengl_program::program_uniform_binder::program_uniform_binder(opengl_program & p, cstring name) noexcept
 	{
-		if (!name || !*name || !(self = p.m_handle)) { return; }
+		if (!name || !*name || !p.is_ready() || !(self = p.m_handle)) { return; }
 		
 		ML_glCheck(last = ML_glGetProgram());
 
 		if (self != last) { ML_glCheck(ML_glUseProgram(self)); }
 
-		location = p.m_uniforms.find_or_add_fn(hashof(name, std::strlen(name)), [&
+		location = p.m_uniforms.find_or_add_fn(fast_hash{}(name), [&
 		]() noexcept
 		{
 			int32 temp{};
@@ -1200,9 +1365,26 @@ namespace ml::gfx
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	opengl_program::opengl_program(render_device * parent, spec_type const & desc, allocator_type alloc)
-		: program{ parent }
+		: program		{ parent }
+		, m_deferred	{ desc.deferred }
 	{
 		ML_glCheck(m_handle = ML_glCreateProgram());
+
+		// attach source
+		bool has_source{};
+		for (size_t i = 0; i < desc.source.size(); ++i)
+		{
+			if (desc.source[i].empty()) { continue; }
+			
+			list<cstring> str{};
+			str.reserve(desc.source[i].size());
+			for (string const & e : desc.source[i]) { str.push_back(e.c_str()); }
+
+			has_source |= attach((uint32)i, str.size(), str.data());
+		}
+
+		// link
+		if (has_source) { link(); }
 	}
 
 	opengl_program::~opengl_program()
@@ -1214,6 +1396,7 @@ namespace ml::gfx
 	{
 		if (m_handle) { ML_glCheck(ML_glDeleteProgram(m_handle)); }
 
+		m_status = program_status_none;
 		m_uniforms.clear();
 		m_textures.clear();
 		for (auto & e : m_shaders) { e = NULL; }
@@ -1222,6 +1405,22 @@ namespace ml::gfx
 		return (bool)m_handle;
 	}
 
+	bool opengl_program::swap(program & other) noexcept
+	{
+		auto const o{ dynamic_cast<opengl_program *>(&other) };
+		if (!o || o == this) { return false; }
+
+		// deferred stays with each program, it's how they were created
+		std::swap(m_handle, o->m_handle);
+		std::swap(m_status, o->m_status);
+		std::swap(m_error_log, o->m_error_log);
+		std::swap(m_shaders, o->m_shaders);
+		std::swap(m_source, o->m_source);
+		std::swap(m_textures, o->m_textures);
+		std::swap(m_uniforms, o->m_uniforms);
+		return true;
+	}
+
 	bool opengl_program::attach(uint32 type, size_t count, cstring * str, int32 const * len)
 	{
 		if (!count || !str || !*str) { return false; }
@@ -1234,9 +1433,9 @@ namespace ml::gfx
 		ML_glCheck(ML_glShaderSource(temp, (uint32)count, str, len));
 		ML_glCheck(ML_glCompileShader(temp));
 
-		// check compile errors
-		int32 success{};
-		ML_glCheck(ML_glGetShaderCompileStatus(temp, &success));
+		// check compile errors (deferred until link is polled)
+		int32 success{ m_deferred };
+		if (!success) { ML_glCheck(ML_glGetShaderCompileStatus(temp, &success)); }
 		if (!success)
 		{
 			gl_get_program_info_log(m_handle, m_error_log);
@@ -1274,6 +1473,23 @@ namespace ml::gfx
 	{
 		// link
 		ML_glCheck(ML_glLinkProgram(m_handle));
+		m_status = program_status_pending;
+
+		// check linker errors
+		return m_deferred || (poll() == program_status_ready);
+	}
+
+	int32 opengl_program::poll()
+	{
+		if (m_status != program_status_pending) { return m_status; }
+
+		// check completion without blocking
+		if (m_deferred && get_device()->get_info().parallel_shader_compile_available)
+		{
+			int32 done{};
+			ML_glCheck(ML_glGetProgramCompletionStatus(m_handle, &done));
+			if (!done) { return m_status; }
+		}
 
 		// check linker errors
 		int32 success{};
@@ -1281,13 +1497,15 @@ namespace ml::gfx
 		if (!success)
 		{
 			gl_get_program_info_log(m_handle, m_error_log);
+
+			if (m_deferred) { debug::warn(m_error_log); }
 		}
-		return success;
+		return m_status = (success ? program_status_ready : program_status_error);
 	}
 
 	uniform_id opengl_program::get_uniform_location(cstring name) noexcept
 	{
-		return m_uniforms.find_or_add_fn(hashof(name, std::strlen(name)), [&
+		return m_uniforms.find_or_add_fn(fast_hash{}(name), [&
 		]() noexcept
 		{
 			int32 temp{};
@@ -1312,7 +1530,7 @@ namespace ml::gfx
 
 		if (self != last) { ML_glCheck(ML_glUseProgram(self)); }
 
-		loc = s.m_uniforms.find_or_add_fn(hashof(name, std::strlen(name)), [&
+		loc = s.m_uniforms.find_or_add_fn(fast_hash{}(name), [&
 		]() noexcept
 		{
 			int32 temp{};
@@ -37,6 +37,30 @@ namespace ml::gfx
 		>
 		m_objs{};
 
+		spec_type m_desc{}; // device settings
+
+		size_t m_frame{}; // transient frame index
+
+		target_pool_stats m_pool_stats{}; // transient pool stats
+
+		batch_vector // transient framebuffers
+		<
+			spec<framebuffer>,	// bucketed spec
+			size_t,				// last frame used
+			bool,				// released by its pass
+			ref<framebuffer>	// target
+		>
+		m_transient_framebuffers{};
+
+		batch_vector // transient textures
+		<
+			spec<texture2d>,	// bucketed spec
+			size_t,				// last frame used
+			bool,				// released by its pass
+			ref<texture2d>		// target
+		>
+		m_transient_textures{};
+
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	public:
@@ -82,6 +106,26 @@ namespace ml::gfx
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+		list<ref<program>> new_programs(list<spec<program>> const & desc, allocator_type alloc) noexcept final;
+
+		size_t poll_programs() noexcept final;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ref<framebuffer> get_transient_framebuffer(spec<framebuffer> const & desc) noexcept final;
+
+		ref<texture2d> get_transient_texture2d(spec<texture2d> const & desc) noexcept final;
+
+		void release_transient(ref<framebuffer> & value) noexcept final;
+
+		void release_transient(ref<texture2d> & value) noexcept final;
+
+		size_t update_transients() noexcept final;
+
+		target_pool_stats const & get_target_pool_stats() const noexcept final { return m_pool_stats; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 		list<weak<render_context>> const & all_contexts() const noexcept final { return m_objs.get<weak<render_context>>(); }
 
 		list<weak<vertexarray>> const & all_vertexarrays() const noexcept { return m_objs.get<weak<vertexarray>>(); }
@@ -542,6 +586,8 @@ namespace ml::gfx
 		static constexpr typeof_t<> s_self_type{ typeof_v<opengl_program> };
 
 		uint32									m_handle		{}; // handle
+		bool const								m_deferred		{}; // poll status instead of blocking
+		int32									m_status		{}; // link status
 		string								m_error_log		{}; // error log
 		array<object_id, shader_type_MAX>	m_shaders		{}; // shader cache
 		flat_map<uint32, list<string>>	m_source		{}; // source cache
@@ -569,6 +615,8 @@ namespace ml::gfx
 
 		bool revalue() final;
 
+		bool swap(program & other) noexcept final;
+
 		object_id get_handle() const noexcept final { return ML_handle(object_id, m_handle); }
 
 		typeof_t<> const & get_self_type() const noexcept final { return s_self_type; }
@@ -580,6 +628,8 @@ namespace ml::gfx
 
 		bool link() final;
 
+		int32 poll() final;
+
 		bool bind_uniform(cstring name, method<void(uniform_id)> const & fn) final
 		{
 			program_uniform_binder u{ *this, name };
@@ -589,6 +639,8 @@ namespace ml::gfx
 
 		uniform_id get_uniform_location(cstring name) noexcept final;
 
+		int32 get_status() const noexcept final { return m_status; }
+
 		string const & get_info_log() const noexcept final { return m_error_log; }
 
 		array<object_id, shader_type_MAX> const & get_shaders() const noexcept final { return m_shaders; }
@@ -0,0 +1,29 @@
+#include "./Posix_Platform.hpp"
+#include <modus_core/system/Logger.hpp>
+
+#include <dlfcn.h>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	library_handle posix_platform::load_library(fs::path const & path)
+	{
+		// local symbols, two copies of the same addon must not bind to each other
+		void * const handle{ dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL) };
+		if (!handle) { ML_log_error("dlopen: {0}", dlerror()); }
+		return (library_handle)handle;
+	}
+
+	bool posix_platform::free_library(library_handle handle)
+	{
+		return 0 == dlclose(handle);
+	}
+
+	void * posix_platform::get_proc_address(library_handle handle, string const & method_name)
+	{
+		return dlsym(handle, method_name.c_str());
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
\ No newline at end of file
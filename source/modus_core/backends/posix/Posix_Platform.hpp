@@ -0,0 +1,28 @@
+#ifndef _ML_POSIX_PLATFORM_HPP_
+#define _ML_POSIX_PLATFORM_HPP_
+
+#include <modus_core/embed/Library.hpp>
+
+#ifdef ML_os_windows
+#error "posix platform api is not available on windows"
+#endif
+
+namespace ml
+{
+	// posix platform api, windows and events go through glfw
+	class posix_platform final
+	{
+	public:
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		static library_handle load_library(fs::path const & path);
+
+		static bool free_library(library_handle handle);
+
+		static void * get_proc_address(library_handle handle, string const & method_name);
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+#endif // _ML_POSIX_PLATFORM_HPP_
\ No newline at end of file
@@ -63,6 +63,17 @@ namespace ml
 		}
 	}
 
+	void win32_platform::wait_events(float64 timeout)
+	{
+		MsgWaitForMultipleObjects(0, nullptr, FALSE, (DWORD)(timeout * 1000.0), QS_ALLINPUT);
+
+		poll_events();
+	}
+
+	void win32_platform::post_empty_event()
+	{
+	}
+
 	void win32_platform::swap_buffers(window_handle handle)
 	{
 	}
@@ -763,6 +763,16 @@ namespace ml
 			});
 		}
 
+		// O(1) unordered erase, moves the last element into the hole
+		void swap_remove(size_t const i)
+		{
+			this->for_tuple([&](auto & v)
+			{
+				if (i + 1 != v.size()) { v[i] = std::move(v.back()); }
+				v.pop_back();
+			});
+		}
+
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 		template <size_t I, class U = value_i<I>
@@ -3,6 +3,10 @@
 
 #include <modus_core/detail/Array.hpp>
 
+#if ML_has_sse2
+#include <emmintrin.h>
+#endif
+
 namespace ml::ds
 {
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -26,11 +30,18 @@ namespace ml::ds
 		>;
 
 		static constexpr ptrdiff_t bits_per_word{ sizeof(value_type) * 8 };
-		
+
 		static constexpr ptrdiff_t word_count{ (bit_count - 1) / bits_per_word };
 
 		using storage_type = typename _ML array<value_type, word_count + 1>;
 
+		static constexpr size_t npos{ static_cast<size_t>(-1) };
+
+		// valid bits of the last word
+		static constexpr value_type tail_mask{ (bit_count % bits_per_word)
+			? static_cast<value_type>((value_type{ 1 } << (bit_count % bits_per_word)) - 1)
+			: static_cast<value_type>(~value_type{}) };
+
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 		constexpr bitset() noexcept : m_words{} {}
@@ -39,6 +50,7 @@ namespace ml::ds
 		> constexpr bitset(T const value) noexcept
 			: m_words{ static_cast<value_type>(value) }
 		{
+			m_words[word_count] &= tail_mask;
 		}
 
 		constexpr bitset(self_type const & value)
@@ -52,23 +64,21 @@ namespace ml::ds
 		}
 
 		template <size_t N
-		> constexpr bitset(bitset<N> const & value)
-			: m_words{ value.m_words }
-		{
-		}
-
-		template <size_t N
-		> constexpr bitset(bitset<N> && value) noexcept
-			: m_words{ std::move(value.m_words) }
+		> constexpr bitset(bitset<N> const & value) noexcept
+			: m_words{}
 		{
+			for (size_t i = 0, n = ML_min(bit_count, N); i < n; ++i)
+			{
+				write(i, value.read(i));
+			}
 		}
 
 		constexpr bitset(array_type const & value) noexcept
 			: m_words{}
 		{
-			for (auto it = value.begin(); it != value.end(); ++it)
+			for (size_t i = 0; i < bit_count; ++i)
 			{
-				write(std::distance(str.begin(), it), *it);
+				write(i, value[i]);
 			}
 		}
 
@@ -83,7 +93,7 @@ namespace ml::ds
 
 		constexpr self_type & operator=(self_type && value) noexcept
 		{
-			swap(std::move(value));
+			swap(value);
 			return (*this);
 		}
 
@@ -107,7 +117,7 @@ namespace ml::ds
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-		ML_NODISCARD constexpr operator bool() const noexcept { return m_words; }
+		ML_NODISCARD constexpr operator bool() const noexcept { return any(); }
 
 		ML_NODISCARD constexpr operator storage_type const & () const & noexcept { return m_words; }
 
@@ -123,24 +133,24 @@ namespace ml::ds
 
 		ML_NODISCARD constexpr bool read(size_t const i) const noexcept
 		{
-			return ML_bit_read(m_words[i / bits_per_word], i % bits_per_word);
+			return (m_words[i / bits_per_word] >> (i % bits_per_word)) & 1;
 		}
 
 		constexpr bool clear(size_t const i) noexcept
 		{
 			bool const temp{ this->read(i) };
-			
-			ML_bit_clear(m_words[i / bits_per_word], i % bits_per_word);
-			
+
+			m_words[i / bits_per_word] &= ~bit(i);
+
 			return temp;
 		}
 
 		constexpr bool set(size_t const i) noexcept
 		{
 			bool const temp{ !this->read(i) };
-			
-			ML_bit_set(m_words[i / bits_per_word], i % bits_per_word);
-			
+
+			m_words[i / bits_per_word] |= bit(i);
+
 			return temp;
 		}
 
@@ -163,12 +173,126 @@ namespace ml::ds
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+		// number of set bits
+		ML_NODISCARD constexpr size_t count() const noexcept
+		{
+			size_t temp{};
+			for (value_type const w : m_words)
+			{
+				temp += popcount(w);
+			}
+			return temp;
+		}
+
+		ML_NODISCARD constexpr bool any() const noexcept
+		{
+			value_type temp{};
+			for (value_type const w : m_words)
+			{
+				temp |= w;
+			}
+			return temp != 0;
+		}
+
+		ML_NODISCARD constexpr bool none() const noexcept { return !any(); }
+
+		ML_NODISCARD constexpr bool all() const noexcept
+		{
+			for (ptrdiff_t i = 0; i < word_count; ++i)
+			{
+				if (m_words[i] != static_cast<value_type>(~value_type{})) { return false; }
+			}
+			return m_words[word_count] == tail_mask;
+		}
+
+		// every bit of mask is also set here
+		ML_NODISCARD constexpr bool contains(self_type const & mask) const noexcept
+		{
+			value_type temp{};
+			for (size_t i = 0; i < m_words.size(); ++i)
+			{
+				temp |= mask.m_words[i] & ~m_words[i];
+			}
+			return temp == 0;
+		}
+
+		// any bit is set in both
+		ML_NODISCARD constexpr bool intersects(self_type const & other) const noexcept
+		{
+			value_type temp{};
+			for (size_t i = 0; i < m_words.size(); ++i)
+			{
+				temp |= other.m_words[i] & m_words[i];
+			}
+			return temp != 0;
+		}
+
+		// index of the lowest set bit, npos if none
+		ML_NODISCARD constexpr size_t find_first() const noexcept
+		{
+			return this->find_from(0);
+		}
+
+		// index of the lowest set bit above i, npos if none
+		ML_NODISCARD constexpr size_t find_next(size_t const i) const noexcept
+		{
+			return (i + 1 < bit_count) ? this->find_from(i + 1) : npos;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		constexpr self_type & reset() noexcept
+		{
+			for (value_type & w : m_words) { w = 0; }
+			return (*this);
+		}
+
+		constexpr self_type & flip() noexcept
+		{
+			for (value_type & w : m_words) { w = ~w; }
+			m_words[word_count] &= tail_mask;
+			return (*this);
+		}
+
+		constexpr self_type & operator&=(self_type const & other) noexcept
+		{
+			for (size_t i = 0; i < m_words.size(); ++i) { m_words[i] &= other.m_words[i]; }
+			return (*this);
+		}
+
+		constexpr self_type & operator|=(self_type const & other) noexcept
+		{
+			for (size_t i = 0; i < m_words.size(); ++i) { m_words[i] |= other.m_words[i]; }
+			return (*this);
+		}
+
+		constexpr self_type & operator^=(self_type const & other) noexcept
+		{
+			for (size_t i = 0; i < m_words.size(); ++i) { m_words[i] ^= other.m_words[i]; }
+			return (*this);
+		}
+
+		ML_NODISCARD constexpr self_type operator~() const noexcept { return self_type{ *this }.flip(); }
+
+		ML_NODISCARD friend constexpr self_type operator&(self_type lhs, self_type const & rhs) noexcept { return lhs &= rhs; }
+
+		ML_NODISCARD friend constexpr self_type operator|(self_type lhs, self_type const & rhs) noexcept { return lhs |= rhs; }
+
+		ML_NODISCARD friend constexpr self_type operator^(self_type lhs, self_type const & rhs) noexcept { return lhs ^= rhs; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// numeric order, highest word first
 		template <class Other = self_type
-		> constexpr auto compare(Other const & other) const noexcept
+		> constexpr int32 compare(Other const & other) const noexcept
 		{
 			if constexpr (std::is_same_v<Other, self_type>)
 			{
-				return ML_compare(m_words, other.m_words);
+				for (ptrdiff_t i = word_count; i >= 0; --i)
+				{
+					if (m_words[i] != other.m_words[i]) { return ML_compare(m_words[i], other.m_words[i]); }
+				}
+				return 0;
 			}
 			else
 			{
@@ -215,6 +339,33 @@ namespace ml::ds
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	private:
+		ML_NODISCARD static constexpr value_type bit(size_t const i) noexcept
+		{
+			return static_cast<value_type>(value_type{ 1 } << (i % bits_per_word));
+		}
+
+		// branchless popcount, usable in constant expressions
+		ML_NODISCARD static constexpr size_t popcount(uint64 x) noexcept
+		{
+			x = x - ((x >> 1) & 0x5555555555555555ULL);
+			x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+			x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+			return static_cast<size_t>((x * 0x0101010101010101ULL) >> 56);
+		}
+
+		ML_NODISCARD constexpr size_t find_from(size_t const first) const noexcept
+		{
+			size_t i{ first / bits_per_word };
+			value_type w{ static_cast<value_type>(m_words[i] & (static_cast<value_type>(~value_type{}) << (first % bits_per_word))) };
+			while (!w)
+			{
+				if (++i == m_words.size()) { return npos; }
+				w = m_words[i];
+			}
+			// trailing zeros of w
+			return i * bits_per_word + popcount(static_cast<value_type>((w & (~w + 1)) - 1));
+		}
+
 		storage_type m_words;
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -222,26 +373,85 @@ namespace ml::ds
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+	// out[i] = first[i].contains(mask) for count bitsets, returns the number of matches
+	template <size_t N
+	> size_t match_bitsets(bitset<N> const & mask, bitset<N> const * first, size_t count, bool * out) noexcept
+	{
+		using B = bitset<N>;
+		size_t i{}, matches{};
+#if ML_has_sse2
+		if constexpr (sizeof(B) == sizeof(uint32))
+		{
+			// four single word signatures per register
+			__m128i const m{ _mm_set1_epi32(static_cast<int>(mask.words()[0])) };
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i const s{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i)) };
+				int const bits{ _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(s, m), m))) };
+				for (int j = 0; j < 4; ++j) { matches += (out[i + j] = (bits >> j) & 1); }
+			}
+		}
+		else if constexpr (sizeof(B) == sizeof(uint64))
+		{
+			// two single word signatures per register, 64-bit equality from halves
+			__m128i const m{ _mm_set1_epi64x(static_cast<long long>(mask.words()[0])) };
+			for (; i + 2 <= count; i += 2)
+			{
+				__m128i const s{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i)) };
+				__m128i const e{ _mm_cmpeq_epi32(_mm_and_si128(s, m), m) };
+				int const bits{ _mm_movemask_pd(_mm_castsi128_pd(_mm_and_si128(e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1))))) };
+				matches += (out[i] = bits & 1);
+				matches += (out[i + 1] = (bits >> 1) & 1);
+			}
+		}
+		else if constexpr (sizeof(B) % 16 == 0)
+		{
+			// wide signatures, sixteen bytes at a time
+			auto const mb{ reinterpret_cast<byte const *>(&mask) };
+			for (; i < count; ++i)
+			{
+				auto const sb{ reinterpret_cast<byte const *>(first + i) };
+				int bits{ 0xFFFF };
+				for (size_t k = 0; k < sizeof(B); k += 16)
+				{
+					__m128i const m{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(mb + k)) };
+					__m128i const s{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(sb + k)) };
+					bits &= _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(s, m), m));
+				}
+				matches += (out[i] = (bits == 0xFFFF));
+			}
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			matches += (out[i] = first[i].contains(mask));
+		}
+		return matches;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 	template <size_t N
 	> inline std::ostream & operator<<(std::ostream & out, bitset<N> const & value)
 	{
+		char temp[N];
 		for (size_t i = 0; i < N; ++i)
 		{
-			out << value.read(i);
+			temp[i] = value.read(i) ? '1' : '0';
 		}
-		return out;
+		return out.write(temp, N);
 	}
 
 	template <size_t N
 	> inline std::istream & operator>>(std::istream & in, bitset<N> & value)
 	{
+		value.reset();
+		in >> std::ws;
 		for (size_t i = 0; i < N; ++i)
 		{
-			if (in.good())
-			{
-				bool b{}; in >> b;
-				value.write(i, b);
-			}
+			auto const c{ in.peek() };
+			if (c != '0' && c != '1') { break; }
+			value.write(i, in.get() == '1');
 		}
 		return in;
 	}
@@ -22,6 +22,16 @@
 #define ML_DEBUG_MSG_WARNING "[warn] "
 #endif
 
+// lowest log level compiled in
+#ifndef ML_LOG_LEVEL
+#define ML_LOG_LEVEL 0
+#endif
+
+// formatting buffer
+#ifndef ML_DEBUG_BUFFER_SIZE
+#define ML_DEBUG_BUFFER_SIZE 1024
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 // verify backend
@@ -76,6 +86,20 @@
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+namespace ml
+{
+	// log levels
+	enum log_level_ : int32
+	{
+		log_level_trace,	// plain output
+		log_level_info,		// success
+		log_level_warning,	// warning
+		log_level_error,	// failure
+
+		log_level_MAX
+	};
+}
+
 namespace ml::debug
 {
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -94,6 +118,44 @@ namespace ml::debug
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+	// hand a line to the asynchronous logger, returns false if none is running
+	ML_CORE_API bool submit(int32 level, cstring str, size_t size) noexcept;
+
+	ML_NODISCARD constexpr cstring get_prefix(int32 level) noexcept
+	{
+		switch (level)
+		{
+		default					: return "";
+		case log_level_info		: return ML_DEBUG_MSG_SUCCESS;
+		case log_level_warning	: return ML_DEBUG_MSG_WARNING;
+		case log_level_error	: return ML_DEBUG_MSG_FAILURE;
+		}
+	}
+
+	// format a line and submit it, or write it out directly
+	template <class Fmt, class ... Args
+	> auto print(int32 level, Fmt const & fmt, Args const & ... args) noexcept -> std::ostream &
+	{
+		std::ostream & out{ io.out.get() };
+		if (level < ML_LOG_LEVEL) { return out; }
+
+		char buf[ML_DEBUG_BUFFER_SIZE];
+		if (size_t const n{ util::format_to_n(buf, sizeof(buf), fmt, args...) }; n < sizeof(buf))
+		{
+			if (submit(level, buf, n)) { return out; }
+			return out.write(get_prefix(level), std::strlen(get_prefix(level))).write(buf, n) << "\n";
+		}
+		else
+		{
+			string str{};
+			util::format_to(std::back_inserter(str), fmt, args...);
+			if (submit(level, str.data(), str.size())) { return out; }
+			return out << get_prefix(level) << str << "\n";
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 	inline int32 clear(int32 exit_code = EXIT_SUCCESS) noexcept
 	{
 #ifdef ML_os_windows
@@ -121,16 +183,13 @@ namespace ml::debug
 	template <class Str
 	> auto puts(Str && str) noexcept -> std::ostream &
 	{
-		return io.out.get() << ML_forward(str) << "\n";
+		return _ML_DEBUG print(log_level_trace, "{0}", str);
 	}
 
 	template <class Fmt, class Arg0, class ... Args
 	> auto puts(Fmt && fmt, Arg0 && arg0, Args && ... args) noexcept -> std::ostream &
 	{
-		return _ML_DEBUG puts
-		(
-			util::format(ML_forward(fmt), ML_forward(arg0), ML_forward(args)...)
-		);
+		return _ML_DEBUG print(log_level_trace, fmt, arg0, args...);
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -142,7 +201,7 @@ namespace ml::debug
 	template <class Str
 	> int32 good(Str && str) noexcept
 	{
-		io.out.get() << ML_DEBUG_MSG_SUCCESS << ML_forward(str) << "\n";
+		_ML_DEBUG print(log_level_info, "{0}", str);
 
 		return _ML_DEBUG good();
 	}
@@ -151,10 +210,9 @@ namespace ml::debug
 	template <class Fmt, class Arg0, class ... Args
 	> int32 good(Fmt && fmt, Arg0 && arg0, Args && ... args) noexcept
 	{
-		return _ML_DEBUG good
-		(
-			_ML util::format(ML_forward(fmt), ML_forward(arg0), ML_forward(args)...)
-		);
+		_ML_DEBUG print(log_level_info, fmt, arg0, args...);
+
+		return _ML_DEBUG good();
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -166,7 +224,7 @@ namespace ml::debug
 	template <class Str
 	> int32 fail(Str && str) noexcept
 	{
-		io.out.get() << ML_DEBUG_MSG_FAILURE << ML_forward(str) << "\n";
+		_ML_DEBUG print(log_level_error, "{0}", str);
 
 		return _ML_DEBUG fail();
 	}
@@ -175,10 +233,9 @@ namespace ml::debug
 	template <class Fmt, class Arg0, class ... Args
 	> int32 fail(Fmt && fmt, Arg0 && arg0, Args && ... args) noexcept
 	{
-		return _ML_DEBUG fail
-		(
-			_ML util::format(ML_forward(fmt), ML_forward(arg0), ML_forward(args)...)
-		);
+		_ML_DEBUG print(log_level_error, fmt, arg0, args...);
+
+		return _ML_DEBUG fail();
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -190,7 +247,7 @@ namespace ml::debug
 	template <class Str
 	> int32 warn(Str && str) noexcept
 	{
-		io.out.get() << ML_DEBUG_MSG_WARNING << ML_forward(str) << "\n";
+		_ML_DEBUG print(log_level_warning, "{0}", str);
 
 		return _ML_DEBUG warn();
 	}
@@ -199,10 +256,9 @@ namespace ml::debug
 	template <class Fmt, class Arg0, class ... Args
 	> int32 warn(Fmt && fmt, Arg0 && arg0, Args && ... args) noexcept
 	{
-		return _ML_DEBUG warn
-		(
-			_ML util::format(ML_forward(fmt), ML_forward(arg0), ML_forward(args)...)
-		);
+		_ML_DEBUG print(log_level_warning, fmt, arg0, args...);
+
+		return _ML_DEBUG warn();
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
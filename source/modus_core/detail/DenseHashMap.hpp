@@ -0,0 +1,584 @@
+#ifndef _ML_DENSE_HASH_MAP_HPP_
+#define _ML_DENSE_HASH_MAP_HPP_
+
+#include <modus_core/detail/Utility.hpp>
+#include <modus_core/detail/List.hpp>
+
+#if ML_has_sse2
+#include <emmintrin.h>
+#endif
+
+#if defined(ML_cc_msvc)
+#include <intrin.h>
+#endif
+
+namespace ml::ds
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// BASIC DENSE HASH MAP
+	// keys and values are kept in dense lists like flat_map, lookups go through an
+	// open addressed table of control bytes probed sixteen slots at a time
+	template <
+		class	_Kt,	// key type
+		class	_Vt,	// value type
+		class	_Hs,	// key hasher type
+		class	_Eq		// key equality predicate type
+	> struct basic_dense_hash_map
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		using self_type			= typename basic_dense_hash_map<_Kt, _Vt, _Hs, _Eq>;
+		using key_type			= typename _Kt;
+		using value_type		= typename _Vt;
+		using hasher_type		= typename _Hs;
+		using equal_type		= typename _Eq;
+		using allocator_type	= typename pmr::polymorphic_allocator<byte>;
+		using difference_type	= typename ptrdiff_t;
+		using size_type			= typename size_t;
+
+		static constexpr size_type npos{ static_cast<size_type>(-1) };
+
+		static constexpr size_type group_width{ 16 };
+
+		static constexpr int8 ctrl_empty{ -128 }; // never used
+
+		static constexpr int8 ctrl_deleted{ -2 }; // erased, probing continues past it
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		using key_storage				= typename list<key_type>;
+		using key_const_pointer			= typename key_storage::const_pointer;
+
+		using value_storage				= typename list<value_type>;
+		using value_pointer				= typename value_storage::pointer;
+		using value_const_pointer		= typename value_storage::const_pointer;
+
+		using control_storage			= typename list<int8>;
+		using index_storage				= typename list<uint32>;
+
+		using keyval_pair				= typename std::pair<key_type, value_type>;
+		using init_type					= typename std::initializer_list<keyval_pair>;
+
+		using pointer_pair				= typename std::pair<key_const_pointer, value_pointer>;
+		using const_pointer_pair		= typename std::pair<key_const_pointer, value_const_pointer>;
+
+		using optl_pointer_pair			= typename std::optional<pointer_pair>;
+		using optl_const_pointer_pair	= typename std::optional<const_pointer_pair>;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		basic_dense_hash_map(allocator_type alloc = {}) noexcept
+			: m_keys	{ alloc }
+			, m_values	{ alloc }
+			, m_ctrl	{ alloc }
+			, m_slots	{ alloc }
+			, m_growth	{}
+		{
+		}
+
+		basic_dense_hash_map(init_type value, allocator_type alloc = {})
+			: self_type{ alloc }
+		{
+			this->assign(value);
+		}
+
+		basic_dense_hash_map(self_type const & value, allocator_type alloc = {})
+			: m_keys	{ value.m_keys, alloc }
+			, m_values	{ value.m_values, alloc }
+			, m_ctrl	{ value.m_ctrl, alloc }
+			, m_slots	{ value.m_slots, alloc }
+			, m_growth	{ value.m_growth }
+		{
+		}
+
+		basic_dense_hash_map(self_type && value, allocator_type alloc = {}) noexcept
+			: self_type{ alloc }
+		{
+			this->swap(value);
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		self_type & operator=(init_type value)
+		{
+			self_type temp{ value };
+			this->swap(temp);
+			return (*this);
+		}
+
+		self_type & operator=(self_type const & value)
+		{
+			self_type temp{ value };
+			this->swap(temp);
+			return (*this);
+		}
+
+		self_type & operator=(self_type && value) noexcept
+		{
+			this->swap(value);
+			return (*this);
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		void assign(init_type value)
+		{
+			this->clear();
+
+			this->reserve(value.size());
+
+			for (auto it = value.begin(); it != value.end(); ++it)
+			{
+				this->insert(it->first, it->second);
+			}
+		}
+
+		void clear() noexcept
+		{
+			m_keys.clear();
+			m_values.clear();
+			std::fill(m_ctrl.begin(), m_ctrl.end(), ctrl_empty);
+			m_growth = impl_max_load(m_ctrl.size());
+		}
+
+		void reserve(size_type const count)
+		{
+			m_keys.reserve(count);
+			m_values.reserve(count);
+			if (impl_max_load(m_ctrl.size()) < count)
+			{
+				this->impl_rehash(count);
+			}
+		}
+
+		void swap(self_type & value) noexcept
+		{
+			if (this != std::addressof(value))
+			{
+				m_keys.swap(value.m_keys);
+				m_values.swap(value.m_values);
+				m_ctrl.swap(value.m_ctrl);
+				m_slots.swap(value.m_slots);
+				std::swap(m_growth, value.m_growth);
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// insertion order, until something is erased
+		ML_NODISCARD key_storage const & keys() const & noexcept
+		{
+			return m_keys;
+		}
+
+		ML_NODISCARD value_storage const & values() const & noexcept
+		{
+			return m_values;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD size_type capacity() const noexcept
+		{
+			return m_ctrl.size();
+		}
+
+		ML_NODISCARD bool empty() const noexcept
+		{
+			return m_keys.empty();
+		}
+
+		ML_NODISCARD size_type size() const noexcept
+		{
+			return m_keys.size();
+		}
+
+		ML_NODISCARD allocator_type get_allocator() const noexcept
+		{
+			return m_keys.get_allocator();
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <class Key = key_type
+		> ML_NODISCARD bool contains(Key && key) const noexcept
+		{
+			key_type const & k{ key };
+			return this->impl_find(k, impl_hash(k)) != npos;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <class Key = key_type
+		> ML_NODISCARD optl_pointer_pair find(Key && key) noexcept
+		{
+			key_type const & k{ key };
+			if (size_type const slot{ this->impl_find(k, impl_hash(k)) }; slot != npos)
+			{
+				return std::make_optional(this->impl_pair(m_slots[slot]));
+			}
+			else
+			{
+				return std::nullopt;
+			}
+		}
+
+		template <class Key = key_type
+		> ML_NODISCARD optl_const_pointer_pair find(Key && key) const noexcept
+		{
+			key_type const & k{ key };
+			if (size_type const slot{ this->impl_find(k, impl_hash(k)) }; slot != npos)
+			{
+				size_type const i{ m_slots[slot] };
+				return std::make_optional(const_pointer_pair{ &m_keys[i], &m_values[i] });
+			}
+			else
+			{
+				return std::nullopt;
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// the last entry is moved into the hole
+		bool erase(key_type const & key) noexcept
+		{
+			size_type const slot{ this->impl_find(key, impl_hash(key)) };
+			if (slot == npos) { return false; }
+			this->impl_erase(slot);
+			return true;
+		}
+
+		void erase(key_const_pointer it) noexcept
+		{
+			size_type const i{ (size_type)(it - m_keys.data()) };
+			this->impl_erase(this->impl_probe(impl_hash(*it), [&](uint32 j) noexcept { return i == j; }));
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <class Key, class ... Args
+		> std::pair<pointer_pair, bool> try_emplace(Key && key, Args && ... args) noexcept
+		{
+			key_type const & k{ key };
+			size_type const h{ impl_hash(k) };
+			if (size_type const slot{ this->impl_find(k, h) }; slot != npos)
+			{
+				return { this->impl_pair(m_slots[slot]), false };
+			}
+
+			if (!m_growth)
+			{
+				this->impl_rehash(m_keys.size() * 2 + 1);
+			}
+			size_type const slot{ this->impl_find_free(h) };
+			m_growth -= (m_ctrl[slot] == ctrl_empty);
+			this->impl_set(slot, h, m_keys.size());
+			m_keys.emplace_back(ML_forward(key));
+			m_values.emplace_back(ML_forward(args)...);
+			return { this->impl_pair(m_keys.size() - 1), true };
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <class Key = key_type, class Value = value_type
+		> pointer_pair insert(Key && key, Value && value) noexcept
+		{
+			return this->try_emplace(ML_forward(key), ML_forward(value)).first;
+		}
+
+		pointer_pair insert(keyval_pair const & kvp) noexcept
+		{
+			return this->try_emplace(kvp.first, kvp.second).first;
+		}
+
+		pointer_pair insert(keyval_pair && kvp) noexcept
+		{
+			return this->try_emplace(std::move(kvp.first), std::move(kvp.second)).first;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <class Key = key_type
+		> ML_NODISCARD value_type & operator[](Key && key) & noexcept
+		{
+			return this->at(ML_forward(key));
+		}
+
+		template <class Key = key_type
+		> ML_NODISCARD value_type & at(Key && key) noexcept
+		{
+			return *this->try_emplace(ML_forward(key)).first.second;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <class Key = key_type, class Value = value_type
+		> ML_NODISCARD value_type & find_or_add(Key && key, Value && value) noexcept
+		{
+			return *this->try_emplace(ML_forward(key), ML_forward(value)).first.second;
+		}
+
+		template <class Key, class Fn, class ... Args
+		> ML_NODISCARD value_type & find_or_add_fn(Key && key, Fn && fn, Args && ... args) noexcept
+		{
+			if (auto const it{ this->find(key) })
+			{
+				return (*it->second);
+			}
+			else
+			{
+				return *this->insert(ML_forward(key), std::invoke(ML_forward(fn), ML_forward(args)...)).second;
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <class Fn
+		> void for_each(Fn && fn)
+		{
+			for (size_type i = 0, imax = m_keys.size(); i < imax; ++i)
+			{
+				std::invoke(ML_forward(fn), m_keys[i], m_values[i]);
+			}
+		}
+
+		template <class Fn
+		> void for_each(Fn && fn) const
+		{
+			for (size_type i = 0, imax = m_keys.size(); i < imax; ++i)
+			{
+				std::invoke(ML_forward(fn), m_keys[i], m_values[i]);
+			}
+		}
+
+		template <class Fn
+		> void for_each_n(difference_type count, Fn && fn)
+		{
+			for (size_type i = 0, imax = ML_min((size_type)ML_max(count, 0), m_keys.size()); i < imax; ++i)
+			{
+				std::invoke(ML_forward(fn), m_keys[i], m_values[i]);
+			}
+		}
+
+		template <class Fn
+		> void for_each_n(difference_type count, Fn && fn) const
+		{
+			for (size_type i = 0, imax = ML_min((size_type)ML_max(count, 0), m_keys.size()); i < imax; ++i)
+			{
+				std::invoke(ML_forward(fn), m_keys[i], m_values[i]);
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		// bit i is set where control byte i of the group equals value
+		ML_NODISCARD static uint32 impl_match(int8 const * group, int8 value) noexcept
+		{
+#if ML_has_sse2
+			__m128i const ctrl{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(group)) };
+			return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), ctrl));
+#else
+			uint32 mask{};
+			for (size_type i = 0; i < group_width; ++i)
+			{
+				mask |= (uint32)(group[i] == value) << i;
+			}
+			return mask;
+#endif
+		}
+
+		// bit i is set where slot i of the group is empty or deleted
+		ML_NODISCARD static uint32 impl_match_free(int8 const * group) noexcept
+		{
+#if ML_has_sse2
+			return (uint32)_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(group)));
+#else
+			uint32 mask{};
+			for (size_type i = 0; i < group_width; ++i)
+			{
+				mask |= (uint32)(group[i] < 0) << i;
+			}
+			return mask;
+#endif
+		}
+
+		ML_NODISCARD static uint32 impl_lowest_bit(uint32 mask) noexcept
+		{
+#if defined(ML_cc_msvc)
+			unsigned long i;
+			_BitScanForward(&i, mask);
+			return (uint32)i;
+#else
+			return (uint32)__builtin_ctz(mask);
+#endif
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// identity hashes of integers would leave the low bits clustered
+		ML_NODISCARD static size_type impl_hash(key_type const & key) noexcept
+		{
+			uint64 const h{ (uint64)hasher_type{}(key) * 0x9E3779B97F4A7C15ULL };
+			return (size_type)(h ^ (h >> 32));
+		}
+
+		// seven eighths of the table may be used before it grows
+		ML_NODISCARD static size_type impl_max_load(size_type capacity) noexcept
+		{
+			return capacity - capacity / 8;
+		}
+
+		ML_NODISCARD pointer_pair impl_pair(size_type i) noexcept
+		{
+			return { &m_keys[i], &m_values[i] };
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// visit slots whose tag matches in probe order, stops at the first group with an empty slot
+		template <class Pr
+		> ML_NODISCARD size_type impl_probe(size_type h, Pr && pr) const noexcept
+		{
+			if (m_ctrl.empty()) { return npos; }
+			int8 const tag{ (int8)(h & 0x7F) };
+			size_type const mask{ m_ctrl.size() / group_width - 1 };
+			for (size_type g{ (h >> 7) & mask }, step{}; ; g = (g + ++step) & mask)
+			{
+				int8 const * const group{ m_ctrl.data() + g * group_width };
+				for (uint32 m{ impl_match(group, tag) }; m; m &= m - 1)
+				{
+					size_type const slot{ g * group_width + impl_lowest_bit(m) };
+					if (pr(m_slots[slot])) { return slot; }
+				}
+				if (impl_match(group, ctrl_empty)) { return npos; }
+			}
+		}
+
+		ML_NODISCARD size_type impl_find(key_type const & key, size_type h) const noexcept
+		{
+			return this->impl_probe(h, [&](uint32 i) noexcept { return equal_type{}(m_keys[i], key); });
+		}
+
+		// first empty or deleted slot in probe order, there is always one
+		ML_NODISCARD size_type impl_find_free(size_type h) const noexcept
+		{
+			size_type const mask{ m_ctrl.size() / group_width - 1 };
+			for (size_type g{ (h >> 7) & mask }, step{}; ; g = (g + ++step) & mask)
+			{
+				if (uint32 const m{ impl_match_free(m_ctrl.data() + g * group_width) })
+				{
+					return g * group_width + impl_lowest_bit(m);
+				}
+			}
+		}
+
+		void impl_set(size_type slot, size_type h, size_type i) noexcept
+		{
+			m_ctrl[slot] = (int8)(h & 0x7F);
+			m_slots[slot] = (uint32)i;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// rebuild the table for at least count entries, also drops deleted slots
+		void impl_rehash(size_type count)
+		{
+			size_type capacity{ group_width };
+			while (impl_max_load(capacity) < ML_max(count, m_keys.size())) { capacity *= 2; }
+
+			m_ctrl.assign(capacity, ctrl_empty);
+			m_slots.resize(capacity);
+			for (size_type i = 0, imax = m_keys.size(); i < imax; ++i)
+			{
+				size_type const h{ impl_hash(m_keys[i]) };
+				this->impl_set(this->impl_find_free(h), h, i);
+			}
+			m_growth = impl_max_load(capacity) - m_keys.size();
+		}
+
+		void impl_erase(size_type slot) noexcept
+		{
+			size_type const i{ m_slots[slot] }, last{ m_keys.size() - 1 };
+
+			// probing never passed a group that still has an empty slot, so it can stay empty
+			if (impl_match(m_ctrl.data() + slot / group_width * group_width, ctrl_empty))
+			{
+				m_ctrl[slot] = ctrl_empty;
+				++m_growth;
+			}
+			else
+			{
+				m_ctrl[slot] = ctrl_deleted;
+			}
+
+			if (i != last)
+			{
+				size_type const moved{ this->impl_probe(impl_hash(m_keys[last]), [&](uint32 j) noexcept { return last == j; }) };
+				m_slots[moved] = (uint32)i;
+				m_keys[i] = std::move(m_keys[last]);
+				m_values[i] = std::move(m_values[last]);
+			}
+			m_keys.pop_back();
+			m_values.pop_back();
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		key_storage		m_keys	; // dense keys
+		value_storage	m_values; // dense values
+		control_storage	m_ctrl	; // tag per slot, or empty/deleted
+		index_storage	m_slots	; // dense index per slot
+		size_type		m_growth; // inserts left before a rehash
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	template <class K, class V, class H, class E
+	> void to_json(json & j, basic_dense_hash_map<K, V, H, E> const & v)
+	{
+		j["keys"	] = v.keys();
+		j["values"	] = v.values();
+	}
+
+	template <class K, class V, class H, class E
+	> void from_json(json const & j, basic_dense_hash_map<K, V, H, E> & v)
+	{
+		list<K> const keys{ j["keys"].get<list<K>>() };
+		list<V> const values{ j["values"].get<list<V>>() };
+
+		v.clear();
+		v.reserve(ML_min(keys.size(), values.size()));
+		for (size_t i = 0, imax = ML_min(keys.size(), values.size()); i < imax; ++i)
+		{
+			v.insert(keys[i], values[i]);
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// DENSE HASH MAP | flat unordered associative container
+	template <
+		class	_Kt,							// key type
+		class	_Vt,							// value type
+		class	_Hs = std::hash<_Kt>,			// key hasher type
+		class	_Eq = std::equal_to<_Kt>		// key equality predicate type
+	> ML_alias dense_hash_map = ds::basic_dense_hash_map
+	<
+		_Kt, _Vt, _Hs, _Eq
+	>;
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+#endif // !_ML_DENSE_HASH_MAP_HPP_
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include <modus_core/detail/BatchVector.hpp>
 #include <modus_core/detail/BitSet.hpp>
+#include <modus_core/detail/SoaVector.hpp>
 #include <modus_core/detail/Debug.hpp>
 
 // system declarator helper
@@ -95,7 +96,7 @@ namespace ml::ecs::detail
 
 		using type_list = typename meta::list<Components...>;
 
-		using storage_type = typename batch_vector<Components...>;
+		using storage_type = typename soa_vector<Components...>;
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
@@ -416,7 +417,7 @@ namespace ml::ecs
 
 		enum : size_t { id_alive, id_index, id_handle, id_bitset };
 
-		using entity_storage = typename batch_vector
+		using entity_storage = typename soa_vector
 		<
 			bool,		// state of entity ( alive / dead )
 			size_t,		// component index
@@ -959,7 +960,7 @@ namespace ml::ecs
 
 		ML_NODISCARD bool matches_signature(size_t const i, signature const & s) const noexcept
 		{
-			return (s & this->get_signature(i)) == s;
+			return this->get_signature(i).contains(s);
 		}
 
 		template <class S
@@ -1020,13 +1021,23 @@ namespace ml::ecs
 		template <class S, class Fn
 		> self_type & for_matching(Fn && fn) noexcept
 		{
-			return this->for_entities([&](size_t const i) noexcept
+			// test signatures a block at a time, then visit the matches,
+			// fn may change components so each match is tested again before the call
+			signature const & mask{ traits::template signature_bitset<S>() };
+			bool matched[64];
+			for (size_t first = 0; first < m_size; first += ML_arraysize(matched))
 			{
-				if (this->matches_signature<S>(i))
+				size_t const count{ ML_min(m_size - first, ML_arraysize(matched)) };
+				if (!ds::match_bitsets(mask, &this->get_signature(first), count, matched)) { continue; }
+				for (size_t j = 0; j < count; ++j)
 				{
-					this->expand_call<S>(i, ML_forward(fn));
+					if (matched[j] && this->matches_signature(first + j, mask))
+					{
+						this->expand_call<S>(first + j, ML_forward(fn));
+					}
 				}
-			});
+			}
+			return (*this);
 		}
 
 		// invoke function on all alive entities matching a system
@@ -0,0 +1,332 @@
+#ifndef _ML_FORMAT_HPP_
+#define _ML_FORMAT_HPP_
+
+#include <modus_core/detail/String.hpp>
+
+// compile time format pattern
+#define ML_format(str) \
+	([]() noexcept -> _ML util::format_pattern const & { static constexpr _ML util::format_pattern p{ str }; return p; }())
+
+namespace ml::util
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// find the next {N} at or after first, returns false when only text remains
+	ML_NODISCARD constexpr bool format_scan(std::string_view str, size_t first, size_t & open, size_t & close, uint32 & index) noexcept
+	{
+		for (size_t i = first; (i = str.find('{', i)) != str.npos; ++i)
+		{
+			size_t j{ i + 1 };
+			uint32 n{};
+			while (j < str.size() && '0' <= str[j] && str[j] <= '9')
+			{
+				n = n * 10 + (uint32)(str[j++] - '0');
+			}
+			if (j > i + 1 && j < str.size() && str[j] == '}')
+			{
+				open = i;
+				close = j + 1;
+				index = n;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// pre-parsed format string
+	struct ML_NODISCARD format_pattern final
+	{
+		static constexpr size_t max_segments{ 32 };
+
+		static constexpr int32 text{ -1 }; // plain text
+
+		static constexpr int32 tail{ -2 }; // out of segments, scan the rest at runtime
+
+		struct segment final
+		{
+			uint32	first	{}; // text offset
+			uint32	size	{}; // text size
+			int32	index	{ text }; // argument, or text/tail
+		};
+
+		constexpr format_pattern(std::string_view str) noexcept
+			: m_str		{ str }
+			, m_size	{}
+			, m_data	{}
+		{
+			size_t i{}, open{}, close{};
+			uint32 index{};
+			while (i < str.size() && m_size < max_segments - 2)
+			{
+				if (!format_scan(str, i, open, close, index)) { break; }
+				if (open > i) { m_data[m_size++] = { (uint32)i, (uint32)(open - i), text }; }
+				m_data[m_size++] = { (uint32)open, (uint32)(close - open), (int32)index };
+				i = close;
+			}
+			if (i < str.size())
+			{
+				size_t const rest{ str.size() - i };
+				m_data[m_size++] = { (uint32)i, (uint32)rest, format_scan(str, i, open, close, index) ? tail : text };
+			}
+		}
+
+		constexpr format_pattern(cstring str) noexcept : format_pattern{ std::string_view{ str } } {}
+
+		ML_NODISCARD constexpr std::string_view str() const noexcept { return m_str; }
+
+		ML_NODISCARD constexpr size_t size() const noexcept { return m_size; }
+
+		ML_NODISCARD constexpr segment const * begin() const noexcept { return m_data; }
+
+		ML_NODISCARD constexpr segment const * end() const noexcept { return m_data + m_size; }
+
+	private:
+		std::string_view	m_str	; // source
+		size_t				m_size	; // segment count
+		segment				m_data[max_segments]; // segments
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// writes into an output iterator
+	template <class It
+	> struct format_iterator_sink final
+	{
+		It out;
+
+		void write(char const * str, size_t size) { out = std::copy_n(str, size, out); }
+
+		void put(char c) { *out++ = c; }
+	};
+
+	// writes into a fixed buffer, counts what did not fit
+	struct format_buffer_sink final
+	{
+		char *	data	; // buffer
+		size_t	capacity; // buffer size
+		size_t	count	; // characters written or needed
+
+		void write(char const * str, size_t size) noexcept
+		{
+			if (count < capacity)
+			{
+				std::memcpy(data + count, str, std::min(size, capacity - count));
+			}
+			count += size;
+		}
+
+		void put(char c) noexcept
+		{
+			if (count < capacity) { data[count] = c; }
+			++count;
+		}
+	};
+
+	// writes into a stream
+	struct format_stream_sink final
+	{
+		std::ostream & out;
+
+		void write(char const * str, size_t size) { out.write(str, (std::streamsize)size); }
+
+		void put(char c) { out.put(c); }
+	};
+
+	// forwards operator<< output to a sink
+	template <class Sink
+	> struct format_streambuf final : std::streambuf
+	{
+		explicit format_streambuf(Sink & sink) noexcept : m_sink{ sink } {}
+
+	protected:
+		int_type overflow(int_type c) override
+		{
+			if (!traits_type::eq_int_type(c, traits_type::eof())) { m_sink.put(traits_type::to_char_type(c)); }
+			return traits_type::not_eof(c);
+		}
+
+		std::streamsize xsputn(char const * str, std::streamsize size) override
+		{
+			m_sink.write(str, (size_t)size);
+			return size;
+		}
+
+	private:
+		Sink & m_sink;
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// write a single value
+	template <class Sink, class T
+	> void format_value(Sink & sink, T const & value)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			sink.put(value ? '1' : '0');
+		}
+		else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>)
+		{
+			// streams write every narrow character type as a character, int8 and byte included
+			sink.put(static_cast<char>(value));
+		}
+		else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+		{
+			char buf[24];
+			if constexpr (std::is_enum_v<T>)
+			{
+				auto const r{ std::to_chars(buf, std::end(buf), static_cast<std::underlying_type_t<T>>(value)) };
+				sink.write(buf, (size_t)(r.ptr - buf));
+			}
+			else
+			{
+				auto const r{ std::to_chars(buf, std::end(buf), value) };
+				sink.write(buf, (size_t)(r.ptr - buf));
+			}
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			// same output as the default stream precision
+			char buf[32];
+			auto const r{ std::to_chars(buf, std::end(buf), value, std::chars_format::general, 6) };
+			sink.write(buf, (size_t)(r.ptr - buf));
+		}
+		else if constexpr (std::is_pointer_v<T> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, char>)
+		{
+			if (value) { sink.write(value, std::char_traits<char>::length(value)); }
+		}
+		else if constexpr (std::is_convertible_v<T const &, std::string_view>)
+		{
+			std::string_view const str{ value };
+			sink.write(str.data(), str.size());
+		}
+		else
+		{
+			format_streambuf<Sink> buf{ sink };
+			std::ostream os{ &buf };
+			os << value;
+		}
+	}
+
+	// type erased argument
+	template <class Sink
+	> struct format_arg final
+	{
+		void const * value;
+
+		void(*write)(Sink &, void const *);
+	};
+
+	template <class Sink, class T
+	> ML_NODISCARD format_arg<Sink> make_format_arg(T const & value) noexcept
+	{
+		return { std::addressof(value), [](Sink & sink, void const * p) {
+			_ML util::format_value(sink, *static_cast<T const *>(p));
+		} };
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// scan and write in one pass
+	template <class Sink
+	> void vformat(Sink & sink, std::string_view str, format_arg<Sink> const * args, size_t count)
+	{
+		size_t i{}, open{}, close{};
+		uint32 index{};
+		while (format_scan(str, i, open, close, index))
+		{
+			if (index < count)
+			{
+				sink.write(str.data() + i, open - i);
+				args[index].write(sink, args[index].value);
+			}
+			else
+			{
+				sink.write(str.data() + i, close - i); // unknown index, left as is
+			}
+			i = close;
+		}
+		sink.write(str.data() + i, str.size() - i);
+	}
+
+	// write a pre-parsed pattern
+	template <class Sink
+	> void vformat(Sink & sink, format_pattern const & fmt, format_arg<Sink> const * args, size_t count)
+	{
+		std::string_view const str{ fmt.str() };
+		for (format_pattern::segment const & s : fmt)
+		{
+			if (s.index == format_pattern::tail)
+			{
+				_ML util::vformat(sink, str.substr(s.first, s.size), args, count);
+			}
+			else if (0 <= s.index && (size_t)s.index < count)
+			{
+				args[s.index].write(sink, args[s.index].value);
+			}
+			else
+			{
+				sink.write(str.data() + s.first, s.size);
+			}
+		}
+	}
+
+	template <class Sink, class Fmt, class ... Args
+	> void format_sink(Sink & sink, Fmt const & fmt, Args const & ... args)
+	{
+		format_arg<Sink> const temp[sizeof...(Args) + 1] = { _ML util::make_format_arg<Sink>(args)..., {} };
+		if constexpr (std::is_same_v<Fmt, format_pattern>)
+		{
+			_ML util::vformat(sink, fmt, temp, sizeof...(Args));
+		}
+		else
+		{
+			_ML util::vformat(sink, std::string_view{ fmt }, temp, sizeof...(Args));
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// format into an output iterator
+	template <class Out, class Fmt, class ... Args, std::enable_if_t<!std::is_base_of_v<std::ios_base, Out>, int> = 0
+	> Out format_to(Out out, Fmt const & fmt, Args const & ... args)
+	{
+		format_iterator_sink<Out> sink{ out };
+		_ML util::format_sink(sink, fmt, args...);
+		return sink.out;
+	}
+
+	// format into a stream
+	template <class Fmt, class ... Args
+	> std::ostream & format_to(std::ostream & out, Fmt const & fmt, Args const & ... args)
+	{
+		format_stream_sink sink{ out };
+		_ML util::format_sink(sink, fmt, args...);
+		return out;
+	}
+
+	// format into a fixed buffer, returns the full length like snprintf
+	template <class Fmt, class ... Args
+	> size_t format_to_n(char * buf, size_t size, Fmt const & fmt, Args const & ... args)
+	{
+		format_buffer_sink sink{ buf, size ? size - 1 : 0, 0 };
+		_ML util::format_sink(sink, fmt, args...);
+		if (size) { buf[std::min(sink.count, size - 1)] = 0; }
+		return sink.count;
+	}
+
+	// format into a new string, streams go to the one-argument-per-line overload
+	template <class Fmt, class Arg0, class ... Args, std::enable_if_t<!std::is_base_of_v<std::ios_base, Arg0>, int> = 0
+	> ML_NODISCARD string format(Fmt const & fmt, Arg0 const & arg0, Args const & ... args) noexcept
+	{
+		string temp{};
+		_ML util::format_to(std::back_inserter(temp), fmt, arg0, args...);
+		return temp;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+#endif // !_ML_FORMAT_HPP_
\ No newline at end of file
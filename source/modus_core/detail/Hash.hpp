@@ -3,6 +3,10 @@
 
 #include <modus_core/Standard.hpp>
 
+#if defined(ML_cc_msvc) && defined(ML_x64)
+#include <intrin.h>
+#endif
+
 namespace ml
 {
 	struct FNV1A final
@@ -20,9 +24,11 @@ namespace ml
 		template <class T
 		> ML_NODISCARD constexpr hash_t operator()(T const * arr, hash_t size, hash_t seed) const noexcept
 		{
-			return size
-				? FNV1A{}(arr + 1, size - 1, (seed ^ static_cast<hash_t>(*arr)) * prime)
-				: seed;
+			for (hash_t i = 0; i < size; ++i)
+			{
+				seed = (seed ^ static_cast<hash_t>(arr[i])) * prime;
+			}
+			return seed;
 		}
 
 		template <class T
@@ -80,9 +86,7 @@ namespace ml
 	template <class T
 	> ML_NODISCARD constexpr hash_t fnv1a_hash(T const * arr, hash_t size, hash_t seed) noexcept
 	{
-		return size
-			? fnv1a_hash(arr + 1, size - 1, (seed ^ static_cast<hash_t>(*arr)) * fnv1a_prime)
-			: seed;
+		return FNV1A{}(arr, size, seed);
 	}
 
 	template <class T
@@ -120,6 +124,131 @@ namespace ml
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 }
 
+// fast hash
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// word at a time runtime hash (wyhash), for keys that never meet a compile time hashof
+	struct fast_hash final
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		constexpr fast_hash() noexcept = default;
+
+		static constexpr uint64 secret[4]
+		{
+			0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL
+		};
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD hash_t operator()(void const * data, size_t size, uint64 seed = 0) const noexcept
+		{
+			byte const * p{ static_cast<byte const *>(data) };
+			seed ^= mix(seed ^ secret[0], secret[1]);
+			uint64 a, b;
+			if (size <= 16)
+			{
+				if (size >= 4)
+				{
+					a = (read4(p) << 32) | read4(p + ((size >> 3) << 2));
+					b = (read4(p + size - 4) << 32) | read4(p + size - 4 - ((size >> 3) << 2));
+				}
+				else if (size > 0)
+				{
+					a = ((uint64)p[0] << 16) | ((uint64)p[size >> 1] << 8) | p[size - 1];
+					b = 0;
+				}
+				else
+				{
+					a = b = 0;
+				}
+			}
+			else
+			{
+				size_t i{ size };
+				if (i > 48)
+				{
+					// three independent lanes
+					uint64 see1{ seed }, see2{ seed };
+					do
+					{
+						seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+						see1 = mix(read8(p + 16) ^ secret[2], read8(p + 24) ^ see1);
+						see2 = mix(read8(p + 32) ^ secret[3], read8(p + 40) ^ see2);
+						p += 48; i -= 48;
+					}
+					while (i > 48);
+					seed ^= see1 ^ see2;
+				}
+				while (i > 16)
+				{
+					seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+					p += 16; i -= 16;
+				}
+				a = read8(p + i - 16);
+				b = read8(p + i - 8);
+			}
+			a ^= secret[1];
+			b ^= seed;
+			multiply(a, b);
+			return mix(a ^ secret[0] ^ size, b ^ secret[1]);
+		}
+
+		ML_NODISCARD hash_t operator()(cstring value) const noexcept
+		{
+			return (*this)(value, std::strlen(value));
+		}
+
+		template <class Str, class = decltype(std::declval<Str const &>().data())
+		> ML_NODISCARD hash_t operator()(Str const & value) const noexcept
+		{
+			return (*this)(value.data(), value.size() * sizeof(*value.data()));
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		ML_NODISCARD static uint64 read8(byte const * p) noexcept
+		{
+			uint64 v; std::memcpy(&v, p, sizeof(v)); return v;
+		}
+
+		ML_NODISCARD static uint64 read4(byte const * p) noexcept
+		{
+			uint32 v; std::memcpy(&v, p, sizeof(v)); return v;
+		}
+
+		// full 128 bit product, low half in a and high half in b
+		static void multiply(uint64 & a, uint64 & b) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			__uint128_t const r{ (__uint128_t)a * b };
+			a = (uint64)r; b = (uint64)(r >> 64);
+#elif defined(ML_cc_msvc) && defined(ML_x64)
+			a = _umul128(a, b, &b);
+#else
+			uint64 const ha{ a >> 32 }, hb{ b >> 32 }, la{ (uint32)a }, lb{ (uint32)b };
+			uint64 const rh{ ha * hb }, rm0{ ha * lb }, rm1{ hb * la }, rl{ la * lb };
+			uint64 const t{ rl + (rm0 << 32) }, lo{ t + (rm1 << 32) };
+			uint64 const hi{ rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t) };
+			a = lo; b = hi;
+#endif
+		}
+
+		ML_NODISCARD static uint64 mix(uint64 a, uint64 b) noexcept
+		{
+			multiply(a, b);
+			return a ^ b;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
 namespace ml
 {
 	// hash of data
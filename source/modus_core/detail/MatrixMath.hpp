@@ -0,0 +1,555 @@
+#ifndef _ML_MATRIX_MATH_HPP_
+#define _ML_MATRIX_MATH_HPP_
+
+// matrix products, inverse and transpose for column major matrices
+// the templates evaluate at compile time, float32 calls at runtime go through simd kernels
+
+#include <modus_core/detail/Matrix.hpp>
+
+#if ML_has_sse2
+#include <immintrin.h>
+#ifdef ML_cc_msvc
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// SCALAR
+namespace ml::impl
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// out = m * v
+	template <class T
+	> constexpr void mat4_transform(T const * m, T const * v, T * out) noexcept
+	{
+		T const x{ v[0] }, y{ v[1] }, z{ v[2] }, w{ v[3] };
+		for (size_t r = 0; r < 4; ++r)
+		{
+			out[r] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+		}
+	}
+
+	// out = lhs * rhs
+	template <class T
+	> constexpr tmat4<T> mat4_multiply(tmat4<T> const & lhs, tmat4<T> const & rhs) noexcept
+	{
+		tmat4<T> temp{};
+		for (size_t c = 0; c < 4; ++c)
+		{
+			impl::mat4_transform(lhs.data(), rhs.data() + c * 4, temp.data() + c * 4);
+		}
+		return temp;
+	}
+
+	// false if the matrix is singular
+	template <class T
+	> constexpr bool mat4_inverse(tmat4<T> const & value, tmat4<T> & out) noexcept
+	{
+		static_assert(std::is_floating_point_v<T>, "inverse requires a floating point matrix");
+
+		T const * const m{ value.data() };
+		tmat4<T> inv{};
+		inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+		inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+		inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+		inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+		inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+		inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+		inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+		inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+		inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+		inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+		inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+		inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+		inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+		inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+		inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+		inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+		T const det{ m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12] };
+		if (det == T{}) { return false; }
+		for (size_t i = 0; i < 16; ++i)
+		{
+			out[i] = inv[i] / det;
+		}
+		return true;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	inline void scalar_multiply(mat4 const & lhs, mat4 const & rhs, mat4 & out) noexcept
+	{
+		out = impl::mat4_multiply(lhs, rhs);
+	}
+
+	inline void scalar_multiply_batch(mat4 const * const * lhs, mat4 const * const * rhs, size_t count, mat4 * const * out) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			*out[i] = impl::mat4_multiply(*lhs[i], *rhs[i]);
+		}
+	}
+
+	inline void scalar_transform(mat4 const & m, vec4 const * first, size_t count, vec4 * out) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			impl::mat4_transform(m.data(), first[i].data(), out[i].data());
+		}
+	}
+
+	inline void scalar_transform_points(mat4 const & m, vec3 const * first, size_t count, vec3 * out) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			float32 const x{ first[i][0] }, y{ first[i][1] }, z{ first[i][2] };
+			for (size_t r = 0; r < 3; ++r)
+			{
+				out[i][r] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r];
+			}
+		}
+	}
+
+	inline void scalar_transpose(mat4 const & m, mat4 & out) noexcept
+	{
+		mat4 const temp{ m };
+		for (size_t c = 0; c < 4; ++c)
+		{
+			for (size_t r = 0; r < 4; ++r)
+			{
+				out[r * 4 + c] = temp[c * 4 + r];
+			}
+		}
+	}
+
+	inline bool scalar_inverse(mat4 const & m, mat4 & out) noexcept
+	{
+		return impl::mat4_inverse(m, out);
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// SSE2 / AVX
+#if ML_has_sse2
+namespace ml::impl
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// sum of the columns scaled by the lanes of v
+	ML_INLINE __m128 sse_transform(__m128 const c0, __m128 const c1, __m128 const c2, __m128 const c3, __m128 const v) noexcept
+	{
+		__m128 const a{ _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v, v, 0x00)), _mm_mul_ps(c1, _mm_shuffle_ps(v, v, 0x55))) };
+		__m128 const b{ _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v, v, 0xAA)), _mm_mul_ps(c3, _mm_shuffle_ps(v, v, 0xFF))) };
+		return _mm_add_ps(a, b);
+	}
+
+	// 2x2 products on matrices packed as (m00, m01, m10, m11)
+	ML_INLINE __m128 sse_mat2_mul(__m128 const a, __m128 const b) noexcept
+	{
+		return _mm_add_ps(
+			_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+			_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+	// adj(a) * b
+	ML_INLINE __m128 sse_mat2_adj_mul(__m128 const a, __m128 const b) noexcept
+	{
+		return _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+			_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+
+	// a * adj(b)
+	ML_INLINE __m128 sse_mat2_mul_adj(__m128 const a, __m128 const b) noexcept
+	{
+		return _mm_sub_ps(
+			_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+			_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	inline void sse2_multiply(mat4 const & lhs, mat4 const & rhs, mat4 & out) noexcept
+	{
+		__m128 const c0{ _mm_loadu_ps(lhs.data()) }, c1{ _mm_loadu_ps(lhs.data() + 4) };
+		__m128 const c2{ _mm_loadu_ps(lhs.data() + 8) }, c3{ _mm_loadu_ps(lhs.data() + 12) };
+		for (size_t c = 0; c < 16; c += 4)
+		{
+			_mm_storeu_ps(out.data() + c, impl::sse_transform(c0, c1, c2, c3, _mm_loadu_ps(rhs.data() + c)));
+		}
+	}
+
+	inline void sse2_multiply_batch(mat4 const * const * lhs, mat4 const * const * rhs, size_t count, mat4 * const * out) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			impl::sse2_multiply(*lhs[i], *rhs[i], *out[i]);
+		}
+	}
+
+	inline void sse2_transform(mat4 const & m, vec4 const * first, size_t count, vec4 * out) noexcept
+	{
+		__m128 const c0{ _mm_loadu_ps(m.data()) }, c1{ _mm_loadu_ps(m.data() + 4) };
+		__m128 const c2{ _mm_loadu_ps(m.data() + 8) }, c3{ _mm_loadu_ps(m.data() + 12) };
+		for (size_t i = 0; i < count; ++i)
+		{
+			_mm_storeu_ps(out[i].data(), impl::sse_transform(c0, c1, c2, c3, _mm_loadu_ps(first[i].data())));
+		}
+	}
+
+	inline void sse2_transform_points(mat4 const & m, vec3 const * first, size_t count, vec3 * out) noexcept
+	{
+		__m128 const c0{ _mm_loadu_ps(m.data()) }, c1{ _mm_loadu_ps(m.data() + 4) };
+		__m128 const c2{ _mm_loadu_ps(m.data() + 8) }, c3{ _mm_loadu_ps(m.data() + 12) };
+		for (size_t i = 0; i < count; ++i)
+		{
+			float32 const * const p{ first[i].data() };
+			__m128 const r{ _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(p[0])), _mm_mul_ps(c1, _mm_set1_ps(p[1]))),
+				_mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(p[2])), c3)) };
+
+			// three lanes only, a full store would clobber the next point
+			_mm_storel_pi(reinterpret_cast<__m64 *>(out[i].data()), r);
+			_mm_store_ss(out[i].data() + 2, _mm_movehl_ps(r, r));
+		}
+	}
+
+	inline void sse2_transpose(mat4 const & m, mat4 & out) noexcept
+	{
+		__m128 c0{ _mm_loadu_ps(m.data()) }, c1{ _mm_loadu_ps(m.data() + 4) };
+		__m128 c2{ _mm_loadu_ps(m.data() + 8) }, c3{ _mm_loadu_ps(m.data() + 12) };
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		_mm_storeu_ps(out.data(), c0);
+		_mm_storeu_ps(out.data() + 4, c1);
+		_mm_storeu_ps(out.data() + 8, c2);
+		_mm_storeu_ps(out.data() + 12, c3);
+	}
+
+	// block inverse over four 2x2 sub matrices
+	inline bool sse2_inverse(mat4 const & m, mat4 & out) noexcept
+	{
+		__m128 const c0{ _mm_loadu_ps(m.data()) }, c1{ _mm_loadu_ps(m.data() + 4) };
+		__m128 const c2{ _mm_loadu_ps(m.data() + 8) }, c3{ _mm_loadu_ps(m.data() + 12) };
+
+		__m128 const a{ _mm_movelh_ps(c0, c1) }, b{ _mm_movehl_ps(c1, c0) };
+		__m128 const c{ _mm_movelh_ps(c2, c3) }, d{ _mm_movehl_ps(c3, c2) };
+
+		// (|a|, |b|, |c|, |d|)
+		__m128 const det_sub{ _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 1, 3, 1))),
+			_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 0, 2, 0)))) };
+		__m128 const det_a{ _mm_shuffle_ps(det_sub, det_sub, 0x00) };
+		__m128 const det_b{ _mm_shuffle_ps(det_sub, det_sub, 0x55) };
+		__m128 const det_c{ _mm_shuffle_ps(det_sub, det_sub, 0xAA) };
+		__m128 const det_d{ _mm_shuffle_ps(det_sub, det_sub, 0xFF) };
+
+		__m128 const d_c{ impl::sse_mat2_adj_mul(d, c) };
+		__m128 const a_b{ impl::sse_mat2_adj_mul(a, b) };
+		__m128 x_{ _mm_sub_ps(_mm_mul_ps(det_d, a), impl::sse_mat2_mul(b, d_c)) };
+		__m128 w_{ _mm_sub_ps(_mm_mul_ps(det_a, d), impl::sse_mat2_mul(c, a_b)) };
+		__m128 y_{ _mm_sub_ps(_mm_mul_ps(det_b, c), impl::sse_mat2_mul_adj(d, a_b)) };
+		__m128 z_{ _mm_sub_ps(_mm_mul_ps(det_c, b), impl::sse_mat2_mul_adj(a, d_c)) };
+
+		// |m| = |a||d| + |b||c| - tr(adj(a) b adj(d) c)
+		__m128 tr{ _mm_mul_ps(a_b, _mm_shuffle_ps(d_c, d_c, _MM_SHUFFLE(3, 1, 2, 0))) };
+		tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(2, 3, 0, 1)));
+		tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(1, 0, 3, 2)));
+		__m128 const det{ _mm_sub_ps(_mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c)), tr) };
+		if (_mm_cvtss_f32(det) == 0.f) { return false; }
+
+		__m128 const rcp{ _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), det) };
+		x_ = _mm_mul_ps(x_, rcp);
+		y_ = _mm_mul_ps(y_, rcp);
+		z_ = _mm_mul_ps(z_, rcp);
+		w_ = _mm_mul_ps(w_, rcp);
+
+		// adjugate of each block and interleave back into columns
+		_mm_storeu_ps(out.data(), _mm_shuffle_ps(x_, y_, _MM_SHUFFLE(1, 3, 1, 3)));
+		_mm_storeu_ps(out.data() + 4, _mm_shuffle_ps(x_, y_, _MM_SHUFFLE(0, 2, 0, 2)));
+		_mm_storeu_ps(out.data() + 8, _mm_shuffle_ps(z_, w_, _MM_SHUFFLE(1, 3, 1, 3)));
+		_mm_storeu_ps(out.data() + 12, _mm_shuffle_ps(z_, w_, _MM_SHUFFLE(0, 2, 0, 2)));
+		return true;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// two vectors per register
+	ML_TARGET_AVX inline void avx_transform(mat4 const & m, vec4 const * first, size_t count, vec4 * out) noexcept
+	{
+		__m128 const c0{ _mm_loadu_ps(m.data()) }, c1{ _mm_loadu_ps(m.data() + 4) };
+		__m128 const c2{ _mm_loadu_ps(m.data() + 8) }, c3{ _mm_loadu_ps(m.data() + 12) };
+		__m256 const w0{ _mm256_insertf128_ps(_mm256_castps128_ps256(c0), c0, 1) };
+		__m256 const w1{ _mm256_insertf128_ps(_mm256_castps128_ps256(c1), c1, 1) };
+		__m256 const w2{ _mm256_insertf128_ps(_mm256_castps128_ps256(c2), c2, 1) };
+		__m256 const w3{ _mm256_insertf128_ps(_mm256_castps128_ps256(c3), c3, 1) };
+
+		size_t i{};
+		for (; i + 2 <= count; i += 2)
+		{
+			__m256 const v{ _mm256_loadu_ps(first[i].data()) };
+			__m256 const a{ _mm256_add_ps(_mm256_mul_ps(w0, _mm256_permute_ps(v, 0x00)), _mm256_mul_ps(w1, _mm256_permute_ps(v, 0x55))) };
+			__m256 const b{ _mm256_add_ps(_mm256_mul_ps(w2, _mm256_permute_ps(v, 0xAA)), _mm256_mul_ps(w3, _mm256_permute_ps(v, 0xFF))) };
+			_mm256_storeu_ps(out[i].data(), _mm256_add_ps(a, b));
+		}
+		if (i < count)
+		{
+			_mm_storeu_ps(out[i].data(), impl::sse_transform(c0, c1, c2, c3, _mm_loadu_ps(first[i].data())));
+		}
+	}
+
+	// the columns of rhs are four vectors
+	ML_TARGET_AVX inline void avx_multiply(mat4 const & lhs, mat4 const & rhs, mat4 & out) noexcept
+	{
+		impl::avx_transform(lhs, reinterpret_cast<vec4 const *>(rhs.data()), 4, reinterpret_cast<vec4 *>(out.data()));
+	}
+
+	ML_TARGET_AVX inline void avx_multiply_batch(mat4 const * const * lhs, mat4 const * const * rhs, size_t count, mat4 * const * out) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			impl::avx_multiply(*lhs[i], *rhs[i], *out[i]);
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// cpu and os both support avx
+	ML_NODISCARD inline bool cpu_has_avx() noexcept
+	{
+		uint32 info[4]{};
+#ifdef ML_cc_msvc
+		__cpuid(reinterpret_cast<int *>(info), 1);
+#else
+		if (!__get_cpuid(1, &info[0], &info[1], &info[2], &info[3])) { return false; }
+#endif
+		if (!(info[2] & (1u << 27)) || !(info[2] & (1u << 28))) { return false; } // osxsave, avx
+
+		// the os has to save the upper halves of the registers
+#ifdef ML_cc_msvc
+		uint64 const xcr0{ _xgetbv(0) };
+#else
+		uint32 lo{}, hi{};
+		__asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+		uint64 const xcr0{ ((uint64)hi << 32) | lo };
+#endif
+		return (xcr0 & 6) == 6;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+#endif // ML_has_sse2
+
+// KERNELS
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	enum simd_level_ : int32
+	{
+		simd_level_scalar,
+		simd_level_sse2,
+		simd_level_avx,
+		simd_level_MAX
+	};
+
+	// float32 mat4 kernels for one instruction set
+	struct mat4_kernels final
+	{
+		cstring name;
+		void (*multiply)(mat4 const & lhs, mat4 const & rhs, mat4 & out) noexcept;
+		void (*multiply_batch)(mat4 const * const * lhs, mat4 const * const * rhs, size_t count, mat4 * const * out) noexcept;
+		void (*transform)(mat4 const & m, vec4 const * first, size_t count, vec4 * out) noexcept;
+		void (*transform_points)(mat4 const & m, vec3 const * first, size_t count, vec3 * out) noexcept;
+		void (*transpose)(mat4 const & m, mat4 & out) noexcept;
+		bool (*inverse)(mat4 const & m, mat4 & out) noexcept;
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+namespace ml::util
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// best instruction set on this machine, checked once
+	ML_NODISCARD inline int32 get_simd_level() noexcept
+	{
+#if ML_has_sse2
+		static int32 const level{ impl::cpu_has_avx() ? simd_level_avx : simd_level_sse2 };
+		return level;
+#else
+		return simd_level_scalar;
+#endif
+	}
+
+	// kernels for an instruction set, clamped to what this machine supports
+	ML_NODISCARD inline mat4_kernels const & get_mat4_kernels(int32 level = util::get_simd_level()) noexcept
+	{
+		static mat4_kernels const table[simd_level_MAX]
+		{
+			{ "scalar", &impl::scalar_multiply, &impl::scalar_multiply_batch, &impl::scalar_transform, &impl::scalar_transform_points, &impl::scalar_transpose, &impl::scalar_inverse },
+#if ML_has_sse2
+			{ "sse2", &impl::sse2_multiply, &impl::sse2_multiply_batch, &impl::sse2_transform, &impl::sse2_transform_points, &impl::sse2_transpose, &impl::sse2_inverse },
+			{ "avx", &impl::avx_multiply, &impl::avx_multiply_batch, &impl::avx_transform, &impl::sse2_transform_points, &impl::sse2_transpose, &impl::sse2_inverse },
+#endif
+		};
+		return table[ML_max(0, ML_min(level, util::get_simd_level()))];
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// FUNCTIONS
+namespace ml::util
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// lhs * rhs
+	template <class T
+	> ML_NODISCARD constexpr tmat4<T> multiply(tmat4<T> const & lhs, tmat4<T> const & rhs) noexcept
+	{
+#if ML_has_sse2
+		if constexpr (std::is_same_v<T, float32>)
+		{
+			if (!ML_is_constant_evaluated())
+			{
+				tmat4<T> temp{};
+				impl::sse2_multiply(lhs, rhs, temp);
+				return temp;
+			}
+		}
+#endif
+		return impl::mat4_multiply(lhs, rhs);
+	}
+
+	// m * v
+	template <class T
+	> ML_NODISCARD constexpr tvec4<T> transform(tmat4<T> const & m, tvec4<T> const & v) noexcept
+	{
+#if ML_has_sse2
+		if constexpr (std::is_same_v<T, float32>)
+		{
+			if (!ML_is_constant_evaluated())
+			{
+				tvec4<T> temp{};
+				impl::sse2_transform(m, &v, 1, &temp);
+				return temp;
+			}
+		}
+#endif
+		tvec4<T> temp{};
+		impl::mat4_transform(m.data(), v.data(), temp.data());
+		return temp;
+	}
+
+	// m * (p, 1) without the divide
+	template <class T
+	> ML_NODISCARD constexpr tvec3<T> transform_point(tmat4<T> const & m, tvec3<T> const & p) noexcept
+	{
+		tvec4<T> const temp{ util::transform(m, tvec4<T>{ p[0], p[1], p[2], T{ 1 } }) };
+		return { temp[0], temp[1], temp[2] };
+	}
+
+	// rows become columns
+	template <class T, size_t W, size_t H
+	> ML_NODISCARD constexpr matrix<T, H, W> transpose(matrix<T, W, H> const & value) noexcept
+	{
+#if ML_has_sse2
+		if constexpr (std::is_same_v<T, float32> && W == 4 && H == 4)
+		{
+			if (!ML_is_constant_evaluated())
+			{
+				matrix<T, H, W> temp{};
+				impl::sse2_transpose(value, temp);
+				return temp;
+			}
+		}
+#endif
+		matrix<T, H, W> temp{};
+		for (size_t y = 0; y < H; ++y)
+		{
+			for (size_t x = 0; x < W; ++x)
+			{
+				temp.at(y, x) = value.at(x, y);
+			}
+		}
+		return temp;
+	}
+
+	// zero if the matrix is singular
+	template <class T
+	> ML_NODISCARD constexpr tmat4<T> inverse(tmat4<T> const & value) noexcept
+	{
+		tmat4<T> temp{};
+#if ML_has_sse2
+		if constexpr (std::is_same_v<T, float32>)
+		{
+			if (!ML_is_constant_evaluated())
+			{
+				impl::sse2_inverse(value, temp);
+				return temp;
+			}
+		}
+#endif
+		impl::mat4_inverse(value, temp);
+		return temp;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// *out[i] = *lhs[i] * *rhs[i], outputs must not alias the inputs
+	inline void multiply(mat4 const * const * lhs, mat4 const * const * rhs, size_t count, mat4 * const * out) noexcept
+	{
+		util::get_mat4_kernels().multiply_batch(lhs, rhs, count, out);
+	}
+
+	// out[i] = m * first[i]
+	inline void transform(mat4 const & m, vec4 const * first, size_t count, vec4 * out) noexcept
+	{
+		util::get_mat4_kernels().transform(m, first, count, out);
+	}
+
+	// out[i] = m * (first[i], 1) without the divide
+	inline void transform_points(mat4 const & m, vec3 const * first, size_t count, vec3 * out) noexcept
+	{
+		util::get_mat4_kernels().transform_points(m, first, count, out);
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// quaternion (x, y, z, w) from euler angles in radians
+	template <class T
+	> ML_NODISCARD tvec4<T> quaternion(tvec3<T> const & euler) noexcept
+	{
+		T const cx{ std::cos(euler[0] * T{ 0.5 }) }, sx{ std::sin(euler[0] * T{ 0.5 }) };
+		T const cy{ std::cos(euler[1] * T{ 0.5 }) }, sy{ std::sin(euler[1] * T{ 0.5 }) };
+		T const cz{ std::cos(euler[2] * T{ 0.5 }) }, sz{ std::sin(euler[2] * T{ 0.5 }) };
+		return {
+			sx * cy * cz - cx * sy * sz,
+			cx * sy * cz + sx * cy * sz,
+			cx * cy * sz - sx * sy * cz,
+			cx * cy * cz + sx * sy * sz };
+	}
+
+	// translate * rotate * scale, rotation is a unit quaternion (x, y, z, w)
+	template <class T
+	> ML_NODISCARD constexpr tmat4<T> compose(tvec3<T> const & position, tvec4<T> const & rotation, tvec3<T> const & scale) noexcept
+	{
+		T const x{ rotation[0] }, y{ rotation[1] }, z{ rotation[2] }, w{ rotation[3] };
+		T const xx{ x * x }, yy{ y * y }, zz{ z * z };
+		T const xy{ x * y }, xz{ x * z }, yz{ y * z };
+		T const wx{ w * x }, wy{ w * y }, wz{ w * z };
+		return { {
+			(T{ 1 } - T{ 2 } * (yy + zz)) * scale[0], T{ 2 } * (xy + wz) * scale[0], T{ 2 } * (xz - wy) * scale[0], T{},
+			T{ 2 } * (xy - wz) * scale[1], (T{ 1 } - T{ 2 } * (xx + zz)) * scale[1], T{ 2 } * (yz + wx) * scale[1], T{},
+			T{ 2 } * (xz + wy) * scale[2], T{ 2 } * (yz - wx) * scale[2], (T{ 1 } - T{ 2 } * (xx + yy)) * scale[2], T{},
+			position[0], position[1], position[2], T{ 1 } } };
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+#endif // !_ML_MATRIX_MATH_HPP_
\ No newline at end of file
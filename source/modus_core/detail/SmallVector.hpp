@@ -0,0 +1,406 @@
+#ifndef _ML_SMALL_VECTOR_HPP_
+#define _ML_SMALL_VECTOR_HPP_
+
+#include <modus_core/detail/Utility.hpp>
+
+namespace ml::ds
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// BASIC SMALL VECTOR
+	// contiguous list which keeps its first elements inline and only goes
+	// to the allocator once it grows past them
+	template <
+		class	_Ty,	// value type
+		size_t	_Size	// inline capacity
+	> struct basic_small_vector
+	{
+		static_assert(0 < _Size, "small_vector requires an inline capacity");
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		using self_type					= typename basic_small_vector<_Ty, _Size>;
+		using value_type				= typename _Ty;
+		using allocator_type			= typename pmr::polymorphic_allocator<byte>;
+		using difference_type			= typename ptrdiff_t;
+		using size_type					= typename size_t;
+		using pointer					= typename value_type *;
+		using const_pointer				= typename value_type const *;
+		using reference					= typename value_type &;
+		using const_reference			= typename value_type const &;
+		using iterator					= typename pointer;
+		using const_iterator			= typename const_pointer;
+		using reverse_iterator			= typename std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= typename std::reverse_iterator<const_iterator>;
+		using init_type					= typename std::initializer_list<value_type>;
+
+		static constexpr size_type inline_capacity{ _Size };
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		basic_small_vector(allocator_type alloc = {}) noexcept
+			: m_alloc	{ alloc }
+			, m_data	{ inline_data() }
+			, m_size	{}
+			, m_capacity{ _Size }
+		{
+		}
+
+		basic_small_vector(size_type count, const_reference value, allocator_type alloc = {})
+			: self_type{ alloc }
+		{
+			this->resize(count, value);
+		}
+
+		basic_small_vector(init_type value, allocator_type alloc = {})
+			: self_type{ alloc }
+		{
+			this->assign(value.begin(), value.end());
+		}
+
+		template <class It, class = std::enable_if_t<!std::is_integral_v<It>>
+		> basic_small_vector(It first, It last, allocator_type alloc = {})
+			: self_type{ alloc }
+		{
+			this->assign(first, last);
+		}
+
+		basic_small_vector(self_type const & value, allocator_type alloc = {})
+			: self_type{ alloc }
+		{
+			this->assign(value.begin(), value.end());
+		}
+
+		basic_small_vector(self_type && value, allocator_type alloc = {}) noexcept
+			: self_type{ alloc }
+		{
+			this->move_from(std::move(value));
+		}
+
+		~basic_small_vector() noexcept
+		{
+			this->clear();
+			this->release();
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		self_type & operator=(init_type value)
+		{
+			this->assign(value.begin(), value.end());
+			return (*this);
+		}
+
+		self_type & operator=(self_type const & value)
+		{
+			if (this != std::addressof(value))
+			{
+				this->assign(value.begin(), value.end());
+			}
+			return (*this);
+		}
+
+		self_type & operator=(self_type && value) noexcept
+		{
+			if (this != std::addressof(value))
+			{
+				this->clear();
+				this->move_from(std::move(value));
+			}
+			return (*this);
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <class It
+		> void assign(It first, It last)
+		{
+			this->clear();
+			if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>)
+			{
+				this->reserve((size_type)std::distance(first, last));
+			}
+			for (; first != last; ++first)
+			{
+				this->emplace_back(*first);
+			}
+		}
+
+		void clear() noexcept
+		{
+			std::destroy(begin(), end());
+			m_size = 0;
+		}
+
+		void reserve(size_type count)
+		{
+			if (count > m_capacity) { this->reallocate(count); }
+		}
+
+		void resize(size_type count)
+		{
+			this->reserve(count);
+			while (m_size > count) { this->pop_back(); }
+			while (m_size < count) { this->emplace_back(); }
+		}
+
+		void resize(size_type count, const_reference value)
+		{
+			this->reserve(count);
+			while (m_size > count) { this->pop_back(); }
+			while (m_size < count) { this->emplace_back(value); }
+		}
+
+		void shrink_to_fit()
+		{
+			if (!is_inline() && m_size < m_capacity) { this->reallocate(m_size); }
+		}
+
+		void swap(self_type & value) noexcept
+		{
+			if (this != std::addressof(value))
+			{
+				self_type temp(std::move(value), m_alloc);
+				value = std::move(*this);
+				(*this) = std::move(temp);
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <class ... Args
+		> auto emplace_back(Args && ... args) -> reference
+		{
+			if (m_size < m_capacity)
+			{
+				return *::new (m_data + m_size++) value_type(ML_forward(args)...);
+			}
+
+			// construct before moving, args may refer to an element
+			size_type const count{ grow_capacity(m_size + 1) };
+			pointer const data{ allocate(count) };
+			::new (data + m_size) value_type(ML_forward(args)...);
+			this->adopt(data, count);
+			return m_data[m_size++];
+		}
+
+		auto push_back(const_reference value) -> reference { return this->emplace_back(value); }
+
+		auto push_back(value_type && value) -> reference { return this->emplace_back(std::move(value)); }
+
+		void pop_back() noexcept
+		{
+			ML_assert(m_size);
+			std::destroy_at(m_data + --m_size);
+		}
+
+		template <class ... Args
+		> auto emplace(const_iterator where, Args && ... args) -> iterator
+		{
+			size_type const i{ (size_type)(where - cbegin()) };
+			this->emplace_back(ML_forward(args)...);
+			std::rotate(begin() + i, end() - 1, end());
+			return begin() + i;
+		}
+
+		auto insert(const_iterator where, const_reference value) -> iterator { return this->emplace(where, value); }
+
+		auto insert(const_iterator where, value_type && value) -> iterator { return this->emplace(where, std::move(value)); }
+
+		auto erase(const_iterator where) -> iterator
+		{
+			return this->erase(where, where + 1);
+		}
+
+		auto erase(const_iterator first, const_iterator last) -> iterator
+		{
+			iterator const dst{ begin() + (first - cbegin()) };
+			if (first != last)
+			{
+				iterator const it{ std::move(begin() + (last - cbegin()), end(), dst) };
+				std::destroy(it, end());
+				m_size = (size_type)(it - begin());
+			}
+			return dst;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD bool empty() const noexcept { return !m_size; }
+
+		ML_NODISCARD bool is_inline() const noexcept { return m_data == inline_data(); }
+
+		ML_NODISCARD auto size() const noexcept -> size_type { return m_size; }
+
+		ML_NODISCARD auto capacity() const noexcept -> size_type { return m_capacity; }
+
+		ML_NODISCARD auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+		ML_NODISCARD auto data() noexcept -> pointer { return m_data; }
+
+		ML_NODISCARD auto data() const noexcept -> const_pointer { return m_data; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD auto operator[](size_type i) noexcept -> reference { return m_data[i]; }
+
+		ML_NODISCARD auto operator[](size_type i) const noexcept -> const_reference { return m_data[i]; }
+
+		ML_NODISCARD auto at(size_type i) noexcept -> reference { ML_assert(i < m_size); return m_data[i]; }
+
+		ML_NODISCARD auto at(size_type i) const noexcept -> const_reference { ML_assert(i < m_size); return m_data[i]; }
+
+		ML_NODISCARD auto front() noexcept -> reference { return m_data[0]; }
+
+		ML_NODISCARD auto front() const noexcept -> const_reference { return m_data[0]; }
+
+		ML_NODISCARD auto back() noexcept -> reference { return m_data[m_size - 1]; }
+
+		ML_NODISCARD auto back() const noexcept -> const_reference { return m_data[m_size - 1]; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD auto begin() noexcept -> iterator { return m_data; }
+
+		ML_NODISCARD auto begin() const noexcept -> const_iterator { return m_data; }
+
+		ML_NODISCARD auto cbegin() const noexcept -> const_iterator { return m_data; }
+
+		ML_NODISCARD auto end() noexcept -> iterator { return m_data + m_size; }
+
+		ML_NODISCARD auto end() const noexcept -> const_iterator { return m_data + m_size; }
+
+		ML_NODISCARD auto cend() const noexcept -> const_iterator { return m_data + m_size; }
+
+		ML_NODISCARD auto rbegin() noexcept -> reverse_iterator { return reverse_iterator{ end() }; }
+
+		ML_NODISCARD auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator{ end() }; }
+
+		ML_NODISCARD auto crbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator{ cend() }; }
+
+		ML_NODISCARD auto rend() noexcept -> reverse_iterator { return reverse_iterator{ begin() }; }
+
+		ML_NODISCARD auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator{ begin() }; }
+
+		ML_NODISCARD auto crend() const noexcept -> const_reverse_iterator { return const_reverse_iterator{ cbegin() }; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD bool operator==(self_type const & value) const noexcept
+		{
+			return std::equal(begin(), end(), value.begin(), value.end());
+		}
+
+		ML_NODISCARD bool operator!=(self_type const & value) const noexcept
+		{
+			return !(*this == value);
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		ML_NODISCARD pointer inline_data() noexcept { return reinterpret_cast<pointer>(m_inline); }
+
+		ML_NODISCARD const_pointer inline_data() const noexcept { return reinterpret_cast<const_pointer>(m_inline); }
+
+		ML_NODISCARD size_type grow_capacity(size_type count) const noexcept
+		{
+			return ML_max(count, m_capacity * 2);
+		}
+
+		ML_NODISCARD pointer allocate(size_type count)
+		{
+			return static_cast<pointer>(m_alloc.resource()->allocate(count * sizeof(value_type), alignof(value_type)));
+		}
+
+		// free the heap buffer and fall back to inline storage, elements must be gone
+		void release() noexcept
+		{
+			if (!is_inline())
+			{
+				m_alloc.resource()->deallocate(m_data, m_capacity * sizeof(value_type), alignof(value_type));
+				m_data = inline_data();
+				m_capacity = _Size;
+			}
+		}
+
+		// move the elements into a new buffer and take ownership of it
+		void adopt(pointer data, size_type count) noexcept
+		{
+			std::uninitialized_move(begin(), end(), data);
+			std::destroy(begin(), end());
+			this->release();
+			m_data = data;
+			m_capacity = count;
+		}
+
+		void reallocate(size_type count)
+		{
+			if (count <= _Size)
+			{
+				if (is_inline()) { return; }
+				pointer const data{ m_data };
+				size_type const size{ m_size }, capacity{ m_capacity };
+				m_data = inline_data();
+				m_capacity = _Size;
+				std::uninitialized_move(data, data + size, m_data);
+				std::destroy(data, data + size);
+				m_alloc.resource()->deallocate(data, capacity * sizeof(value_type), alignof(value_type));
+			}
+			else
+			{
+				this->adopt(allocate(count), count);
+			}
+		}
+
+		// steal the heap buffer when allocators agree, otherwise move element-wise
+		void move_from(self_type && value) noexcept
+		{
+			if (!value.is_inline() && m_alloc == value.m_alloc)
+			{
+				this->release();
+				m_data = std::exchange(value.m_data, value.inline_data());
+				m_size = std::exchange(value.m_size, 0);
+				m_capacity = std::exchange(value.m_capacity, _Size);
+			}
+			else
+			{
+				this->reserve(value.m_size);
+				std::uninitialized_move(value.begin(), value.end(), m_data);
+				m_size = value.m_size;
+				value.clear();
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		allocator_type	m_alloc		; // heap allocator
+		pointer			m_data		; // inline or heap
+		size_type		m_size		; // elements
+		size_type		m_capacity	; // available slots
+
+		alignas(value_type) byte m_inline[_Size * sizeof(value_type)]; // inline storage
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// SMALL VECTOR | list with inline capacity
+	template <
+		class	_Ty,		// value type
+		size_t	_Size = 8	// inline capacity
+	> ML_alias small_vector = ds::basic_small_vector
+	<
+		_Ty, _Size
+	>;
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+#endif // !_ML_SMALL_VECTOR_HPP_
\ No newline at end of file
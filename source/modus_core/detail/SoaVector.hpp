@@ -0,0 +1,457 @@
+#ifndef _ML_SOA_VECTOR_HPP_
+#define _ML_SOA_VECTOR_HPP_
+
+#include <modus_core/detail/Array.hpp>
+
+namespace ml
+{
+	// structure of arrays, every column lives in one aligned block and shares its capacity
+	template <class ... _Ts> struct soa_vector
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		using self_type			= typename _ML soa_vector<_Ts...>;
+		using allocator_type	= typename pmr::polymorphic_allocator<byte>;
+		using value_types		= typename meta::list<_Ts...>;
+		using value_tuple		= typename meta::tuple<value_types>;
+
+		template <size_t I> using value_i = typename meta::nth<I, value_types>;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		static constexpr size_t npos{ static_cast<size_t>(-1) };
+
+		static constexpr size_t tuple_size{ sizeof...(_Ts) };
+
+		static constexpr auto tuple_sequence{ std::make_index_sequence<tuple_size>{} };
+
+		static constexpr size_t alignment{ 64 }; // column alignment, covers avx and cache lines
+
+		static_assert(0 < tuple_size, "soa_vector requires at least one column");
+
+		template <class T> static constexpr size_t index_t{ meta::index_of<T, value_types>::value };
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		soa_vector(allocator_type alloc = {}) noexcept
+			: m_alloc	{ alloc }
+			, m_columns	{}
+			, m_size	{}
+			, m_capacity{}
+		{
+		}
+
+		soa_vector(self_type const & value, allocator_type alloc = {})
+			: self_type{ alloc }
+		{
+			this->assign(value);
+		}
+
+		soa_vector(self_type && value, allocator_type alloc = {}) noexcept
+			: self_type{ alloc }
+		{
+			this->move_from(std::move(value));
+		}
+
+		~soa_vector() noexcept
+		{
+			this->clear();
+			this->release();
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		self_type & operator=(self_type const & value)
+		{
+			this->assign(value);
+			return (*this);
+		}
+
+		self_type & operator=(self_type && value) noexcept
+		{
+			if (this != std::addressof(value))
+			{
+				this->clear();
+				this->move_from(std::move(value));
+			}
+			return (*this);
+		}
+
+		void assign(self_type const & value)
+		{
+			if (this == std::addressof(value)) { return; }
+			this->clear();
+			this->reserve(value.m_size);
+			this->for_columns([&](auto i) noexcept
+			{
+				std::uninitialized_copy(value.begin<i>(), value.end<i>(), this->begin<i>());
+			});
+			m_size = value.m_size;
+		}
+
+		void swap(self_type & value) noexcept
+		{
+			if (this == std::addressof(value)) { return; }
+			if (m_alloc == value.m_alloc)
+			{
+				std::swap(m_columns, value.m_columns);
+				std::swap(m_size, value.m_size);
+				std::swap(m_capacity, value.m_capacity);
+			}
+			else
+			{
+				self_type temp(std::move(value), value.m_alloc);
+				value = std::move(*this);
+				(*this) = std::move(temp);
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD bool empty() const noexcept { return !m_size; }
+
+		ML_NODISCARD auto size() const noexcept -> size_t { return m_size; }
+
+		ML_NODISCARD auto capacity() const noexcept -> size_t { return m_capacity; }
+
+		ML_NODISCARD auto get_allocator() const noexcept -> allocator_type { return m_alloc; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// column spans, contiguous and aligned for vectorized loops
+
+		template <size_t I> ML_NODISCARD auto data() noexcept -> value_i<I> * { return static_cast<value_i<I> *>(m_columns[I]); }
+
+		template <size_t I> ML_NODISCARD auto data() const noexcept -> value_i<I> const * { return static_cast<value_i<I> const *>(m_columns[I]); }
+
+		template <size_t I> ML_NODISCARD auto begin() noexcept -> value_i<I> * { return this->data<I>(); }
+
+		template <size_t I> ML_NODISCARD auto begin() const noexcept -> value_i<I> const * { return this->data<I>(); }
+
+		template <size_t I> ML_NODISCARD auto cbegin() const noexcept -> value_i<I> const * { return this->data<I>(); }
+
+		template <size_t I> ML_NODISCARD auto end() noexcept -> value_i<I> * { return this->data<I>() + m_size; }
+
+		template <size_t I> ML_NODISCARD auto end() const noexcept -> value_i<I> const * { return this->data<I>() + m_size; }
+
+		template <size_t I> ML_NODISCARD auto cend() const noexcept -> value_i<I> const * { return this->data<I>() + m_size; }
+
+		template <class T> ML_NODISCARD auto data() noexcept -> T * { return this->data<index_t<T>>(); }
+
+		template <class T> ML_NODISCARD auto data() const noexcept -> T const * { return this->data<index_t<T>>(); }
+
+		template <class T> ML_NODISCARD auto begin() noexcept -> T * { return this->begin<index_t<T>>(); }
+
+		template <class T> ML_NODISCARD auto begin() const noexcept -> T const * { return this->begin<index_t<T>>(); }
+
+		template <class T> ML_NODISCARD auto end() noexcept -> T * { return this->end<index_t<T>>(); }
+
+		template <class T> ML_NODISCARD auto end() const noexcept -> T const * { return this->end<index_t<T>>(); }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <size_t ... Is
+		> ML_NODISCARD decltype(auto) get(size_t const i) noexcept
+		{
+			if constexpr (1 == sizeof...(Is))
+			{
+				return (this->data<Is...>()[i]);
+			}
+			else
+			{
+				return std::forward_as_tuple(this->data<Is>()[i]...);
+			}
+		}
+
+		template <size_t ... Is
+		> ML_NODISCARD decltype(auto) get(size_t const i) const noexcept
+		{
+			if constexpr (1 == sizeof...(Is))
+			{
+				return (this->data<Is...>()[i]);
+			}
+			else
+			{
+				return std::forward_as_tuple(this->data<Is>()[i]...);
+			}
+		}
+
+		template <class ... Ts
+		> ML_NODISCARD decltype(auto) get(size_t const i) noexcept
+		{
+			return this->get<index_t<Ts>...>(i);
+		}
+
+		template <class ... Ts
+		> ML_NODISCARD decltype(auto) get(size_t const i) const noexcept
+		{
+			return this->get<index_t<Ts>...>(i);
+		}
+
+		ML_NODISCARD decltype(auto) get(size_t const i) noexcept
+		{
+			return this->get_all(i, tuple_sequence);
+		}
+
+		ML_NODISCARD decltype(auto) get(size_t const i) const noexcept
+		{
+			return this->get_all(i, tuple_sequence);
+		}
+
+		template <size_t ... Is> ML_NODISCARD decltype(auto) back() noexcept { return this->get<Is...>(m_size - 1); }
+
+		template <size_t ... Is> ML_NODISCARD decltype(auto) back() const noexcept { return this->get<Is...>(m_size - 1); }
+
+		ML_NODISCARD decltype(auto) back() noexcept { return this->get(m_size - 1); }
+
+		ML_NODISCARD decltype(auto) back() const noexcept { return this->get(m_size - 1); }
+
+		template <size_t ... Is> ML_NODISCARD decltype(auto) front() noexcept { return this->get<Is...>(0); }
+
+		template <size_t ... Is> ML_NODISCARD decltype(auto) front() const noexcept { return this->get<Is...>(0); }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <size_t ... Is, class Fn
+		> void expand(size_t const i, Fn && fn) noexcept
+		{
+			std::invoke(ML_forward(fn), this->data<Is>()[i]...);
+		}
+
+		template <class ... Ts, class Fn
+		> void expand(size_t const i, Fn && fn) noexcept
+		{
+			std::invoke(ML_forward(fn), this->data<index_t<Ts>>()[i]...);
+		}
+
+		template <class Fn
+		> void expand_all(size_t const i, Fn && fn) noexcept
+		{
+			this->expand_all(i, ML_forward(fn), tuple_sequence);
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		template <size_t I, class U = value_i<I>
+		> ML_NODISCARD size_t lookup(U && value) const noexcept
+		{
+			auto const it{ std::find(this->begin<I>(), this->end<I>(), ML_forward(value)) };
+			return (it != this->end<I>()) ? (size_t)(it - this->begin<I>()) : npos;
+		}
+
+		template <class T, class U = T
+		> ML_NODISCARD size_t lookup(U && value) const noexcept
+		{
+			return this->lookup<index_t<T>>(ML_forward(value));
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		void clear() noexcept
+		{
+			this->for_columns([&](auto i) noexcept { std::destroy(this->begin<i>(), this->end<i>()); });
+			m_size = 0;
+		}
+
+		void reserve(size_t const count)
+		{
+			if (count > m_capacity) { this->reallocate(count); }
+		}
+
+		void resize(size_t const count)
+		{
+			this->reserve(count);
+			if (count < m_size)
+			{
+				this->for_columns([&](auto i) noexcept { std::destroy(this->begin<i>() + count, this->end<i>()); });
+			}
+			else
+			{
+				this->for_columns([&](auto i) { std::uninitialized_value_construct(this->end<i>(), this->begin<i>() + count); });
+			}
+			m_size = count;
+		}
+
+		void shrink_to_fit()
+		{
+			if (m_size < m_capacity) { this->reallocate(m_size); }
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// one argument per column, returns references to the new row
+		template <class ... Args
+		> decltype(auto) push_back(Args && ... args)
+		{
+			static_assert(sizeof...(Args) == tuple_size, "push_back requires one value per column");
+			if (m_size == m_capacity)
+			{
+				// arguments may refer to existing rows
+				value_tuple temp{ ML_forward(args)... };
+				this->reallocate(ML_max(m_capacity * 2, (size_t)8));
+				this->construct_row(std::move(temp), tuple_sequence);
+			}
+			else
+			{
+				this->construct_row(std::forward_as_tuple(ML_forward(args)...), tuple_sequence);
+			}
+			return this->back();
+		}
+
+		void pop_back() noexcept
+		{
+			ML_assert(m_size);
+			--m_size;
+			this->for_columns([&](auto i) noexcept { std::destroy_at(this->data<i>() + m_size); });
+		}
+
+		// keeps order, shifts every later row down
+		void erase(size_t const i) noexcept
+		{
+			this->erase(i, i + 1);
+		}
+
+		void erase(size_t const first, size_t const last) noexcept
+		{
+			if (first >= last) { return; }
+			this->for_columns([&](auto i) noexcept
+			{
+				auto const it{ std::move(this->begin<i>() + last, this->end<i>(), this->begin<i>() + first) };
+				std::destroy(it, this->end<i>());
+			});
+			m_size -= (last - first);
+		}
+
+		// O(1), moves the last row into the hole
+		void swap_remove(size_t const i) noexcept
+		{
+			ML_assert(i < m_size);
+			if (i + 1 != m_size)
+			{
+				this->for_columns([&](auto c) noexcept { this->data<c>()[i] = std::move(this->data<c>()[m_size - 1]); });
+			}
+			this->pop_back();
+		}
+
+		void swap(size_t const lhs, size_t const rhs) noexcept
+		{
+			this->for_columns([&](auto c) noexcept { std::swap(this->data<c>()[lhs], this->data<c>()[rhs]); });
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		template <class Fn
+		> void for_columns(Fn && fn)
+		{
+			this->for_columns(ML_forward(fn), tuple_sequence);
+		}
+
+		template <class Fn, size_t ... Is
+		> void for_columns(Fn && fn, std::index_sequence<Is...>)
+		{
+			(std::invoke(fn, std::integral_constant<size_t, Is>{}), ...);
+		}
+
+		template <size_t ... Is
+		> decltype(auto) get_all(size_t const i, std::index_sequence<Is...>) noexcept
+		{
+			return std::forward_as_tuple(this->data<Is>()[i]...);
+		}
+
+		template <size_t ... Is
+		> decltype(auto) get_all(size_t const i, std::index_sequence<Is...>) const noexcept
+		{
+			return std::forward_as_tuple(this->data<Is>()[i]...);
+		}
+
+		template <class Fn, size_t ... Is
+		> void expand_all(size_t const i, Fn && fn, std::index_sequence<Is...>) noexcept
+		{
+			std::invoke(ML_forward(fn), this->data<Is>()[i]...);
+		}
+
+		template <class Tpl, size_t ... Is
+		> void construct_row(Tpl && value, std::index_sequence<Is...>)
+		{
+			((void)::new (this->data<Is>() + m_size) value_i<Is>(std::get<Is>(ML_forward(value))), ...);
+			++m_size;
+		}
+
+		// column offsets within a block of the given capacity, returns the block size
+		ML_NODISCARD static size_t layout(size_t const count, size_t (&offsets)[tuple_size]) noexcept
+		{
+			size_t const sizes[]{ sizeof(_Ts)... };
+			size_t total{};
+			for (size_t i = 0; i < tuple_size; ++i)
+			{
+				offsets[i] = total;
+				total += (sizes[i] * count + alignment - 1) & ~(alignment - 1);
+			}
+			return total;
+		}
+
+		void reallocate(size_t const count)
+		{
+			array<void *, tuple_size> columns{};
+			if (count)
+			{
+				size_t offsets[tuple_size]{};
+				byte * const block{ static_cast<byte *>(m_alloc.resource()->allocate(layout(count, offsets), alignment)) };
+				for (size_t i = 0; i < tuple_size; ++i) { columns[i] = block + offsets[i]; }
+				this->for_columns([&](auto i) noexcept
+				{
+					std::uninitialized_move(this->begin<i>(), this->end<i>(), static_cast<value_i<i> *>(columns[i]));
+					std::destroy(this->begin<i>(), this->end<i>());
+				});
+			}
+			this->release();
+			m_columns = columns;
+			m_capacity = count;
+		}
+
+		void release() noexcept
+		{
+			if (m_capacity)
+			{
+				size_t offsets[tuple_size]{};
+				m_alloc.resource()->deallocate(m_columns[0], layout(m_capacity, offsets), alignment);
+				m_columns = {};
+				m_capacity = 0;
+			}
+		}
+
+		// steal the block when allocators agree, otherwise move row by row
+		void move_from(self_type && value) noexcept
+		{
+			if (m_alloc == value.m_alloc)
+			{
+				this->release();
+				m_columns = std::exchange(value.m_columns, {});
+				m_size = std::exchange(value.m_size, 0);
+				m_capacity = std::exchange(value.m_capacity, 0);
+			}
+			else
+			{
+				this->reserve(value.m_size);
+				this->for_columns([&](auto i) noexcept
+				{
+					std::uninitialized_move(value.begin<i>(), value.end<i>(), this->begin<i>());
+				});
+				m_size = value.m_size;
+				value.clear();
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		allocator_type				m_alloc		; // block allocator
+		array<void *, tuple_size>	m_columns	; // column pointers, the first owns the block
+		size_t						m_size		; // rows
+		size_t						m_capacity	; // rows per column
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+#endif // !_ML_SOA_VECTOR_HPP_
\ No newline at end of file
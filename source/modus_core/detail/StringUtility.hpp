@@ -1,7 +1,8 @@
 #ifndef _ML_STRING_UTILITY_HPP_
 #define _ML_STRING_UTILITY_HPP_
 
-#include <modus_core/detail/String.hpp>
+#include <modus_core/detail/Format.hpp>
+#include <modus_core/detail/SmallVector.hpp>
 
 namespace ml::util
 {
@@ -138,14 +139,33 @@ namespace ml::util
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	ML_NODISCARD inline list<string> tokenize(string value, string const & delim) noexcept
+	// calls fn for each run between delimiters, empty tokens are skipped
+	template <class Fn
+	> void for_each_token(std::string_view value, std::string_view delim, Fn && fn)
 	{
-		list<string> temp{};
-		auto tok{ std::strtok(value.data(), delim.c_str()) };
-		while (tok) {
-			temp.push_back(tok);
-			tok = std::strtok(nullptr, delim.c_str());
+		size_t first{ value.find_first_not_of(delim) };
+		while (first != std::string_view::npos)
+		{
+			size_t const last{ value.find_first_of(delim, first) };
+			std::invoke(fn, value.substr(first, last - first));
+			if (last == std::string_view::npos) { break; }
+			first = value.find_first_not_of(delim, last);
 		}
+	}
+
+	// tokens are views into value, which must outlive them
+	template <size_t N = 8
+	> ML_NODISCARD small_vector<std::string_view, N> tokenize_view(std::string_view value, std::string_view delim)
+	{
+		small_vector<std::string_view, N> temp{};
+		util::for_each_token(value, delim, [&temp](std::string_view tok) { temp.push_back(tok); });
+		return temp;
+	}
+
+	ML_NODISCARD inline list<string> tokenize(std::string_view value, std::string_view delim)
+	{
+		list<string> temp{};
+		util::for_each_token(value, delim, [&temp](std::string_view tok) { temp.emplace_back(tok); });
 		return temp;
 	}
 
@@ -532,15 +552,7 @@ namespace ml::util
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	template <class Arg0, class ... Args
-	> ML_NODISCARD string format(string const & str, Arg0 const & arg0, Args && ... args) noexcept
-	{
-		stringstream ss{};
-		ss << ML_forward(arg0) << '\n';
-		int32 sink[] = { 0, ((void)(ss << args << '\n'), 0)... }; (void)sink;
-		return format(str, ss);
-	}
-
+	// one argument per line
 	ML_NODISCARD inline string format(string str, stringstream & ss) noexcept
 	{
 		for (size_t i = 0; ss.good(); ++i)
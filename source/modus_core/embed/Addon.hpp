@@ -37,6 +37,12 @@ namespace ml
 
 		virtual void on_event(event const &) override = 0;
 
+		// reload, old instance, keep what should survive in state and return its layout version
+		virtual uint32 on_unload(json & state) { return 0; }
+
+		// reload, new instance instead of startup, state is empty if the old one saved nothing
+		virtual void on_reload(json const & state, uint32 version) {}
+
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	private:
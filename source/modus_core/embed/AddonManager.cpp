@@ -0,0 +1,203 @@
+#include <modus_core/embed/AddonManager.hpp>
+#include <modus_core/embed/ScriptService.hpp>
+#include <modus_core/system/JobSystem.hpp>
+#include <modus_core/system/Logger.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// linkers write in pieces, a library has to sit unchanged this long before it's reloaded
+	static constexpr std::chrono::milliseconds addon_settle_time{ 500 };
+
+	// addons queue lambdas on the script thread, the main queue and the job system,
+	// all of it has to run while the code it points into is still loaded
+	static void addon_fence()
+	{
+		script_service * const scripts{ ML_get_global(script_service) };
+		job_system * const jobs{ ML_get_global(job_system) };
+		if (scripts) { scripts->drain(); }
+		if (jobs) { jobs->wait_idle(); }
+		if (scripts) { scripts->drain(); } // jobs may have posted main work of their own
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	hash_t addon_manager::watch_addon(fs::path const & path, void * userptr)
+	{
+		fs::path source{ path };
+		source.replace_extension(native_library::default_extension);
+
+		if (hash_t const id{ hashof(source.filename().string()) }; this->contains(id)) { return id; }
+		else
+		{
+			std::error_code ec{};
+			fs::file_time_type const stamp{ fs::last_write_time(source, ec) };
+			if (ec) { return 0; }
+
+			ref<native_library> const lib{ this->load_shadow(source) };
+			if (!lib) { return 0; }
+
+			hash_t const result{ this->emplace_addon(id, lib, userptr, source, stamp) };
+			if (!result) { this->discard_shadow(lib); }
+			return result;
+		}
+	}
+
+	bool addon_manager::reload_addon(hash_t value)
+	{
+		size_t const i{ m_data.lookup<hash_t>(value) };
+		if (i == m_data.npos || m_data.get<fs::path>(i).empty()) { return false; }
+
+		fs::path const source{ m_data.get<fs::path>(i) };
+		std::error_code ec{};
+		fs::file_time_type const stamp{ fs::last_write_time(source, ec) };
+		if (ec) { return false; }
+
+		// the new build loads next to the old one, nothing changes until it has both entry points
+		ref<native_library> const lib{ this->load_shadow(source) };
+		if (!lib) { return false; }
+		create_addon_fn create_fn{ lib->target<addon *, addon_manager *, void *>("ml_create_addon") };
+		destroy_addon_fn destroy_fn{ lib->target<void, addon_manager *, addon *>("ml_destroy_addon") };
+		if (!create_fn || !destroy_fn)
+		{
+			ML_log_error("addon: {0} is missing its entry points", source.string());
+			this->discard_shadow(lib);
+			return false;
+		}
+
+		// the old instance hands over its state, then leaves the bus as it's destroyed
+		addon_fence();
+		addon * const prev{ m_data.get<scary<addon>>(i).release() };
+		void * const userptr{ prev->get_user_pointer() };
+		json state{};
+		uint32 const version{ prev->on_unload(state) };
+		addon_fence();
+		m_data.get<destroy_addon_fn>(i)(this, prev);
+
+		ref<native_library> const prev_lib{ std::exchange(m_data.get<ref<native_library>>(i), lib) };
+		m_data.get<file_info_struct>(i) = util::get_file_info(source).value_or(file_info_struct{});
+		m_data.get<create_addon_fn>(i) = std::move(create_fn);
+		m_data.get<destroy_addon_fn>(i) = std::move(destroy_fn);
+		m_data.get<fs::file_time_type>(i) = stamp;
+
+		addon * const next{ m_data.get<create_addon_fn>(i)(this, userptr) };
+		this->discard_shadow(prev_lib);
+		if (!next)
+		{
+			ML_log_error("addon: {0} failed to create on reload", source.string());
+			m_data.erase(i);
+			this->discard_shadow(lib);
+			return false;
+		}
+		m_data.get<scary<addon>>(i).reset(next);
+		next->on_reload(state, version);
+
+		ML_log_info("addon: reloaded {0}", source.filename().string());
+		return true;
+	}
+
+	bool addon_manager::uninstall_addon(hash_t value)
+	{
+		if (!value)
+		{
+			return false;
+		}
+		else if (size_t const i{ m_data.lookup<hash_t>(value) }; i == m_data.npos)
+		{
+			return false;
+		}
+		else
+		{
+			addon_fence();
+			addon * const p{ m_data.get<scary<addon>>(i).release() };
+			m_data.get<destroy_addon_fn>(i)(this, p);
+			addon_fence();
+			ref<native_library> const lib{ std::move(m_data.get<ref<native_library>>(i)) };
+			bool const shadowed{ !m_data.get<fs::path>(i).empty() };
+			m_data.erase(i);
+			if (shadowed) { this->discard_shadow(lib); }
+			return true;
+		}
+	}
+
+	size_t addon_manager::check_for_changes()
+	{
+		// backwards, an addon that fails to come back is erased
+		size_t count{};
+		for (size_t i = m_data.size(); i-- > 0;)
+		{
+			fs::path const & source{ m_data.get<fs::path>(i) };
+			if (source.empty()) { continue; }
+
+			std::error_code ec{};
+			fs::file_time_type const stamp{ fs::last_write_time(source, ec) };
+			if (ec || stamp == m_data.get<fs::file_time_type>(i)) { continue; }
+			if (fs::file_time_type::clock::now() - stamp < addon_settle_time) { continue; }
+
+			// a broken build isn't retried until it changes again
+			if (this->reload_addon(m_data.get<hash_t>(i))) { ++count; }
+			else if (i < m_data.size()) { m_data.get<fs::file_time_type>(i) = stamp; }
+		}
+		return count;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	hash_t addon_manager::emplace_addon(hash_t id, ref<native_library> const & lib, void * userptr, fs::path const & source, fs::file_time_type stamp)
+	{
+		m_data.push_back(
+			id,
+			source.empty() ? lib->get_file_info() : util::get_file_info(source).value_or(file_info_struct{}),
+			lib->target<addon *, addon_manager *, void *>("ml_create_addon"),
+			lib->target<void, addon_manager *, addon *>("ml_destroy_addon"),
+			lib,
+			nullptr,
+			source,
+			stamp);
+
+		if (auto fn{ m_data.back<create_addon_fn>() }; !fn) { m_data.pop_back(); return 0; }
+		else if (addon * p{ fn(this, userptr) }; !p) { m_data.pop_back(); return 0; }
+		else
+		{
+			m_data.back<scary<addon>>().reset(p);
+
+			return m_data.back<hash_t>();
+		}
+	}
+
+	ref<native_library> addon_manager::load_shadow(fs::path const & source)
+	{
+		// every copy gets a new name, the loader hands back the old image for a name it has seen
+		std::error_code ec{};
+		fs::path const dir{ m_shadow_path.empty() ? source.parent_path() : m_shadow_path };
+		if (!dir.empty()) { fs::create_directories(dir, ec); }
+
+		fs::path shadow{ dir / (source.stem().string() + "_" + std::to_string(++m_shadow_count)) };
+		shadow += native_library::default_extension;
+		if (!fs::copy_file(source, shadow, fs::copy_options::overwrite_existing, ec))
+		{
+			ML_log_error("addon: failed to copy {0}: {1}", source.string(), ec.message());
+			return nullptr;
+		}
+
+		if (ref<native_library> lib{ alloc_ref<native_library>(m_alloc, shadow) }; *lib) { return lib; }
+		else
+		{
+			ML_log_error("addon: failed to load {0}", source.string());
+			fs::remove(shadow, ec);
+			return nullptr;
+		}
+	}
+
+	void addon_manager::discard_shadow(ref<native_library> const & lib)
+	{
+		if (!lib || 1 < lib.use_count()) { return; }
+		fs::path const shadow{ lib->get_file_info().file_path.c_str() };
+		lib->close();
+		std::error_code ec{};
+		fs::remove(shadow, ec);
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
\ No newline at end of file
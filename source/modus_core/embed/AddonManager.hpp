@@ -11,7 +11,7 @@ namespace ml
 	ML_alias destroy_addon_fn = method<void(addon_manager *, addon *)>;
 
 	// addon manager
-	struct addon_manager final : non_copyable, trackable
+	struct ML_CORE_API addon_manager final : non_copyable, trackable
 	{
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
@@ -24,17 +24,21 @@ namespace ml
 			file_info_struct,
 			create_addon_fn,
 			destroy_addon_fn,
-			weak<native_library>,
-			scary<addon>
+			ref<native_library>,
+			scary<addon>,
+			fs::path,
+			fs::file_time_type
 		>;
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 		addon_manager(event_bus * bus, allocator_type alloc = {}) noexcept
-			: m_bus		{ bus }
-			, m_alloc	{ alloc }
-			, m_data	{ alloc }
-			, m_userptr	{}
+			: m_bus			{ bus }
+			, m_alloc		{ alloc }
+			, m_data		{ alloc }
+			, m_userptr		{}
+			, m_shadow_path	{}
+			, m_shadow_count{}
 		{
 		}
 
@@ -53,6 +57,11 @@ namespace ml
 
 		void set_user_pointer(void * value) noexcept { m_userptr = value; }
 
+		ML_NODISCARD auto get_shadow_path() const noexcept -> fs::path const & { return m_shadow_path; }
+
+		// where watched addons are copied before loading, empty puts copies next to the original
+		void set_shadow_path(fs::path const & value) { m_shadow_path = value; }
+
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 		ML_NODISCARD bool contains(hash_t id) const noexcept { return m_data.contains<hash_t>(id); }
@@ -86,54 +95,30 @@ namespace ml
 		{
 			if (!lib || !*lib) { return 0; }
 			
-			if (size_t const i{ m_data.lookup_if<weak<native_library>>([&
-			](auto const & e) { return !e.expired() && e.lock()->get_hash_code() == lib->get_hash_code(); }) }
+			if (size_t const i{ m_data.lookup_if<ref<native_library>>([&
+			](auto const & e) { return e && e->get_hash_code() == lib->get_hash_code(); }) }
 			; i != m_data.npos)
 			{
 				return m_data.get<hash_t>(i);
 			}
 			else
 			{
-				m_data.push_back(
-					lib->get_hash_code(),
-					lib->get_file_info(),
-					lib->target<addon *, addon_manager *, void *>("ml_create_addon"),
-					lib->target<void, addon_manager *, addon *>("ml_destroy_addon"),
-					lib,
-					nullptr);
-
-				if (auto fn{ m_data.back<create_addon_fn>() }; !fn) { return 0; }
-				else
-				{
-					if (addon * p{ fn(this, userptr) }; !p) { return 0; }
-					else
-					{
-						m_data.back<scary<addon>>().reset(p);
-
-						return m_data.back<hash_t>();
-					}
-				}
+				return this->emplace_addon(lib->get_hash_code(), lib, userptr, {}, {});
 			}
 		}
 
-		bool uninstall_addon(hash_t value)
-		{
-			if (!value)
-			{
-				return false;
-			}
-			else if (size_t const i{ m_data.lookup<hash_t>(value) }; i == m_data.npos)
-			{
-				return false;
-			}
-			else
-			{
-				addon * const p{ m_data.get<scary<addon>>(i).release() };
-				m_data.get<destroy_addon_fn>(i)(this, p);
-				m_data.erase(i);
-				return true;
-			}
-		}
+		// loads a copy so the original can be rebuilt while it runs, check_for_changes swaps rebuilds in
+		hash_t watch_addon(fs::path const & path, void * userptr = nullptr);
+
+		// swaps in the current build of a watched addon, state passes through on_unload and on_reload,
+		// a build that fails to load leaves the running instance alone
+		bool reload_addon(hash_t value);
+
+		// reloads watched addons whose library changed, never call this from inside a broadcast
+		size_t check_for_changes();
+
+		// queued work on the script, main and job threads is finished before the library goes away
+		bool uninstall_addon(hash_t value);
 
 		bool uninstall_addon(fs::path const & path) noexcept
 		{
@@ -150,10 +135,21 @@ namespace ml
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	private:
-		event_bus * const	m_bus		; // event bus
-		allocator_type		m_alloc		; // allocator
-		storage_type		m_data		; // addon data
-		void *				m_userptr	; // user pointer
+		hash_t emplace_addon(hash_t id, ref<native_library> const & lib, void * userptr, fs::path const & source, fs::file_time_type stamp);
+
+		ML_NODISCARD ref<native_library> load_shadow(fs::path const & source);
+
+		void discard_shadow(ref<native_library> const & lib);
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		event_bus * const	m_bus			; // event bus
+		allocator_type		m_alloc			; // allocator
+		storage_type		m_data			; // addon data
+		void *				m_userptr		; // user pointer
+		fs::path			m_shadow_path	; // copies of watched addons
+		uint32				m_shadow_count	; // copies made
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	};
@@ -3,6 +3,9 @@
 #ifdef ML_os_windows
 #include <modus_core/backends/win32/Win32_Platform.hpp>
 using impl_platform = _ML win32_platform;
+#else
+#include <modus_core/backends/posix/Posix_Platform.hpp>
+using impl_platform = _ML posix_platform;
 #endif
 
 namespace ml
@@ -31,7 +34,7 @@ namespace ml
 		m_hash = {};
 		m_info = {};
 		m_lookup.clear();
-		return impl_platform::free_library(m_handle);
+		return impl_platform::free_library(std::exchange(m_handle, nullptr));
 	}
 
 	void * native_library::get_proc_address(string const & method_name)
@@ -1,6 +1,899 @@
 #include <modus_core/embed/Python.hpp>
+#include <modus_core/embed/ScriptService.hpp>
+#include <modus_core/detail/Hash.hpp>
+#include <modus_core/graphics/Bitmap.hpp>
 #include <modus_core/runtime/CoreApplication.hpp>
+#include <modus_core/scene/Components.hpp>
 #include <modus_core/window/WindowAPI.hpp>
+#include <marshal.h>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// typed view of native memory, wrap with memoryview() or numpy.asarray() to use it without copying
+	struct py_buffer_view final
+	{
+		void *				data		; // first element
+		py::ssize_t			itemsize	; // element size
+		std::string			format		; // struct format of one element
+		list<py::ssize_t>	shape		; // extent of each dimension
+		list<py::ssize_t>	strides		; // byte step of each dimension
+		bool				readonly	; // writes are rejected
+		py::object			owner		; // kept alive while the view exists
+
+		template <class T
+		> static py_buffer_view make(T const * data, list<py::ssize_t> shape, bool readonly, py::object owner = {})
+		{
+			list<py::ssize_t> strides(shape.size());
+			py::ssize_t step{ (py::ssize_t)sizeof(T) };
+			for (size_t i = shape.size(); i-- > 0;) { strides[i] = step; step *= shape[i]; }
+			return { (void *)data, (py::ssize_t)sizeof(T), py::format_descriptor<T>::format(), std::move(shape), std::move(strides), readonly, std::move(owner) };
+		}
+
+		ML_NODISCARD py::ssize_t count() const noexcept
+		{
+			py::ssize_t n{ 1 };
+			for (py::ssize_t const e : shape) { n *= e; }
+			return n;
+		}
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+namespace ml::util
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	py::object to_python(json const & value)
+	{
+		switch (value.type())
+		{
+		default: return py::none{};
+
+		case json::value_t::boolean: return py::bool_{ value.get<bool>() };
+
+		case json::value_t::number_integer: return py::reinterpret_steal<py::object>(PyLong_FromLongLong(value.get<int64>()));
+
+		case json::value_t::number_unsigned: return py::reinterpret_steal<py::object>(PyLong_FromUnsignedLongLong(value.get<uint64>()));
+
+		case json::value_t::number_float: return py::reinterpret_steal<py::object>(PyFloat_FromDouble(value.get<float64>()));
+
+		case json::value_t::string: {
+			auto const & str{ value.get_ref<json::string_t const &>() };
+			return py::reinterpret_steal<py::object>(PyUnicode_FromStringAndSize(str.data(), (Py_ssize_t)str.size()));
+		}
+
+		case json::value_t::array: {
+			auto const & arr{ value.get_ref<json::array_t const &>() };
+			PyObject * const list{ PyList_New((Py_ssize_t)arr.size()) };
+			if (!list) { throw py::error_already_set{}; }
+			py::object result{ py::reinterpret_steal<py::object>(list) };
+			for (size_t i = 0; i < arr.size(); ++i)
+			{
+				PyList_SET_ITEM(list, (Py_ssize_t)i, to_python(arr[i]).release().ptr());
+			}
+			return result;
+		}
+
+		case json::value_t::object: {
+			py::dict result{};
+			for (auto const & [k, v] : value.get_ref<json::object_t const &>())
+			{
+				// documents repeat the same keys, interned ones are shared and compare by address
+				PyObject * key{ PyUnicode_FromStringAndSize(k.data(), (Py_ssize_t)k.size()) };
+				if (!key) { throw py::error_already_set{}; }
+				PyUnicode_InternInPlace(&key);
+				py::object const owned_key{ py::reinterpret_steal<py::object>(key) };
+				if (PyDict_SetItem(result.ptr(), key, to_python(v).ptr()) != 0) { throw py::error_already_set{}; }
+			}
+			return std::move(result);
+		}
+		}
+	}
+
+	json from_python(py::handle value)
+	{
+		PyObject * const o{ value.ptr() };
+
+		if (!o || o == Py_None) { return nullptr; }
+
+		// bool first, it is a subclass of int
+		if (PyBool_Check(o)) { return o == Py_True; }
+
+		if (PyLong_Check(o))
+		{
+			int32 overflow{};
+			long long const i{ PyLong_AsLongLongAndOverflow(o, &overflow) };
+			if (!overflow) { return (int64)i; }
+			if (0 < overflow) { if (uint64 const u{ PyLong_AsUnsignedLongLong(o) }; !PyErr_Occurred()) { return u; } PyErr_Clear(); }
+			return PyLong_AsDouble(o);
+		}
+
+		if (PyFloat_Check(o)) { return PyFloat_AS_DOUBLE(o); }
+
+		if (PyUnicode_Check(o))
+		{
+			Py_ssize_t size{};
+			cstring const data{ PyUnicode_AsUTF8AndSize(o, &size) };
+			if (!data) { throw py::error_already_set{}; }
+			return json::string_t{ data, (size_t)size };
+		}
+
+		if (PyList_Check(o) || PyTuple_Check(o))
+		{
+			Py_ssize_t const size{ PySequence_Fast_GET_SIZE(o) };
+			PyObject ** const items{ PySequence_Fast_ITEMS(o) };
+			json result = json::array();
+			auto & arr{ result.get_ref<json::array_t &>() };
+			arr.reserve((size_t)size);
+			for (Py_ssize_t i = 0; i < size; ++i) { arr.emplace_back(from_python(items[i])); }
+			return result;
+		}
+
+		if (PyDict_Check(o))
+		{
+			json result = json::object();
+			auto & obj{ result.get_ref<json::object_t &>() };
+			Py_ssize_t pos{};
+			PyObject * k, * v;
+			while (PyDict_Next(o, &pos, &k, &v))
+			{
+				if (PyUnicode_Check(k))
+				{
+					Py_ssize_t size{};
+					cstring const data{ PyUnicode_AsUTF8AndSize(k, &size) };
+					if (!data) { throw py::error_already_set{}; }
+					obj.emplace(json::string_t{ data, (size_t)size }, from_python(v));
+				}
+				else
+				{
+					obj.emplace((std::string)py::str(k), from_python(v));
+				}
+			}
+			return result;
+		}
+
+		// anything else gets the json module's treatment
+		return json::parse((std::string)py::str(py::module::import("json").attr("dumps")(value)));
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void eval_file_cached(fs::path const & path, fs::path const & cache_dir, py::object global)
+	{
+		std::string source{};
+		if (std::ifstream f{ path, std::ios::binary }; f)
+		{
+			source.assign(std::istreambuf_iterator<char>{ f }, std::istreambuf_iterator<char>{});
+		}
+		else
+		{
+			PyErr_Format(PyExc_FileNotFoundError, "could not open '%s'", path.string().c_str());
+			throw py::error_already_set{};
+		}
+		std::string const name{ path.string() };
+
+		// header is the interpreter's magic number, then the source size and hash
+		uint32 const magic{ (uint32)PyImport_GetMagicNumber() };
+		uint32 const size{ (uint32)source.size() };
+		uint64 const hash{ fast_hash{}(source.data(), source.size()) };
+		size_t constexpr header_size{ sizeof(magic) + sizeof(size) + sizeof(hash) };
+
+		// named after the script, the path hash keeps scripts with the same name apart
+		fs::path const cache_file{ cache_dir.empty() ? fs::path{} : cache_dir / (path.stem().string() + '.' +
+			std::to_string(fast_hash{}(name.data(), name.size())) + ".pyc") };
+
+		py::object code{};
+		if (!cache_file.empty())
+		{
+			if (std::ifstream f{ cache_file, std::ios::binary }; f)
+			{
+				std::string const data{ std::istreambuf_iterator<char>{ f }, std::istreambuf_iterator<char>{} };
+				if (data.size() > header_size
+					&& !std::memcmp(data.data(), &magic, sizeof(magic))
+					&& !std::memcmp(data.data() + sizeof(magic), &size, sizeof(size))
+					&& !std::memcmp(data.data() + sizeof(magic) + sizeof(size), &hash, sizeof(hash)))
+				{
+					code = py::reinterpret_steal<py::object>(PyMarshal_ReadObjectFromString(data.data() + header_size, (Py_ssize_t)(data.size() - header_size)));
+					if (!code || !PyCode_Check(code.ptr())) { PyErr_Clear(); code = {}; }
+				}
+			}
+		}
+		if (!code)
+		{
+			code = py::reinterpret_steal<py::object>(Py_CompileString(source.c_str(), name.c_str(), Py_file_input));
+			if (!code) { throw py::error_already_set{}; }
+
+			// a missing cache only costs the next startup a compile
+			py::object const data{ cache_file.empty() ? py::object{} :
+				py::reinterpret_steal<py::object>(PyMarshal_WriteObjectToString(code.ptr(), Py_MARSHAL_VERSION)) };
+			if (!cache_file.empty() && !data) { PyErr_Clear(); }
+			else if (data)
+			{
+				// written aside and renamed so a crash never leaves half a file behind
+				std::error_code ec{};
+				fs::create_directories(cache_dir, ec);
+				fs::path const temp{ fs::path{ cache_file }.concat(".tmp") };
+				bool written{};
+				if (std::ofstream f{ temp, std::ios::binary | std::ios::trunc }; f)
+				{
+					f.write((cstring)&magic, sizeof(magic)).write((cstring)&size, sizeof(size)).write((cstring)&hash, sizeof(hash));
+					f.write(PyBytes_AS_STRING(data.ptr()), PyBytes_GET_SIZE(data.ptr()));
+					written = f.good();
+				}
+				if (written) { fs::rename(temp, cache_file, ec); }
+				else { fs::remove(temp, ec); }
+			}
+		}
+
+		// the same globals eval_file gives a script
+		global["__file__"] = name;
+		py::object const result{ py::reinterpret_steal<py::object>(PyEval_EvalCode(code.ptr(), global.ptr(), global.ptr())) };
+		if (!result) { throw py::error_already_set{}; }
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// submodules are filled in on first attribute access, so startup only pays for what scripts touch
+	using py_builder = void(*)(py::module &);
+
+	static void py_materialize(py::module & sub)
+	{
+		py::dict const dict{ sub.attr("__dict__") };
+		if (!dict.contains("__builder__")) { return; }
+		py_builder const build{ (py_builder)dict["__builder__"].cast<intptr_t>() };
+		PyDict_DelItemString(dict.ptr(), "__builder__");
+		PyDict_DelItemString(dict.ptr(), "__getattr__");
+		build(sub);
+	}
+
+	static py::module py_lazy_submodule(py::module & parent, cstring name, py_builder build)
+	{
+		py::module sub{ parent.def_submodule(name) };
+		sub.attr("__builder__") = (intptr_t)build;
+		sub.attr("__getattr__") = py::cpp_function([ptr = sub.ptr()](std::string const & attr) -> py::object
+		{
+			py::module self{ py::reinterpret_borrow<py::module>(ptr) };
+			py_materialize(self);
+			return self.attr(attr.c_str());
+		});
+		return sub;
+	}
+
+	// types from a lazy submodule have to be registered before they can be returned
+	static void py_require(cstring name)
+	{
+		py::module sub{ py::module::import(name) };
+		py_materialize(sub);
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// engine objects belong to the main thread, bindings reach them through here from the script thread
+
+	// the main thread parked between its tasks for a script, it runs what the script hands it until released
+	struct py_main_hold final
+	{
+		enum : int32 { waiting, parked, released };
+
+		std::mutex					mutex	; // guards the rest
+		std::condition_variable		cv		; // step or work changed
+		int32						step	{}; // where the main thread is
+		script_service::task const *work	{}; // handed to the main thread
+		std::exception_ptr			error	{}; // what the work threw
+
+		// main thread, returns once released
+		void park()
+		{
+			std::unique_lock<std::mutex> lock{ mutex };
+			step = parked;
+			cv.notify_all();
+			while (true)
+			{
+				cv.wait(lock, [&]() { return step == released || work; });
+				if (!work) { break; }
+				lock.unlock();
+				try { std::invoke(*work); }
+				catch (...) { error = std::current_exception(); }
+				lock.lock();
+				work = nullptr;
+				cv.notify_all();
+			}
+		}
+
+		// holding thread, gil held
+		void call(script_service::task const & fn)
+		{
+			{
+				py::gil_scoped_release nogil{};
+				std::unique_lock<std::mutex> lock{ mutex };
+				work = &fn;
+				cv.notify_all();
+				cv.wait(lock, [&]() { return !work; });
+			}
+			if (error) { std::rethrow_exception(std::exchange(error, nullptr)); }
+		}
+	};
+
+	// per thread, engine memory may be used in place while depth is above zero
+	struct py_main_scope final
+	{
+		std::shared_ptr<py_main_hold>	hold	{}; // empty on the main thread
+		list<py::object>				views	{ get_shared_resource() }; // emptied on exit
+		size_t							depth	{}; // nested scopes
+	};
+
+	static thread_local py_main_scope g_py_main_scope{};
+
+	ML_NODISCARD static bool py_is_main_thread() noexcept
+	{
+		script_service * const s{ ML_get_global(script_service) };
+		return !s || !s->is_running() || s->is_main_thread() || 0 < g_py_main_scope.depth;
+	}
+
+	// fn() on the main thread, waited for with the gil released, gil held
+	template <class Fn
+	> static auto py_main_call(Fn && fn) -> decltype(fn())
+	{
+		script_service * const s{ ML_get_global(script_service) };
+		auto const run{ [s](script_service::task const & t)
+		{
+			if (py_main_hold * const h{ g_py_main_scope.hold.get() }) { h->call(t); }
+			else { s->call_main(t); }
+		} };
+		if (!s) { return fn(); }
+		else if constexpr (std::is_void_v<decltype(fn())>) { run([&fn]() { fn(); }); }
+		else
+		{
+			std::optional<decltype(fn())> result{};
+			run([&fn, &result]() { result.emplace(fn()); });
+			return std::move(*result);
+		}
+	}
+
+	// from the script thread this waits with the gil released until the main thread parks for us
+	static void py_enter_main_scope()
+	{
+		py_main_scope & scope{ g_py_main_scope };
+		if (scope.depth++) { return; }
+
+		script_service * const s{ ML_get_global(script_service) };
+		if (!s || !s->is_running() || s->is_main_thread()) { return; }
+
+		auto hold{ std::make_shared<py_main_hold>() };
+		s->post_main([hold]() { hold->park(); });
+		{
+			py::gil_scoped_release nogil{};
+			std::unique_lock<std::mutex> lock{ hold->mutex };
+			hold->cv.wait(lock, [&]() { return hold->step == py_main_hold::parked; });
+		}
+		scope.hold = std::move(hold);
+	}
+
+	// python may drop the last reference on any thread, the object is released on the main one
+	template <class T
+	> static ref<T> py_main_owned(ref<T> value)
+	{
+		T * const ptr{ value.get() };
+		return ref<T>{ ptr, [value = std::move(value)](T *) mutable
+		{
+			script_service * const s{ ML_get_global(script_service) };
+			if (!s) { value.reset(); }
+			else { s->run_main([value = std::exchange(value, nullptr)]() {}); }
+		} };
+	}
+
+	ML_NODISCARD static list<py::ssize_t> py_engine_shape(py::ssize_t columns, size_t count)
+	{
+		if (columns <= 1) { return { (py::ssize_t)count }; }
+		else { return { (py::ssize_t)count / columns, columns }; }
+	}
+
+	// read only copy of engine memory taken on the main thread, get() returns the first element and the element count
+	template <class T, class Fn
+	> static py_buffer_view py_engine_copy(py::ssize_t columns, Fn && get)
+	{
+		auto * const copy{ new list<T>{ get_shared_resource() } }; // filled on the main thread, freed on ours
+		py::capsule owner{ copy, [](void * p) { delete (list<T> *)p; } };
+		py_main_call([&]()
+		{
+			auto const [data, count] { get() };
+			copy->assign(data, data + count);
+		});
+		return py_buffer_view::make((T const *)copy->data(), py_engine_shape(columns, copy->size()), true, std::move(owner));
+	}
+
+	// read only view of engine memory, aliased inside a main scope and emptied when it ends, copied outside of one
+	template <class T, class Fn
+	> static py::object py_engine_view(py::ssize_t columns, Fn && get)
+	{
+		py_main_scope & scope{ g_py_main_scope };
+		if (!scope.depth) { return py::cast(py_engine_copy<T>(columns, ML_forward(get))); }
+		auto const [data, count] { get() };
+		return scope.views.emplace_back(py::cast(py_buffer_view::make(data, py_engine_shape(columns, count), true)));
+	}
+
+	// views into engine memory are emptied before the main thread moves on
+	static void py_exit_main_scope()
+	{
+		py_main_scope & scope{ g_py_main_scope };
+		if (!scope.depth || --scope.depth) { return; }
+
+		for (py::object const & o : scope.views)
+		{
+			py_buffer_view & v{ o.cast<py_buffer_view &>() };
+			v.data = nullptr;
+			std::fill(v.shape.begin(), v.shape.end(), 0);
+		}
+		scope.views.clear();
+
+		if (std::shared_ptr<py_main_hold> const hold{ std::move(scope.hold) })
+		{
+			{
+				std::lock_guard<std::mutex> lock{ hold->mutex };
+				hold->step = py_main_hold::released;
+			}
+			hold->cv.notify_all();
+		}
+	}
+
+	// scripts keep scenes through this, the owner may destroy one while a script still has it
+	struct py_scene final
+	{
+		weak<scene_tree> value; // locked on the main thread for each call
+
+		// main thread, throws once the scene is gone
+		ML_NODISCARD ref<scene_tree> lock() const
+		{
+			if (ref<scene_tree> tree{ value.lock() }) { return tree; }
+			else { throw py::value_error{ "scene no longer exists" }; }
+		}
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// MEMORY
+	static void py_build_memory(py::module & py_mem)
+	{
+		using pmr_allocator = pmr::polymorphic_allocator<byte>;
+
+		py::class_<pmr_allocator>(py_mem, "allocator")
+			.def(py::init<>())
+			.def(py::init([](intptr_t p) { return pmr_allocator{ (pmr::memory_resource *)p }; }))
+			.def(py::init<pmr_allocator const &>())
+			.def("allocate", [](pmr_allocator & o, size_t s) { return (intptr_t)o.allocate(s); })
+			.def("deallocate", [](pmr_allocator & o, intptr_t p, size_t s) { o.deallocate((byte *)p, s); })
+			;
+
+		py::class_<memory_record>(py_mem, "record")
+			.def(py::init<>())
+			.def(py::init<memory_record const &>())
+			.def(py::init([g = ML_get_global(memory_manager)](intptr_t p) -> memory_record
+			{
+				if (auto const i{ g->get_records().lookup<memory_manager::ID_addr>((byte *)p) }
+				; i != g->get_records().npos) {
+					return g->query_record(i);
+				} else {
+					return {};
+				}
+			}))
+			.def_property_readonly("addr", [](memory_record const & o) { return (intptr_t)o.addr; })
+			.def_readonly("index", &memory_record::index)
+			.def_readonly("count", &memory_record::count)
+			.def_readonly("size", &memory_record::size)
+			.def("__nonzero__", &memory_record::operator bool)
+			.def("__repr__", [](memory_record const & o) { return json{ o }.dump(); })
+			.def("__str__", [](memory_record const & o) { return json{ o }.dump(); })
+			;
+
+		auto memget = [](intptr_t p, size_t s) -> py::int_
+		{
+			switch (s)
+			{
+			default	: return 0;
+			case 1	: return *(uint8 *)p;
+			case 2	: return *(uint16 *)p;
+			case 3	: return *(uint32 *)p;
+			case 4	: return *(uint64 *)p;
+			}
+		};
+
+		py_mem // memory
+			// passthrough resource
+			.def("num_allocations", []() { return ML_get_global(memory_manager)->get_resource()->num_allocations(); })
+			.def("total_allocations", []() { return ML_get_global(memory_manager)->get_resource()->total_allocations(); })
+			.def("buffer_base", []() { return ML_get_global(memory_manager)->get_resource()->buffer_base(); })
+			.def("buffer_free", []() { return ML_get_global(memory_manager)->get_resource()->buffer_free(); })
+			.def("buffer_size", []() { return ML_get_global(memory_manager)->get_resource()->buffer_size(); })
+			.def("buffer_used", []() { return ML_get_global(memory_manager)->get_resource()->buffer_used(); })
+
+			// allocation
+			.def("malloc"	, [](size_t s) { return (intptr_t)ML_get_global(memory_manager)->allocate(s); })
+			.def("calloc"	, [](size_t c, size_t s) { return (intptr_t)ML_get_global(memory_manager)->allocate(c, s); })
+			.def("free"		, [](intptr_t p) { ML_get_global(memory_manager)->deallocate((void *)p); })
+			.def("realloc"	, [](intptr_t p, size_t s) { return (intptr_t)ML_get_global(memory_manager)->reallocate((void *)p, s); })
+			.def("realloc"	, [](intptr_t p, size_t o, size_t n) { return (intptr_t)ML_get_global(memory_manager)->reallocate((void *)p, o, n); })
+
+			// getters
+			.def("memget"	, [memget](intptr_t p) { return memget(p, 1); })
+			.def("memget"	, [memget](intptr_t p, size_t s) { return memget(p, s); })
+			.def("memget"	, [memget](intptr_t p, size_t s, size_t n)
+			{
+				py::list temp{};
+				for (intptr_t first = p, last = p + (ptrdiff_t)(s * n); first != last; ++first)
+				{
+					temp.append(memget(first, s));
+				}
+				return temp;
+			})
+			.def("strget"	, [](intptr_t p) { return (cstring)p; })
+			.def("strget"	, [](intptr_t l, intptr_t r) { return std::string{ (cstring)l, (cstring)r }; })
+
+			// memchr
+			.def("memchr"	, [](intptr_t p, int32 v, size_t n) { return (intptr_t)std::memchr((void *)p, v, n); })
+			// memcmp
+			.def("memcmp"	, [](intptr_t l, intptr_t r, size_t n) { return std::memcmp((void *)l, (void *)r, n); })
+			// memcpy
+			.def("memcpy"	, [](intptr_t d, intptr_t s, size_t n) { return (intptr_t)std::memcpy((void *)d, (void *)s, n); })
+			// memmove
+			.def("memmove"	, [](intptr_t d, intptr_t s, size_t n) { return (intptr_t)std::memmove((void *)d, (void *)s, n); })
+			// memset
+			.def("memset"	, [](intptr_t d, int32 v, size_t n) { return (intptr_t)std::memset((void *)d, v, n); })
+			// strcpy
+			.def("strcpy"	, [](intptr_t d, intptr_t s) { return (intptr_t)std::strcpy((char *)d, (char *)s); })
+			.def("strcpy"	, [](intptr_t d, cstring s) { return (intptr_t)std::strcpy((char *)d, s); })
+			// strncpy
+			.def("strncpy"	, [](intptr_t d, intptr_t s, size_t n) { return (intptr_t)std::strncpy((char *)d, (char *)s, n); })
+			.def("strncpy"	, [](intptr_t d, cstring s, size_t n) { return (intptr_t)std::strncpy((char *)d, s, n); })
+			// strcat
+			.def("strcat"	, [](intptr_t d, intptr_t s) { return (intptr_t)std::strcat((char *)d, (char *)s); })
+			.def("strcat"	, [](intptr_t d, cstring s) { return (intptr_t)std::strcat((char *)d, s); })
+			// strncat
+			.def("strncat"	, [](intptr_t d, intptr_t s, size_t n) { return (intptr_t)std::strncat((char *)d, (char *)s, n); })
+			.def("strncat"	, [](intptr_t d, cstring s, size_t n) { return (intptr_t)std::strncat((char *)d, s, n); })
+			// strlen
+			.def("strlen"	, [](intptr_t p) { return std::strlen((cstring)p); })
+			;
+
+		py::class_<py_buffer_view>(py_mem, "view", py::buffer_protocol())
+			.def(py::init([](intptr_t p, size_t n, std::string const & fmt)
+			{
+				// raw addresses from malloc and friends, n is in elements
+				py::ssize_t const itemsize{ py::module::import("struct").attr("calcsize")(fmt).cast<py::ssize_t>() };
+				return py_buffer_view{ (void *)p, itemsize, fmt, { (py::ssize_t)n }, { itemsize }, false, {} };
+			}), py::arg("addr"), py::arg("count"), py::arg("format") = "B")
+			.def_buffer([](py_buffer_view & v)
+			{
+				return py::buffer_info{ v.data, v.itemsize, v.format, (py::ssize_t)v.shape.size(),
+					std::vector<py::ssize_t>{ v.shape.begin(), v.shape.end() },
+					std::vector<py::ssize_t>{ v.strides.begin(), v.strides.end() }, v.readonly };
+			})
+			.def_property_readonly("addr", [](py_buffer_view const & v) { return (intptr_t)v.data; })
+			.def_property_readonly("nbytes", [](py_buffer_view const & v) { return v.count() * v.itemsize; })
+			.def_property_readonly("format", [](py_buffer_view const & v) { return v.format; })
+			.def_property_readonly("shape", [](py_buffer_view const & v) { return py::tuple{ py::cast(v.shape) }; })
+			.def_property_readonly("readonly", [](py_buffer_view const & v) { return v.readonly; })
+			.def("__len__", [](py_buffer_view const & v) { return v.shape.empty() ? 0 : v.shape[0]; })
+			;
+	}
+
+	// GRAPHICS
+	static void py_build_gfx(py::module & py_gfx)
+	{
+		// buffer views belong to memory
+		py_require("modus.memory");
+
+		// contiguous buffer of 4 byte elements of the given kind, for uploads
+		auto buffer_span = [](py::buffer const & b, cstring kinds) -> std::pair<void const *, size_t>
+		{
+			py::buffer_info const info{ b.request() };
+			bool contiguous{ true };
+			for (py::ssize_t i = info.ndim, step = info.itemsize; i-- > 0; step *= info.shape[i]) { contiguous &= info.strides[i] == step; }
+			bool const typed{ info.itemsize == 4 && !info.format.empty() && std::strchr(kinds, info.format.back()) != nullptr };
+			if (!typed || !contiguous) { throw py::type_error{ "expected a contiguous buffer of 4 byte elements" }; }
+			return { info.ptr, (size_t)info.size };
+		};
+
+		py::class_<bitmap>(py_gfx, "bitmap", py::buffer_protocol())
+			.def(py::init<>())
+			.def(py::init<size_t, size_t, size_t>())
+			.def(py::init([](std::string const & path, bool flip_v) { return bitmap{ fs::path{ path }, flip_v }; }), py::arg("path"), py::arg("flip_v") = true)
+			.def_buffer([](bitmap & b)
+			{
+				// rows, columns, channels
+				return py::buffer_info{ b.data(), sizeof(byte), py::format_descriptor<byte>::format(), 3,
+					{ (py::ssize_t)b.height(), (py::ssize_t)b.width(), (py::ssize_t)b.channels() },
+					{ (py::ssize_t)b.cols(), (py::ssize_t)b.channels(), (py::ssize_t)1 } };
+			})
+			.def_property_readonly("width", &bitmap::width)
+			.def_property_readonly("height", &bitmap::height)
+			.def_property_readonly("channels", &bitmap::channels)
+			.def("__bool__", &bitmap::operator bool)
+			;
+
+		// the cpu mirrors are read only views, set_data uploads a whole buffer at once,
+		// buffers are created, uploaded to and released on the main thread
+		py::class_<gfx::vertexbuffer, ref<gfx::vertexbuffer>>(py_gfx, "vertexbuffer")
+			.def(py::init([buffer_span](py::buffer const & b)
+			{
+				auto const [data, count] { buffer_span(b, "f") };
+				return py_main_owned(py_main_call([data = data, count = count]() { return gfx::vertexbuffer::create({ gfx::usage_dynamic, count, data }); }));
+			}))
+			.def_property_readonly("count", [](gfx::vertexbuffer & vb) { return py_main_call([&]() { return vb.get_count(); }); })
+			.def_property_readonly("size", [](gfx::vertexbuffer & vb) { return py_main_call([&]() { return vb.get_size(); }); })
+			.def("view", [](gfx::vertexbuffer & vb)
+			{
+				return py_engine_view<float32>(1, [&vb]() { return std::make_pair((float32 const *)vb.get_buffer().data(), (size_t)vb.get_count()); });
+			})
+			.def("set_data", [buffer_span](gfx::vertexbuffer & vb, py::buffer const & b)
+			{
+				auto const [data, count] { buffer_span(b, "f") };
+				py_main_call([&, data = data, count = count]() { vb.set_data(count, data); });
+			})
+			;
+
+		py::class_<gfx::indexbuffer, ref<gfx::indexbuffer>>(py_gfx, "indexbuffer")
+			.def(py::init([buffer_span](py::buffer const & b)
+			{
+				auto const [data, count] { buffer_span(b, "IL") };
+				return py_main_owned(py_main_call([data = data, count = count]() { return gfx::indexbuffer::create({ gfx::usage_dynamic, count, data }); }));
+			}))
+			.def_property_readonly("count", [](gfx::indexbuffer & ib) { return py_main_call([&]() { return ib.get_count(); }); })
+			.def_property_readonly("size", [](gfx::indexbuffer & ib) { return py_main_call([&]() { return ib.get_size(); }); })
+			.def("view", [](gfx::indexbuffer & ib)
+			{
+				return py_engine_view<uint32>(1, [&ib]() { return std::make_pair((uint32 const *)ib.get_buffer().data(), (size_t)ib.get_count()); });
+			})
+			.def("set_data", [buffer_span](gfx::indexbuffer & ib, py::buffer const & b)
+			{
+				auto const [data, count] { buffer_span(b, "IL") };
+				py_main_call([&, data = data, count = count]() { ib.set_data(count, data); });
+			})
+			;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// enum tables, turned into IntEnum and IntFlag classes the first time a script names one
+
+	struct py_enum_value final { cstring name; int32 value; };
+
+	struct py_enum_table final { cstring name; bool flags; py_enum_value const * first, * last; };
+
+	// context api
+	static constexpr py_enum_value py_context_api_values[]
+	{
+		{ "unknown",		context_api_unknown },
+		{ "opengl",			context_api_opengl },
+		{ "vulkan",			context_api_vulkan },
+		{ "directx",		context_api_directx },
+	};
+
+	// context profile
+	static constexpr py_enum_value py_context_profile_values[]
+	{
+		{ "any",			context_profile_any },
+		{ "core",			context_profile_core },
+		{ "compat",			context_profile_compat },
+		{ "debug",			context_profile_debug },
+	};
+
+	// cursor mode
+	static constexpr py_enum_value py_cursor_mode_values[]
+	{
+		{ "normal",			cursor_mode_normal },
+		{ "hidden",			cursor_mode_hidden },
+		{ "disabled",		cursor_mode_disabled },
+	};
+
+	// cursor shape
+	static constexpr py_enum_value py_cursor_shape_values[]
+	{
+		{ "arrow",			cursor_shape_arrow },
+		{ "ibeam",			cursor_shape_ibeam },
+		{ "crosshair",		cursor_shape_crosshair },
+		{ "hand",			cursor_shape_hand },
+		{ "ew",				cursor_shape_ew },
+		{ "ns",				cursor_shape_ns },
+		{ "nesw",			cursor_shape_nesw },
+		{ "nwse",			cursor_shape_nwse },
+	};
+
+	// key code
+	static constexpr py_enum_value py_keycode_values[]
+	{
+		{ "space",				keycode_space },
+		{ "apostrophe",			keycode_apostrophe },
+		{ "comma",				keycode_comma },
+		{ "minus",				keycode_minus },
+		{ "period",				keycode_period },
+		{ "slash",				keycode_slash },
+		{ "num_0",				keycode_num_0 },
+		{ "num_1",				keycode_num_1 },
+		{ "num_2",				keycode_num_2 },
+		{ "num_3",				keycode_num_3 },
+		{ "num_4",				keycode_num_4 },
+		{ "num_5",				keycode_num_5 },
+		{ "num_6",				keycode_num_6 },
+		{ "num_7",				keycode_num_7 },
+		{ "num_8",				keycode_num_8 },
+		{ "num_9",				keycode_num_9 },
+		{ "semicolon",			keycode_semicolon },
+		{ "equal",				keycode_equal },
+		{ "a",					keycode_a },
+		{ "b",					keycode_b },
+		{ "c",					keycode_c },
+		{ "d",					keycode_d },
+		{ "e",					keycode_e },
+		{ "f",					keycode_f },
+		{ "g",					keycode_g },
+		{ "h",					keycode_h },
+		{ "i",					keycode_i },
+		{ "j",					keycode_j },
+		{ "k",					keycode_k },
+		{ "l",					keycode_l },
+		{ "m",					keycode_m },
+		{ "n",					keycode_n },
+		{ "o",					keycode_o },
+		{ "p",					keycode_p },
+		{ "q",					keycode_q },
+		{ "r",					keycode_r },
+		{ "s",					keycode_s },
+		{ "t",					keycode_t },
+		{ "u",					keycode_u },
+		{ "v",					keycode_v },
+		{ "w",					keycode_w },
+		{ "x",					keycode_x },
+		{ "y",					keycode_y },
+		{ "z",					keycode_z },
+		{ "left_bracket",		keycode_left_bracket },
+		{ "backslash",			keycode_backslash },
+		{ "right_bracket",		keycode_right_bracket },
+		{ "grave_accent",		keycode_grave_accent },
+		{ "world_1",			keycode_world_1 },
+		{ "world_2",			keycode_world_2 },
+		{ "escape",				keycode_escape },
+		{ "enter",				keycode_enter },
+		{ "tab",				keycode_tab },
+		{ "backspace",			keycode_backspace },
+		{ "insert",				keycode_insert },
+		{ "del",				keycode_del },
+		{ "right",				keycode_right },
+		{ "left",				keycode_left },
+		{ "down",				keycode_down },
+		{ "up",					keycode_up },
+		{ "page_up",			keycode_page_up },
+		{ "page_down",			keycode_page_down },
+		{ "home",				keycode_home },
+		{ "end",				keycode_end },
+		{ "caps_lock",			keycode_caps_lock },
+		{ "scroll_lock",		keycode_scroll_lock },
+		{ "num_lock",			keycode_num_lock },
+		{ "print_screen",		keycode_print_screen },
+		{ "pause",				keycode_pause },
+		{ "fn_1",				keycode_fn_1 },
+		{ "fn_2",				keycode_fn_2 },
+		{ "fn_3",				keycode_fn_3 },
+		{ "fn_4",				keycode_fn_4 },
+		{ "fn_5",				keycode_fn_5 },
+		{ "fn_6",				keycode_fn_6 },
+		{ "fn_7",				keycode_fn_7 },
+		{ "fn_8",				keycode_fn_8 },
+		{ "fn_9",				keycode_fn_9 },
+		{ "fn_10",				keycode_fn_10 },
+		{ "fn_11",				keycode_fn_11 },
+		{ "fn_12",				keycode_fn_12 },
+		{ "fn_13",				keycode_fn_13 },
+		{ "fn_14",				keycode_fn_14 },
+		{ "fn_15",				keycode_fn_15 },
+		{ "fn_16",				keycode_fn_16 },
+		{ "fn_17",				keycode_fn_17 },
+		{ "fn_18",				keycode_fn_18 },
+		{ "fn_19",				keycode_fn_19 },
+		{ "fn_20",				keycode_fn_20 },
+		{ "fn_21",				keycode_fn_21 },
+		{ "fn_22",				keycode_fn_22 },
+		{ "fn_23",				keycode_fn_23 },
+		{ "fn_24",				keycode_fn_24 },
+		{ "fn_25",				keycode_fn_25 },
+		{ "kp_0",				keycode_kp_0 },
+		{ "kp_1",				keycode_kp_1 },
+		{ "kp_2",				keycode_kp_2 },
+		{ "kp_3",				keycode_kp_3 },
+		{ "kp_4",				keycode_kp_4 },
+		{ "kp_5",				keycode_kp_5 },
+		{ "kp_6",				keycode_kp_6 },
+		{ "kp_7",				keycode_kp_7 },
+		{ "kp_8",				keycode_kp_8 },
+		{ "kp_9",				keycode_kp_9 },
+		{ "kp_decimal",			keycode_kp_decimal },
+		{ "kp_divide",			keycode_kp_divide },
+		{ "kp_multiply",		keycode_kp_multiply },
+		{ "kp_subtract",		keycode_kp_subtract },
+		{ "kp_add",				keycode_kp_add },
+		{ "kp_enter",			keycode_kp_enter },
+		{ "kp_equal",			keycode_kp_equal },
+		{ "left_shift",			keycode_left_shift },
+		{ "left_control",		keycode_left_ctrl },
+		{ "left_alt",			keycode_left_alt },
+		{ "left_super",			keycode_left_super },
+		{ "right_shift",		keycode_right_shift },
+		{ "right_control",		keycode_right_ctrl },
+		{ "right_alt",			keycode_right_alt },
+		{ "right_super",		keycode_right_super },
+		{ "menu",				keycode_menu },
+	};
+
+	// key mods
+	static constexpr py_enum_value py_keymods_values[]
+	{
+		{ "none",		keymods_none },
+		{ "shift",		keymods_shift },
+		{ "ctrl",		keymods_ctrl },
+		{ "alt",		keymods_alt },
+		{ "super",		keymods_super },
+		{ "caps",		keymods_caps },
+		{ "numlk",		keymods_numlk },
+	};
+
+	// window hints
+	static constexpr py_enum_value py_window_hints_values[]
+	{
+		{ "none",					window_hints_none },
+		{ "resizable",				window_hints_resizable },
+		{ "visible",				window_hints_visible },
+		{ "decorated",				window_hints_decorated },
+		{ "focused",				window_hints_focused },
+		{ "is_auto_iconify",		window_hints_auto_iconify },
+		{ "floating",				window_hints_floating },
+		{ "maximized",				window_hints_maximized },
+		{ "doublebuffer",			window_hints_doublebuffer },
+		{ "center_cursor",			window_hints_center_cursor },
+		{ "focus_on_show",			window_hints_focus_on_show },
+		{ "default",				window_hints_default },
+		{ "default_max",			window_hints_default_max },
+	};
+
+	static constexpr py_enum_table py_enum_tables[]
+	{
+		{ "context_api", false, std::begin(py_context_api_values), std::end(py_context_api_values) },
+		{ "context_profile", false, std::begin(py_context_profile_values), std::end(py_context_profile_values) },
+		{ "cursor_mode", false, std::begin(py_cursor_mode_values), std::end(py_cursor_mode_values) },
+		{ "cursor_shape", false, std::begin(py_cursor_shape_values), std::end(py_cursor_shape_values) },
+		{ "keycode", false, std::begin(py_keycode_values), std::end(py_keycode_values) },
+		{ "keymods", true, std::begin(py_keymods_values), std::end(py_keymods_values) },
+		{ "window_hints", true, std::begin(py_window_hints_values), std::end(py_window_hints_values) },
+	};
+
+	static py::object py_make_enum(py::module & scope, py_enum_table const & table)
+	{
+		py::list members{ (size_t)(table.last - table.first) };
+		for (py_enum_value const * it = table.first; it != table.last; ++it)
+		{
+			members[(size_t)(it - table.first)] = py::make_tuple(it->name, it->value);
+		}
+		py::object const type{ py::module::import("enum").attr(table.flags ? "IntFlag" : "IntEnum")(
+			table.name, members, py::arg("module") = scope.attr("__name__")) };
+		scope.attr(table.name) = type;
+		return type;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	pybind11::object make_scene_handle(weak<scene_tree> const & value)
+	{
+		return py::cast(py_scene{ value });
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
 
 PYBIND11_EMBEDDED_MODULE(modus, m)
 {
@@ -8,13 +901,59 @@ PYBIND11_EMBEDDED_MODULE(modus, m)
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+	// main thread work from wherever the script runs
+	auto run_main = [](script_service::task fn)
+	{
+		if (script_service * const s{ ML_get_global(script_service) }) { s->run_main(std::move(fn)); }
+		else { std::invoke(fn); }
+	};
+
 	// exit
-	m.def("exit", [](py::args) { ML_get_global(core_application)->quit(); });
+	m.def("exit", [run_main](py::args) { run_main([]() { ML_get_global(core_application)->quit(); }); });
 	py::module::import("builtins").attr("exit") = m.attr("exit");
 	py::module::import("sys").attr("exit") = m.attr("exit");
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+	// scheduling
+	m	// generators step once a frame, coroutines get one event loop pass
+		.def("spawn", [](py::object o)
+		{
+			if (script_service * const s{ ML_get_global(script_service) }; s && s->is_running()) { s->spawn(o); }
+			else { throw py::value_error("scripts are not running"); }
+		})
+		// call on the main thread and wait for the result, a main scope already has it
+		.def("invoke", [](py::object fn) -> py::object
+		{
+			script_service * const s{ ML_get_global(script_service) };
+			return (s && !g_py_main_scope.depth) ? s->invoke(fn) : fn();
+		})
+		// call on the main thread next frame
+		.def("post", [run_main](py::object fn)
+		{
+			run_main([ptr = fn.release().ptr()]()
+			{
+				py::gil_scoped_acquire gil{};
+				py::object const f{ py::reinterpret_steal<py::object>(ptr) };
+				try { f(); }
+				catch (py::error_already_set const & e) { ML_log_error("python: {0}", e.what()); }
+			});
+		})
+		;
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// with main_scope(): the main thread waits between its tasks while the block runs,
+	// views made inside read engine memory in place and are emptied on the way out, keep it short
+	struct py_main_scope_guard final {};
+	py::class_<py_main_scope_guard>(m, "main_scope")
+		.def(py::init<>())
+		.def("__enter__", [](py::object self) { py_enter_main_scope(); return self; })
+		.def("__exit__", [](py_main_scope_guard &, py::args) { py_exit_main_scope(); return false; })
+		;
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 	py::class_<non_copyable, scary<non_copyable>>(m, "non_copyable");
 
 	py::class_<trackable, scary<trackable>>(m, "trackable");
@@ -52,11 +991,29 @@ PYBIND11_EMBEDDED_MODULE(modus, m)
 				else { return -1; }
 			}
 
-			void flush() noexcept { m_os.get().flush(); }
+			// the streams belong to the main thread, script output is queued for it in order
+			void flush() noexcept
+			{
+				put([os = m_os]() { os.get().flush(); });
+			}
 
-			void write(py::object o) noexcept { m_os << o; }
+			void write(py::object o) noexcept
+			{
+				put([os = m_os, s = (std::string)py::str(o)]() { os.get() << s; });
+			}
 
-			void writelines(py::list l) noexcept { for (auto const & e : l) { m_os << e; } }
+			void writelines(py::list l) noexcept
+			{
+				std::string s{};
+				for (auto const & e : l) { s += (std::string)py::str(e); }
+				put([os = m_os, s = std::move(s)]() { os.get() << s; });
+			}
+
+			static void put(script_service::task fn)
+			{
+				if (script_service * const s{ ML_get_global(script_service) }) { s->run_main(std::move(fn)); }
+				else { std::invoke(fn); }
+			}
 		};
 
 		static output cerr(py::object) noexcept { return { std::cerr }; }
@@ -89,135 +1046,107 @@ PYBIND11_EMBEDDED_MODULE(modus, m)
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	py::class_<json>(m, "json") // FIXME
+	// containers stay native until they are touched, scalars convert on the spot
+	auto json_item = [](py::object self, json & item) -> py::object
+	{
+		if (item.is_structured()) { return py::cast(&item, py::return_value_policy::reference_internal, self); }
+		return util::to_python(item);
+	};
+
+	py::class_<json>(m, "json")
 		.def(py::init<>())
 		.def(py::init<json const &>())
-		.def(py::init<py::handle>())
+		.def(py::init([](py::handle h) { return util::from_python(h); }))
 
 		.def_static("parse", [](cstring s) { return json::parse(s); })
 
 		.def("__setitem__", [](json & j, size_t k, json const & v)	{ j[k] = v; }, py::is_operator())
 		.def("__setitem__", [](json & j, cstring k, json const & v) { j[k] = v; }, py::is_operator())
-		.def("__setitem__", [](json & j, size_t k, py::handle v)	{ j[k] = v; }, py::is_operator())
-		.def("__setitem__", [](json & j, cstring k, py::handle v)	{ j[k] = v; }, py::is_operator())
+		.def("__setitem__", [](json & j, size_t k, py::handle v)	{ j[k] = util::from_python(v); }, py::is_operator())
+		.def("__setitem__", [](json & j, cstring k, py::handle v)	{ j[k] = util::from_python(v); }, py::is_operator())
+
+		.def("__getitem__", [json_item](py::object self, size_t k) { return json_item(self, self.cast<json &>()[k]); }, py::is_operator())
+		.def("__getitem__", [json_item](py::object self, cstring k) { return json_item(self, self.cast<json &>()[k]); }, py::is_operator())
 
-		.def("__getitem__", [](json & j, size_t k) -> json & { return j[k]; }, py::is_operator())
-		.def("__getitem__", [](json & j, cstring k) -> json & { return j[k]; }, py::is_operator())
+		.def("__len__"		, [](json const & j) { return j.size(); })
+		.def("__contains__"	, [](json const & j, cstring k) { return j.is_object() && (j.find(k) != j.end()); })
+		.def("keys"			, [](json const & j)
+		{
+			py::list temp{};
+			if (j.is_object()) { for (auto const & [k, v] : j.get_ref<json::object_t const &>()) { temp.append(py::str{ k }); } }
+			return temp;
+		})
+		.def("get", [json_item](py::object self, cstring k, py::object def) -> py::object
+		{
+			json & j{ self.cast<json &>() };
+			if (!j.is_object()) { return def; }
+			auto const it{ j.find(k) };
+			return (it != j.end()) ? json_item(self, *it) : def;
+		}, py::arg("key"), py::arg("default") = py::none{})
+		.def("to_python", &util::to_python)
 
-		.def("__bool__"	, [](json const & j) { return j.get<py::bool_>(); })
-		.def("__int__"	, [](json const & j) { return j.get<py::int_>(); })
-		.def("__float__", [](json const & j) { return j.get<py::float_>(); })
+		.def("__bool__"	, [](json const & j) { return py::bool_{ util::to_python(j) }; })
+		.def("__int__"	, [](json const & j) { return py::int_{ util::to_python(j) }; })
+		.def("__float__", [](json const & j) { return py::float_{ util::to_python(j) }; })
 		.def("__str__"	, [](json const & j) { return j.dump(); })
 		.def("__repr__"	, [](json const & j) { return j.dump(); })
 		;
 	m	// json
-		.def("to_json"	, [](py::handle h) { return json{ h }.dump(); })
-		.def("from_json", [](cstring s) { return json{ s }.get<py::handle>(); })
+		.def("to_json"	, [](py::handle h) { return util::from_python(h).dump(); })
+		.def("from_json", [](cstring s) { return util::to_python(json::parse(s)); })
 		;
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	// MEMORY
-
-	auto py_mem{ m.def_submodule("memory") };
+	// MEMORY, GRAPHICS
+	py_lazy_submodule(m, "memory", &py_build_memory);
+	py_lazy_submodule(m, "gfx", &py_build_gfx);
 
-	using pmr_allocator = pmr::polymorphic_allocator<byte>;
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	py::class_<pmr_allocator>(py_mem, "allocator")
-		.def(py::init<>())
-		.def(py::init([](intptr_t p) { return pmr_allocator{ (pmr::memory_resource *)p }; }))
-		.def(py::init<pmr_allocator const &>())
-		.def("allocate", [](pmr_allocator & o, size_t s) { return (intptr_t)o.allocate(s); })
-		.def("deallocate", [](pmr_allocator & o, intptr_t p, size_t s) { o.deallocate((byte *)p, s); })
-		;
+	// SCENE
 
-	py::class_<memory_record>(py_mem, "record")
-		.def(py::init<>())
-		.def(py::init<memory_record const &>())
-		.def(py::init([g = ML_get_global(memory_manager)](intptr_t p) -> memory_record
-		{
-			if (auto const i{ g->get_records().lookup<memory_manager::ID_addr>((byte *)p) }
-			; i != g->get_records().npos) {
-				return g->query_record(i);
-			} else {
-				return {};
-			}
-		}))
-		.def_property_readonly("addr", [](memory_record const & o) { return (intptr_t)o.addr; })
-		.def_readonly("index", &memory_record::index)
-		.def_readonly("count", &memory_record::count)
-		.def_readonly("size", &memory_record::size)
-		.def("__nonzero__", &memory_record::operator bool)
-		.def("__repr__", [](memory_record const & o) { return json{ o }.dump(); })
-		.def("__str__", [](memory_record const & o) { return json{ o }.dump(); })
-		;
+	static_assert(sizeof(transform_component) == 10 * sizeof(float32), "transform column must be packed floats");
 
-	auto memget = [](intptr_t p, size_t s) -> py::int_
-	{
-		switch (s)
+	// component columns are read in place inside a main scope and copied out otherwise, writes go through the main thread,
+	// the handle doesn't keep the scene alive
+	py::class_<py_scene>(m, "scene_tree")
+		.def("__bool__", [](py_scene const & self) { return !self.value.expired(); })
+		.def("entities", [](py_scene const & self)
 		{
-		default	: return 0;
-		case 1	: return *(uint8 *)p;
-		case 2	: return *(uint16 *)p;
-		case 3	: return *(uint32 *)p;
-		case 4	: return *(uint64 *)p;
-		}
-	};
-
-	py_mem // memory
-		// passthrough resource
-		.def("num_allocations", []() { return ML_get_global(memory_manager)->get_resource()->num_allocations(); })
-		.def("buffer_base", []() { return ML_get_global(memory_manager)->get_resource()->buffer_base(); })
-		.def("buffer_free", []() { return ML_get_global(memory_manager)->get_resource()->buffer_free(); })
-		.def("buffer_size", []() { return ML_get_global(memory_manager)->get_resource()->buffer_size(); })
-		.def("buffer_used", []() { return ML_get_global(memory_manager)->get_resource()->buffer_used(); })
-
-		// allocation
-		.def("malloc"	, [](size_t s) { return (intptr_t)ML_get_global(memory_manager)->allocate(s); })
-		.def("calloc"	, [](size_t c, size_t s) { return (intptr_t)ML_get_global(memory_manager)->allocate(c, s); })
-		.def("free"		, [](intptr_t p) { ML_get_global(memory_manager)->deallocate((void *)p); })
-		.def("realloc"	, [](intptr_t p, size_t s) { return (intptr_t)ML_get_global(memory_manager)->reallocate((void *)p, s); })
-		.def("realloc"	, [](intptr_t p, size_t o, size_t n) { return (intptr_t)ML_get_global(memory_manager)->reallocate((void *)p, o, n); })
-
-		// getters
-		.def("memget"	, [&memget](intptr_t p) { return memget(p, 1); })
-		.def("memget"	, [&memget](intptr_t p, size_t s) { return memget(p, s); })
-		.def("memget"	, [&memget](intptr_t p, size_t s, size_t n)
+			py_require("modus.memory");
+			return py_engine_view<std::underlying_type_t<entt::entity>>(1, [&self]()
+			{
+				auto const view{ self.lock()->get_reg().view<transform_component>() };
+				return std::make_pair((std::underlying_type_t<entt::entity> const *)view.data(), view.size());
+			});
+		})
+		.def("transforms", [](py_scene const & self)
 		{
-			py::list temp{};
-			for (intptr_t first = p, last = p + (ptrdiff_t)(s * n); first != last; ++first)
+			py_require("modus.memory");
+			// position xyz, euler angles xyz with w unused, scale xyz, in the order of entities()
+			return py_engine_view<float32>(10, [&self]()
 			{
-				temp.append(memget(first, s));
-			}
-			return temp;
+				auto const view{ self.lock()->get_reg().view<transform_component>() };
+				return std::make_pair((float32 const *)view.raw(), view.size() * 10);
+			});
+		})
+		.def("set_transforms", [](py_scene const & self, py::buffer const & b)
+		{
+			// rows laid out like transforms(), written back in one go
+			py::buffer_info const info{ b.request() };
+			bool const typed{ info.itemsize == sizeof(float32) && info.format == py::format_descriptor<float32>::format() };
+			bool const dense{ info.ndim == 2 && info.shape[1] == 10 && info.strides[1] == sizeof(float32) && info.strides[0] == 10 * sizeof(float32) };
+			if (!typed || !dense) { throw py::value_error{ "expected a contiguous float32 array shaped like transforms()" }; }
+			bool const written{ py_main_call([&self, &info]()
+			{
+				auto view{ self.lock()->get_reg().view<transform_component>() };
+				if (info.shape[0] != (py::ssize_t)view.size()) { return false; }
+				std::memcpy(view.raw(), info.ptr, view.size() * sizeof(transform_component));
+				return true;
+			}) };
+			if (!written) { throw py::value_error{ "row count doesn't match transforms()" }; }
 		})
-		.def("strget"	, [](intptr_t p) { return (cstring)p; })
-		.def("strget"	, [](intptr_t l, intptr_t r) { return std::string{ (cstring)l, (cstring)r }; })
-
-		// memchr
-		.def("memchr"	, [](intptr_t p, int32 v, size_t n) { return (intptr_t)std::memchr((void *)p, v, n); })
-		// memcmp
-		.def("memcmp"	, [](intptr_t l, intptr_t r, size_t n) { return std::memcmp((void *)l, (void *)r, n); })
-		// memcpy
-		.def("memcpy"	, [](intptr_t d, intptr_t s, size_t n) { return (intptr_t)std::memcpy((void *)d, (void *)s, n); })
-		// memmove
-		.def("memmove"	, [](intptr_t d, intptr_t s, size_t n) { return (intptr_t)std::memmove((void *)d, (void *)s, n); })
-		// memset
-		.def("memset"	, [](intptr_t d, int32 v, size_t n) { return (intptr_t)std::memset((void *)d, v, n); })
-		// strcpy
-		.def("strcpy"	, [](intptr_t d, intptr_t s) { return (intptr_t)std::strcpy((char *)d, (char *)s); })
-		.def("strcpy"	, [](intptr_t d, cstring s) { return (intptr_t)std::strcpy((char *)d, s); })
-		// strncpy
-		.def("strncpy"	, [](intptr_t d, intptr_t s, size_t n) { return (intptr_t)std::strncpy((char *)d, (char *)s, n); })
-		.def("strncpy"	, [](intptr_t d, cstring s, size_t n) { return (intptr_t)std::strncpy((char *)d, s, n); })
-		// strcat
-		.def("strcat"	, [](intptr_t d, intptr_t s) { return (intptr_t)std::strcat((char *)d, (char *)s); })
-		.def("strcat"	, [](intptr_t d, cstring s) { return (intptr_t)std::strcat((char *)d, s); })
-		// strncat
-		.def("strncat"	, [](intptr_t d, intptr_t s, size_t n) { return (intptr_t)std::strncat((char *)d, (char *)s, n); })
-		.def("strncat"	, [](intptr_t d, cstring s, size_t n) { return (intptr_t)std::strncat((char *)d, s, n); })
-		// strlen
-		.def("strlen"	, [](intptr_t p) { return std::strlen((cstring)p); })
 		;
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -241,192 +1170,17 @@ PYBIND11_EMBEDDED_MODULE(modus, m)
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	// CONTEXT API
-	py::class_<context_api_>(m, "context_api")
-		.def_property_readonly_static("unknown"	, [](py::object) { return (int32)context_api_unknown; })
-		.def_property_readonly_static("opengl"	, [](py::object) { return (int32)context_api_opengl; })
-		.def_property_readonly_static("vulkan"	, [](py::object) { return (int32)context_api_vulkan; })
-		.def_property_readonly_static("directx"	, [](py::object) { return (int32)context_api_directx; })
-		;
-
-	// CONTEXT PROFILE
-	py::class_<context_profile_>(m, "context_profile")
-		.def_property_readonly_static("any"			, [](py::object) { return (int32)context_profile_any; })
-		.def_property_readonly_static("core"		, [](py::object) { return (int32)context_profile_core; })
-		.def_property_readonly_static("compat"		, [](py::object) { return (int32)context_profile_compat; })
-		.def_property_readonly_static("debug"		, [](py::object) { return (int32)context_profile_debug; })
-		;
-
-	// CURSOR MODE
-	py::class_<cursor_mode_>(m, "cursor_mode")
-		.def_property_readonly_static("normal"		, [](py::object) { return (int32)cursor_mode_normal; })
-		.def_property_readonly_static("hidden"		, [](py::object) { return (int32)cursor_mode_hidden; })
-		.def_property_readonly_static("disabled"	, [](py::object) { return (int32)cursor_mode_disabled; })
-		;
-
-	// CURSOR SHAPE
-	py::class_<cursor_shape_>(m, "cursor_shape")
-		.def_property_readonly_static("arrow"		, [](py::object) { return (int32)cursor_shape_arrow; })
-		.def_property_readonly_static("ibeam"		, [](py::object) { return (int32)cursor_shape_ibeam; })
-		.def_property_readonly_static("crosshair"	, [](py::object) { return (int32)cursor_shape_crosshair; })
-		.def_property_readonly_static("hand"		, [](py::object) { return (int32)cursor_shape_hand; })
-		.def_property_readonly_static("ew"			, [](py::object) { return (int32)cursor_shape_ew; })
-		.def_property_readonly_static("ns"			, [](py::object) { return (int32)cursor_shape_ns; })
-		.def_property_readonly_static("nesw"		, [](py::object) { return (int32)cursor_shape_nesw; })
-		.def_property_readonly_static("nwse"		, [](py::object) { return (int32)cursor_shape_nwse; })
-		;
-
-	// KEY CODE
-	py::class_<keycode_>(m, "keycode")
-		.def_property_readonly_static("space"			, [](py::object) { return (int32)keycode_space; })
-		.def_property_readonly_static("apostrophe"		, [](py::object) { return (int32)keycode_apostrophe; })
-		.def_property_readonly_static("comma"			, [](py::object) { return (int32)keycode_comma; })
-		.def_property_readonly_static("minus"			, [](py::object) { return (int32)keycode_minus; })
-		.def_property_readonly_static("period"			, [](py::object) { return (int32)keycode_period; })
-		.def_property_readonly_static("slash"			, [](py::object) { return (int32)keycode_slash; })
-		.def_property_readonly_static("num_0"			, [](py::object) { return (int32)keycode_num_0; })
-		.def_property_readonly_static("num_1"			, [](py::object) { return (int32)keycode_num_1; })
-		.def_property_readonly_static("num_2"			, [](py::object) { return (int32)keycode_num_2; })
-		.def_property_readonly_static("num_3"			, [](py::object) { return (int32)keycode_num_3; })
-		.def_property_readonly_static("num_4"			, [](py::object) { return (int32)keycode_num_4; })
-		.def_property_readonly_static("num_5"			, [](py::object) { return (int32)keycode_num_5; })
-		.def_property_readonly_static("num_6"			, [](py::object) { return (int32)keycode_num_6; })
-		.def_property_readonly_static("num_7"			, [](py::object) { return (int32)keycode_num_7; })
-		.def_property_readonly_static("num_8"			, [](py::object) { return (int32)keycode_num_8; })
-		.def_property_readonly_static("num_9"			, [](py::object) { return (int32)keycode_num_9; })
-		.def_property_readonly_static("semicolon"		, [](py::object) { return (int32)keycode_semicolon; })
-		.def_property_readonly_static("equal"			, [](py::object) { return (int32)keycode_equal; })
-		.def_property_readonly_static("a"				, [](py::object) { return (int32)keycode_a; })
-		.def_property_readonly_static("b"				, [](py::object) { return (int32)keycode_b; })
-		.def_property_readonly_static("c"				, [](py::object) { return (int32)keycode_c; })
-		.def_property_readonly_static("d"				, [](py::object) { return (int32)keycode_d; })
-		.def_property_readonly_static("e"				, [](py::object) { return (int32)keycode_e; })
-		.def_property_readonly_static("f"				, [](py::object) { return (int32)keycode_f; })
-		.def_property_readonly_static("g"				, [](py::object) { return (int32)keycode_g; })
-		.def_property_readonly_static("h"				, [](py::object) { return (int32)keycode_h; })
-		.def_property_readonly_static("i"				, [](py::object) { return (int32)keycode_i; })
-		.def_property_readonly_static("j"				, [](py::object) { return (int32)keycode_j; })
-		.def_property_readonly_static("k"				, [](py::object) { return (int32)keycode_k; })
-		.def_property_readonly_static("l"				, [](py::object) { return (int32)keycode_l; })
-		.def_property_readonly_static("m"				, [](py::object) { return (int32)keycode_m; })
-		.def_property_readonly_static("n"				, [](py::object) { return (int32)keycode_n; })
-		.def_property_readonly_static("o"				, [](py::object) { return (int32)keycode_o; })
-		.def_property_readonly_static("p"				, [](py::object) { return (int32)keycode_p; })
-		.def_property_readonly_static("q"				, [](py::object) { return (int32)keycode_q; })
-		.def_property_readonly_static("r"				, [](py::object) { return (int32)keycode_r; })
-		.def_property_readonly_static("s"				, [](py::object) { return (int32)keycode_s; })
-		.def_property_readonly_static("t"				, [](py::object) { return (int32)keycode_t; })
-		.def_property_readonly_static("u"				, [](py::object) { return (int32)keycode_u; })
-		.def_property_readonly_static("v"				, [](py::object) { return (int32)keycode_v; })
-		.def_property_readonly_static("w"				, [](py::object) { return (int32)keycode_w; })
-		.def_property_readonly_static("x"				, [](py::object) { return (int32)keycode_x; })
-		.def_property_readonly_static("y"				, [](py::object) { return (int32)keycode_y; })
-		.def_property_readonly_static("z"				, [](py::object) { return (int32)keycode_z; })
-		.def_property_readonly_static("left_bracket"	, [](py::object) { return (int32)keycode_left_bracket; })
-		.def_property_readonly_static("backslash"		, [](py::object) { return (int32)keycode_backslash; })
-		.def_property_readonly_static("right_bracket"	, [](py::object) { return (int32)keycode_right_bracket; })
-		.def_property_readonly_static("grave_accent"	, [](py::object) { return (int32)keycode_grave_accent; })
-		.def_property_readonly_static("world_1"			, [](py::object) { return (int32)keycode_world_1; })
-		.def_property_readonly_static("world_2"			, [](py::object) { return (int32)keycode_world_2; })
-		.def_property_readonly_static("escape"			, [](py::object) { return (int32)keycode_escape; })
-		.def_property_readonly_static("enter"			, [](py::object) { return (int32)keycode_enter; })
-		.def_property_readonly_static("tab"				, [](py::object) { return (int32)keycode_tab; })
-		.def_property_readonly_static("backspace"		, [](py::object) { return (int32)keycode_backspace; })
-		.def_property_readonly_static("insert"			, [](py::object) { return (int32)keycode_insert; })
-		.def_property_readonly_static("del"				, [](py::object) { return (int32)keycode_del; })
-		.def_property_readonly_static("right"			, [](py::object) { return (int32)keycode_right; })
-		.def_property_readonly_static("left"			, [](py::object) { return (int32)keycode_left; })
-		.def_property_readonly_static("down"			, [](py::object) { return (int32)keycode_down; })
-		.def_property_readonly_static("up"				, [](py::object) { return (int32)keycode_up; })
-		.def_property_readonly_static("page_up"			, [](py::object) { return (int32)keycode_page_up; })
-		.def_property_readonly_static("page_down"		, [](py::object) { return (int32)keycode_page_down; })
-		.def_property_readonly_static("home"			, [](py::object) { return (int32)keycode_home; })
-		.def_property_readonly_static("end"				, [](py::object) { return (int32)keycode_end; })
-		.def_property_readonly_static("caps_lock"		, [](py::object) { return (int32)keycode_caps_lock; })
-		.def_property_readonly_static("scroll_lock"		, [](py::object) { return (int32)keycode_scroll_lock; })
-		.def_property_readonly_static("num_lock"		, [](py::object) { return (int32)keycode_num_lock; })
-		.def_property_readonly_static("print_screen"	, [](py::object) { return (int32)keycode_print_screen; })
-		.def_property_readonly_static("pause"			, [](py::object) { return (int32)keycode_pause; })
-		.def_property_readonly_static("fn_1"			, [](py::object) { return (int32)keycode_fn_1; })
-		.def_property_readonly_static("fn_2"			, [](py::object) { return (int32)keycode_fn_2; })
-		.def_property_readonly_static("fn_3"			, [](py::object) { return (int32)keycode_fn_3; })
-		.def_property_readonly_static("fn_4"			, [](py::object) { return (int32)keycode_fn_4; })
-		.def_property_readonly_static("fn_5"			, [](py::object) { return (int32)keycode_fn_5; })
-		.def_property_readonly_static("fn_6"			, [](py::object) { return (int32)keycode_fn_6; })
-		.def_property_readonly_static("fn_7"			, [](py::object) { return (int32)keycode_fn_7; })
-		.def_property_readonly_static("fn_8"			, [](py::object) { return (int32)keycode_fn_8; })
-		.def_property_readonly_static("fn_9"			, [](py::object) { return (int32)keycode_fn_9; })
-		.def_property_readonly_static("fn_10"			, [](py::object) { return (int32)keycode_fn_10; })
-		.def_property_readonly_static("fn_11"			, [](py::object) { return (int32)keycode_fn_11; })
-		.def_property_readonly_static("fn_12"			, [](py::object) { return (int32)keycode_fn_12; })
-		.def_property_readonly_static("fn_13"			, [](py::object) { return (int32)keycode_fn_13; })
-		.def_property_readonly_static("fn_14"			, [](py::object) { return (int32)keycode_fn_14; })
-		.def_property_readonly_static("fn_15"			, [](py::object) { return (int32)keycode_fn_15; })
-		.def_property_readonly_static("fn_16"			, [](py::object) { return (int32)keycode_fn_16; })
-		.def_property_readonly_static("fn_17"			, [](py::object) { return (int32)keycode_fn_17; })
-		.def_property_readonly_static("fn_18"			, [](py::object) { return (int32)keycode_fn_18; })
-		.def_property_readonly_static("fn_19"			, [](py::object) { return (int32)keycode_fn_19; })
-		.def_property_readonly_static("fn_20"			, [](py::object) { return (int32)keycode_fn_20; })
-		.def_property_readonly_static("fn_21"			, [](py::object) { return (int32)keycode_fn_21; })
-		.def_property_readonly_static("fn_22"			, [](py::object) { return (int32)keycode_fn_22; })
-		.def_property_readonly_static("fn_23"			, [](py::object) { return (int32)keycode_fn_23; })
-		.def_property_readonly_static("fn_24"			, [](py::object) { return (int32)keycode_fn_24; })
-		.def_property_readonly_static("fn_25"			, [](py::object) { return (int32)keycode_fn_25; })
-		.def_property_readonly_static("kp_0"			, [](py::object) { return (int32)keycode_kp_0; })
-		.def_property_readonly_static("kp_1"			, [](py::object) { return (int32)keycode_kp_1; })
-		.def_property_readonly_static("kp_2"			, [](py::object) { return (int32)keycode_kp_2; })
-		.def_property_readonly_static("kp_3"			, [](py::object) { return (int32)keycode_kp_3; })
-		.def_property_readonly_static("kp_4"			, [](py::object) { return (int32)keycode_kp_4; })
-		.def_property_readonly_static("kp_5"			, [](py::object) { return (int32)keycode_kp_5; })
-		.def_property_readonly_static("kp_6"			, [](py::object) { return (int32)keycode_kp_6; })
-		.def_property_readonly_static("kp_7"			, [](py::object) { return (int32)keycode_kp_7; })
-		.def_property_readonly_static("kp_8"			, [](py::object) { return (int32)keycode_kp_8; })
-		.def_property_readonly_static("kp_9"			, [](py::object) { return (int32)keycode_kp_9; })
-		.def_property_readonly_static("kp_decimal"		, [](py::object) { return (int32)keycode_kp_decimal; })
-		.def_property_readonly_static("kp_divide"		, [](py::object) { return (int32)keycode_kp_divide; })
-		.def_property_readonly_static("kp_multiply"		, [](py::object) { return (int32)keycode_kp_multiply; })
-		.def_property_readonly_static("kp_subtract"		, [](py::object) { return (int32)keycode_kp_subtract; })
-		.def_property_readonly_static("kp_add"			, [](py::object) { return (int32)keycode_kp_add; })
-		.def_property_readonly_static("kp_enter"		, [](py::object) { return (int32)keycode_kp_enter; })
-		.def_property_readonly_static("kp_equal"		, [](py::object) { return (int32)keycode_kp_equal; })
-		.def_property_readonly_static("left_shift"		, [](py::object) { return (int32)keycode_left_shift; })
-		.def_property_readonly_static("left_control"	, [](py::object) { return (int32)keycode_left_ctrl; })
-		.def_property_readonly_static("left_alt"		, [](py::object) { return (int32)keycode_left_alt; })
-		.def_property_readonly_static("left_super"		, [](py::object) { return (int32)keycode_left_super; })
-		.def_property_readonly_static("right_shift"		, [](py::object) { return (int32)keycode_right_shift; })
-		.def_property_readonly_static("right_control"	, [](py::object) { return (int32)keycode_right_ctrl; })
-		.def_property_readonly_static("right_alt"		, [](py::object) { return (int32)keycode_right_alt; })
-		.def_property_readonly_static("right_super"		, [](py::object) { return (int32)keycode_right_super; })
-		.def_property_readonly_static("menu"			, [](py::object) { return (int32)keycode_menu; })
-		;
-
-	// KEY MODS
-	py::class_<keymods_>(m, "keymods")
-		.def_property_readonly_static("none", [](py::object) { return (int32)keymods_none; })
-		.def_property_readonly_static("shift", [](py::object) { return (int32)keymods_shift; })
-		.def_property_readonly_static("ctrl", [](py::object) { return (int32)keymods_ctrl; })
-		.def_property_readonly_static("alt", [](py::object) { return (int32)keymods_alt; })
-		.def_property_readonly_static("super", [](py::object) { return (int32)keymods_super; })
-		.def_property_readonly_static("caps", [](py::object) { return (int32)keymods_caps; })
-		.def_property_readonly_static("numlk", [](py::object) { return (int32)keymods_numlk; })
-		;
-
-	// WINDOW HINTS
-	py::class_<window_hints_>(m, "window_hints")
-		.def_property_readonly_static("none"			, [](py::object) { return (int32)window_hints_none; })
-		.def_property_readonly_static("resizable"		, [](py::object) { return (int32)window_hints_resizable; })
-		.def_property_readonly_static("visible"			, [](py::object) { return (int32)window_hints_visible; })
-		.def_property_readonly_static("decorated"		, [](py::object) { return (int32)window_hints_decorated; })
-		.def_property_readonly_static("focused"			, [](py::object) { return (int32)window_hints_focused; })
-		.def_property_readonly_static("is_auto_iconify"	, [](py::object) { return (int32)window_hints_auto_iconify; })
-		.def_property_readonly_static("floating"		, [](py::object) { return (int32)window_hints_floating; })
-		.def_property_readonly_static("maximized"		, [](py::object) { return (int32)window_hints_maximized; })
-		.def_property_readonly_static("doublebuffer"	, [](py::object) { return (int32)window_hints_doublebuffer; })
-		.def_property_readonly_static("center_cursor"	, [](py::object) { return (int32)window_hints_center_cursor; })
-		.def_property_readonly_static("focus_on_show"	, [](py::object) { return (int32)window_hints_focus_on_show; })
-		.def_property_readonly_static("default"			, [](py::object) { return (int32)window_hints_default; })
-		.def_property_readonly_static("default_max"		, [](py::object) { return (int32)window_hints_default_max; })
-		;
+	// ENUMS
+	m.attr("__getattr__") = py::cpp_function([ptr = m.ptr()](std::string const & name) -> py::object
+	{
+		py::module scope{ py::reinterpret_borrow<py::module>(ptr) };
+		for (py_enum_table const & table : py_enum_tables)
+		{
+			if (name == table.name) { return py_make_enum(scope, table); }
+		}
+		PyErr_Format(PyExc_AttributeError, "module 'modus' has no attribute '%s'", name.c_str());
+		throw py::error_already_set{};
+	});
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
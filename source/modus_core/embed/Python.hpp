@@ -16,6 +16,29 @@
 #include <pybind11/functional.h>
 #include <pybind11/iostream.h>
 
+// json conversion
+namespace ml::util
+{
+	// builds python objects straight from json, containers are created at their final size
+	ML_NODISCARD ML_CORE_API pybind11::object to_python(json const & value);
+
+	// walks python objects straight into json, unknown types go through the json module
+	ML_NODISCARD ML_CORE_API json from_python(pybind11::handle value);
+
+	// runs a script from its compiled form in cache_dir while the source hash matches,
+	// compiling and storing it otherwise, an empty cache_dir always compiles
+	ML_CORE_API void eval_file_cached(fs::path const & path, fs::path const & cache_dir, pybind11::object global);
+}
+
+// scene handles
+namespace ml
+{
+	struct scene_tree;
+
+	// what scripts hold on to for a scene, calls raise once it's gone instead of reaching freed memory
+	ML_NODISCARD ML_CORE_API pybind11::object make_scene_handle(weak<scene_tree> const & value);
+}
+
 namespace pybind11
 {
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -39,13 +62,19 @@ namespace pybind11
 	// to json
 	static void to_json(_ML json & j, handle const & v)
 	{
-		j = _ML json::parse((std::string)(str)module::import("json").attr("dumps")(v));
+		j = _ML util::from_python(v);
 	}
 
-	// from json
+	// from json, the handle owns the new reference
 	static void from_json(_ML json const & j, handle & v)
 	{
-		v = module::import("json").attr("loads")(j.dump());
+		v = _ML util::to_python(j).release();
+	}
+
+	// from json
+	static void from_json(_ML json const & j, object & v)
+	{
+		v = _ML util::to_python(j);
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
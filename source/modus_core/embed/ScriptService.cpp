@@ -0,0 +1,347 @@
+#include <modus_core/embed/ScriptService.hpp>
+#include <modus_core/system/Logger.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	script_service::script_service(allocator_type alloc)
+		: m_alloc			{ alloc }
+		, m_thread			{}
+		, m_main_id			{}
+		, m_main_state		{}
+		, m_thread_ident	{}
+		, m_budget			{ 0.002f }
+		, m_wake_main		{}
+		, m_cache_path		{}
+		, m_mutex			{}
+		, m_wake			{}
+		, m_queue			{ get_shared_resource() } // both threads allocate in the queues
+		, m_main_queue		{ get_shared_resource() }
+		, m_tick			{}
+		, m_exiting			{}
+		, m_stop			{}
+		, m_exited			{}
+		, m_main_tasks		{ get_shared_resource() }
+		, m_main_next		{}
+		, m_main_time		{}
+		, m_routines		{ get_shared_resource() }
+		, m_cursor			{}
+		, m_loop			{}
+		, m_executed		{}
+		, m_main_executed	{}
+		, m_routine_count	{}
+	{
+	}
+
+	script_service::~script_service() noexcept
+	{
+		stop();
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	bool script_service::start(json const & settings)
+	{
+		if (is_running() || !Py_IsInitialized() || !PyGILState_Check()) { return false; }
+
+		m_budget = duration{ settings.value("frame_budget", m_budget.count()) };
+
+		// a short switch interval hands the gil back quickly when the main thread asks for it
+		py::module::import("sys").attr("setswitchinterval")(settings.value("switch_interval", 0.001));
+
+		m_main_id = std::this_thread::get_id();
+		m_stop.store(false, std::memory_order_release);
+		m_exiting = false;
+		m_exited.store(false, std::memory_order_release);
+		m_thread = std::thread{ &script_service::worker_main, this };
+		m_main_state = PyEval_SaveThread();
+		return true;
+	}
+
+	void script_service::stop() noexcept
+	{
+		if (!is_running()) { return; }
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_stop.store(true, std::memory_order_release);
+		}
+		m_wake.notify_one();
+
+		// a script stuck in a loop never looks at the flag, raise SystemExit in it instead
+		PyEval_RestoreThread(m_main_state);
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			if (!m_exiting && m_thread_ident) { PyThreadState_SetAsyncExc((unsigned long)m_thread_ident, PyExc_SystemExit); }
+		}
+		m_main_state = PyEval_SaveThread();
+
+		// the script thread may be waiting on the main queue, keep serving it until it leaves
+		while (!m_exited.load(std::memory_order_acquire))
+		{
+			update();
+			std::this_thread::yield();
+		}
+		m_thread.join();
+		PyEval_RestoreThread(m_main_state);
+		m_main_state = nullptr;
+
+		// main tasks only hold raw references, whatever is left is dropped
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		m_queue.clear();
+		m_main_queue.clear();
+		m_main_tasks.clear();
+		m_main_next = 0;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void script_service::post(task fn)
+	{
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_queue.push_back(std::move(fn));
+		}
+		m_wake.notify_one();
+	}
+
+	void script_service::post_main(task fn)
+	{
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_main_queue.push_back(std::move(fn));
+		}
+		if (m_wake_main) { std::invoke(m_wake_main); }
+	}
+
+	void script_service::run_main(task fn)
+	{
+		if (!is_running() || is_main_thread()) { std::invoke(fn); }
+		else { post_main(std::move(fn)); }
+	}
+
+	void script_service::exec(string const & code)
+	{
+		post([code = std::string{ code }]() { py::exec(code); });
+	}
+
+	void script_service::run_file(fs::path const & path)
+	{
+		post([this, path]() { util::eval_file_cached(path, m_cache_path, py::globals()); });
+	}
+
+	void script_service::spawn(py::object value)
+	{
+		// the reference travels raw, the task may be copied without the gil
+		post([this, ptr = value.release().ptr()]()
+		{
+			py::object const obj{ py::reinterpret_steal<py::object>(ptr) };
+			if (py::hasattr(obj, "__await__"))
+			{
+				py::module const asyncio{ py::module::import("asyncio") };
+				if (!m_loop) { m_loop = asyncio.attr("new_event_loop")(); }
+				asyncio.attr("ensure_future")(obj, py::arg("loop") = m_loop);
+			}
+			else if (PyIter_Check(ptr))
+			{
+				m_routines.push_back(obj);
+				m_routine_count.fetch_add(1, std::memory_order_relaxed);
+			}
+			else
+			{
+				throw py::type_error("spawn expects a generator or a coroutine");
+			}
+		});
+	}
+
+	py::object script_service::invoke(py::object fn)
+	{
+		if (!is_running() || is_main_thread()) { return fn(); }
+
+		std::promise<PyObject *> result{};
+		std::future<PyObject *> future{ result.get_future() };
+		post_main([&result, ptr = fn.ptr()]()
+		{
+			py::gil_scoped_acquire gil{};
+			try { result.set_value(py::reinterpret_borrow<py::object>(ptr)().release().ptr()); }
+			catch (...) { result.set_exception(std::current_exception()); }
+		});
+		{
+			// stop keeps the main queue moving, this can't outlive the service
+			py::gil_scoped_release nogil{};
+			future.wait();
+		}
+		return py::reinterpret_steal<py::object>(future.get());
+	}
+
+	void script_service::call_main(task const & fn)
+	{
+		if (!is_running() || is_main_thread()) { std::invoke(fn); return; }
+
+		std::promise<void> done{};
+		std::future<void> future{ done.get_future() };
+		post_main([&done, &fn]()
+		{
+			try { std::invoke(fn); done.set_value(); }
+			catch (...) { done.set_exception(std::current_exception()); }
+		});
+		{
+			py::gil_scoped_release nogil{};
+			future.wait();
+		}
+		future.get();
+	}
+
+	void script_service::update()
+	{
+		if (!is_running()) { return; }
+
+		// routines step on the script thread while we work through our queue
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_tick = true;
+		}
+		m_wake.notify_one();
+
+		timer const t{ true };
+		run_main_tasks(m_budget);
+		m_main_time = t.elapsed();
+	}
+
+	void script_service::drain()
+	{
+		if (!is_running() || !is_main_thread()) { return; }
+
+		// a marker behind everything queued, main work posted ahead of it is served while we wait
+		std::atomic<bool> done{};
+		post([&done]() { done.store(true, std::memory_order_release); });
+		while (!done.load(std::memory_order_acquire) && !m_exited.load(std::memory_order_acquire))
+		{
+			run_main_tasks(duration{});
+			std::this_thread::yield();
+		}
+		run_main_tasks(duration{});
+	}
+
+	script_service::stats script_service::get_stats() const noexcept
+	{
+		return {
+			m_executed.load(std::memory_order_relaxed),
+			m_main_executed.load(std::memory_order_relaxed),
+			m_routine_count.load(std::memory_order_relaxed),
+			m_main_time
+		};
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void script_service::worker_main()
+	{
+		py::gil_scoped_acquire gil{};
+		m_thread_ident = (uint64)PyThread_get_thread_ident();
+
+		list<task> tasks{ get_shared_resource() };
+		while (true)
+		{
+			bool tick{};
+			{
+				// nothing here touches python, let the main thread have it
+				py::gil_scoped_release nogil{};
+				std::unique_lock<std::mutex> lock{ m_mutex };
+				m_wake.wait(lock, [&]() { return m_stop.load(std::memory_order_acquire) || !m_queue.empty() || m_tick; });
+				if (m_stop.load(std::memory_order_acquire)) { break; }
+				tasks.swap(m_queue);
+				tick = std::exchange(m_tick, false);
+			}
+			for (task const & fn : tasks)
+			{
+				if (m_stop.load(std::memory_order_acquire)) { break; }
+				run_task(fn);
+			}
+			tasks.clear();
+			if (tick && !m_stop.load(std::memory_order_acquire)) { step_routines(); }
+		}
+
+		// stop can't raise in us past this point, clear anything it already raised
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_exiting = true;
+		}
+		PyThreadState_SetAsyncExc((unsigned long)m_thread_ident, nullptr);
+
+		tasks.clear();
+		m_routines.clear();
+		m_cursor = 0;
+		if (m_loop)
+		{
+			try { m_loop.attr("close")(); }
+			catch (py::error_already_set const & e) { ML_log_error("python: {0}", e.what()); }
+			m_loop = {};
+		}
+		m_routine_count.store(0, std::memory_order_relaxed);
+		m_exited.store(true, std::memory_order_release);
+	}
+
+	void script_service::run_task(task const & fn)
+	{
+		try
+		{
+			std::invoke(fn);
+			m_executed.fetch_add(1, std::memory_order_relaxed);
+		}
+		catch (py::error_already_set const & e)
+		{
+			if (!m_stop.load(std::memory_order_acquire)) { ML_log_error("python: {0}", e.what()); }
+		}
+		catch (std::exception const & e)
+		{
+			ML_log_error("python: {0}", e.what());
+		}
+	}
+
+	void script_service::step_routines()
+	{
+		// round robin within the budget, whoever misses out goes first next frame
+		timer const t{ true };
+		size_t const count{ m_routines.size() };
+		for (size_t n = 0; n < count && t.elapsed() < m_budget; ++n)
+		{
+			if (m_cursor >= m_routines.size()) { m_cursor = 0; }
+			py::object const next{ py::reinterpret_steal<py::object>(PyIter_Next(m_routines[m_cursor].ptr())) };
+			if (next) { ++m_cursor; continue; }
+			if (PyErr_Occurred())
+			{
+				py::error_already_set const e{};
+				if (!m_stop.load(std::memory_order_acquire)) { ML_log_error("python: {0}", e.what()); }
+			}
+			m_routines.erase(m_routines.begin() + (ptrdiff_t)m_cursor);
+			m_routine_count.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		// one pass of the event loop, ready tasks run and the rest wait for a later frame
+		if (m_loop)
+		{
+			try
+			{
+				m_loop.attr("call_soon")(m_loop.attr("stop"));
+				m_loop.attr("run_forever")();
+			}
+			catch (py::error_already_set const & e)
+			{
+				if (!m_stop.load(std::memory_order_acquire)) { ML_log_error("python: {0}", e.what()); }
+			}
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// global script service
+namespace ml::globals
+{
+	static script_service * g_script_service{};
+
+	ML_impl_global(script_service) get_global() { return g_script_service; }
+
+	ML_impl_global(script_service) set_global(script_service * value) { return g_script_service = value; }
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#ifndef _ML_SCRIPT_SERVICE_HPP_
+#define _ML_SCRIPT_SERVICE_HPP_
+
+#include <modus_core/embed/Python.hpp>
+#include <modus_core/detail/Method.hpp>
+
+namespace ml
+{
+	// runs python on its own thread so slow scripts don't stall the frame,
+	// the main thread gives up the gil while the service is running
+	struct ML_CORE_API script_service final : non_copyable, trackable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		using allocator_type = typename pmr::polymorphic_allocator<byte>;
+
+		using task = typename method<void()>;
+
+		struct ML_NODISCARD stats final
+		{
+			size_t		executed, main_executed, routines;	// script tasks run, main tasks run, routines alive
+			duration	main_time;							// spent on main tasks last update
+		};
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		explicit script_service(allocator_type alloc = {});
+
+		~script_service() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// starts the script thread, the calling thread must hold the gil and becomes the main thread
+		ML_NODISCARD bool start(json const & settings = {});
+
+		// interrupts the running script and joins, the main thread holds the gil again afterwards
+		void stop() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// queue fn() on the script thread, it runs holding the gil
+		void post(task fn);
+
+		// queue fn() for the next update, any thread
+		void post_main(task fn);
+
+		// fn() now when called from the main thread, otherwise queued for it
+		void run_main(task fn);
+
+		void exec(string const & code);
+
+		// runs the cached bytecode while the source is unchanged
+		void run_file(fs::path const & path);
+
+		// generators are resumed and coroutines get one event loop pass each frame, gil held
+		void spawn(py::object value);
+
+		// calls fn on the main thread and waits for the result with the gil released, gil held
+		ML_NODISCARD py::object invoke(py::object fn);
+
+		// invoke for engine calls, fn runs without the gil and what it throws is rethrown here, gil held
+		void call_main(task const & fn);
+
+		// main thread, once per frame, runs main tasks for up to the budget and lets routines step
+		void update();
+
+		// main thread, runs everything queued so far on both threads along with the main work it leads to,
+		// nothing posted before the call is left afterwards
+		void drain();
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD bool is_running() const noexcept { return m_thread.joinable(); }
+
+		ML_NODISCARD bool is_main_thread() const noexcept { return std::this_thread::get_id() == m_main_id; }
+
+		ML_NODISCARD bool is_script_thread() const noexcept { return std::this_thread::get_id() == m_thread.get_id(); }
+
+		// routines want a frame every frame
+		ML_NODISCARD bool has_routines() const noexcept { return 0 < m_routine_count.load(std::memory_order_relaxed); }
+
+		ML_NODISCARD auto get_budget() const noexcept -> duration { return m_budget; }
+
+		ML_NODISCARD stats get_stats() const noexcept;
+
+		void set_budget(duration value) noexcept { m_budget = value; }
+
+		// called whenever main work is queued so a blocked loop comes back for it, set before start
+		void set_wake(task fn) noexcept { m_wake_main = std::move(fn); }
+
+		// where run_file keeps compiled scripts, empty compiles every time, set before start
+		void set_cache_path(fs::path const & value) { m_cache_path = value; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		void worker_main();
+
+		void run_task(task const & fn);
+
+		// main tasks until the queue is empty or the budget is spent, a zero budget empties it
+		void run_main_tasks(duration budget);
+
+		void step_routines();
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		allocator_type			m_alloc			; // allocator
+		std::thread				m_thread		; // script thread
+		std::thread::id			m_main_id		; // thread that started us
+		PyThreadState *			m_main_state	; // main thread state while it's off the gil
+		uint64					m_thread_ident	; // script thread as python knows it
+		duration				m_budget		; // per frame time for main tasks and routines
+		task					m_wake_main		; // wakes the main loop
+		fs::path				m_cache_path	; // compiled scripts
+
+		std::mutex				m_mutex			; // queue lock
+		std::condition_variable	m_wake			; // script thread signal
+		list<task>				m_queue			; // script tasks
+		list<task>				m_main_queue	; // main tasks posted since the last swap
+		bool					m_tick			; // routines are due a step
+		bool					m_exiting		; // script thread is cleaning up
+		std::atomic<bool>		m_stop			; // shutting down
+		std::atomic<bool>		m_exited		; // script thread is done with python
+
+		list<task>				m_main_tasks	; // main tasks being worked through
+		size_t					m_main_next		; // next main task to run
+		duration				m_main_time		; // last update's main tasks
+
+		list<py::object>		m_routines		; // generators, script thread only
+		size_t					m_cursor		; // first routine to step next frame
+		py::object				m_loop			; // asyncio loop, script thread only
+
+		std::atomic<size_t>		m_executed		; // script tasks run
+		std::atomic<size_t>		m_main_executed	; // main tasks run
+		std::atomic<size_t>		m_routine_count	; // routines alive
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+// global script service
+namespace ml::globals
+{
+	ML_decl_global(script_service) get_global();
+
+	ML_decl_global(script_service) set_global(script_service *);
+}
+
+#endif // !_ML_SCRIPT_SERVICE_HPP_
\ No newline at end of file
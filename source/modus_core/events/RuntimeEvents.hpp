@@ -38,6 +38,14 @@ namespace ml
 		constexpr runtime_idle_event(gui_application * ptr) noexcept : ptr{ ptr } {}
 	};
 
+	ML_event(runtime_fixed_update_event)
+	{
+		gui_application * const ptr;
+		auto operator->() const noexcept { return ptr; }
+		auto & operator*() const noexcept { return *ML_check(ptr); }
+		constexpr runtime_fixed_update_event(gui_application * ptr) noexcept : ptr{ ptr } {}
+	};
+
 	ML_event(runtime_gui_event)
 	{
 		gui_application * const ptr;
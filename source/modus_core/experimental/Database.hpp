@@ -2,7 +2,7 @@
 #define _ML_DATABASE_HPP_
 
 #include <modus_core/detail/HashMap.hpp>
-#include <modus_core/system/Memory.hpp>
+#include <modus_core/system/StringTable.hpp>
 
 namespace ml
 {
@@ -13,7 +13,7 @@ namespace ml
 
 		using allocator_type = typename pmr::polymorphic_allocator<byte>;
 
-		using category_type = typename hash_map<string, ref<std::any>>;
+		using category_type = typename hash_map<interned_string, ref<std::any>>;
 
 		using categories_type = typename hash_map<typeof_t<>, category_type>;
 
@@ -43,15 +43,16 @@ namespace ml
 		}
 
 		// get element
-		template <class Type, class Key = string
+		template <class Type, class Key = interned_string
 		> ML_NODISCARD ref<std::any> & element(Key && key) noexcept
 		{
 			category_type & cat{ this->category<Type>() };
-			if (auto const it{ cat.find(ML_forward(key)) }
+			interned_string const name{ ML_forward(key) };
+			if (auto const it{ cat.find(name) }
 			; it != cat.end()) { return it->second; }
 			else
 			{
-				return cat[ML_forward(key)] = make_ref<std::any>
+				return cat[name] = make_ref<std::any>
 				(
 					std::make_any<Type>()
 				);
@@ -60,19 +61,19 @@ namespace ml
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-		template <class Type, class Key = string
+		template <class Type, class Key = interned_string
 		> ML_NODISCARD Type & get(Key && key) noexcept
 		{
 			return *std::any_cast<Type>(this->element<Type>(ML_forward(key)).get());
 		}
 
-		template <class Type, class Key = string, class ... Args
+		template <class Type, class Key = interned_string, class ... Args
 		> Type & emplace(Key && key, Args && ... args) noexcept
 		{
 			return this->element<Type>(ML_forward(key))->emplace<Type>(ML_forward(args)...);
 		}
 
-		template <class Type, class Key = string
+		template <class Type, class Key = interned_string
 		> category_type::iterator erase(Key && key) noexcept
 		{
 			category_type & cat{ this->category<Type>() };
@@ -132,7 +133,7 @@ namespace ml
 		}
 
 		template <class ... Args
-		> db_var(simple_database * const db, string const & name, Args && ... args)
+		> db_var(simple_database * const db, interned_string const & name, Args && ... args)
 			: m_db	{ ML_check(db) }
 			, m_name{ name }
 			, m_ptr	{ m_db->element<T>(m_name) }
@@ -175,7 +176,7 @@ namespace ml
 			if (this != std::addressof(other))
 			{
 				std::swap(m_db, other.m_db);
-				m_name.swap(other.m_name);
+				std::swap(m_name, other.m_name);
 				m_ptr.swap(other.m_ptr);
 			}
 		}
@@ -184,7 +185,7 @@ namespace ml
 
 		ML_NODISCARD auto type() const noexcept -> typeof_t<> { return typeof_v<value_type>; }
 
-		ML_NODISCARD auto name() const noexcept -> string const & { return m_name; }
+		ML_NODISCARD auto name() const noexcept -> interned_string const & { return m_name; }
 
 		ML_NODISCARD auto database() const noexcept -> simple_database * { return m_db; }
 
@@ -242,7 +243,7 @@ namespace ml
 
 	private:
 		simple_database *	m_db	; // 
-		string			m_name	; // 
+		interned_string	m_name	; // 
 		weak<std::any>	m_ptr	; // 
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
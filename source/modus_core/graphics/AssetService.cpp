@@ -0,0 +1,314 @@
+#include <modus_core/graphics/AssetService.hpp>
+#include <modus_core/system/Logger.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	asset_service::asset_service(allocator_type alloc)
+		: m_alloc		{ alloc }
+		, m_watcher		{ alloc }
+		, m_jobs		{}
+		, m_decoding	{}
+		, m_wake		{}
+		, m_next_id		{}
+		, m_assets		{ alloc }
+		, m_edges		{ alloc }
+		, m_changes		{ alloc }
+		, m_mutex		{}
+		, m_uploads		{ get_shared_resource() } // jobs push here
+		, m_frame		{ alloc }
+		, m_reloads		{}
+		, m_last		{}
+		, m_worst		{}
+	{
+	}
+
+	asset_service::~asset_service() noexcept
+	{
+		stop();
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	bool asset_service::start(json const & settings)
+	{
+		if (is_running() || !(m_jobs = ML_get_global(job_system))) { return false; }
+
+		m_watcher.set_wake([this]() { if (m_wake) { std::invoke(m_wake); } });
+
+		// editors often write a file more than once per save
+		return m_watcher.start(duration{ settings.value("debounce", 0.05f) });
+	}
+
+	void asset_service::stop() noexcept
+	{
+		if (!is_running()) { return; }
+		m_watcher.stop();
+		m_jobs->wait(m_decoding);
+
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		m_uploads.clear();
+		for (auto & [id, a] : m_assets) { a.busy = false; }
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void asset_service::watch(ref<gfx::program> const & value, fs::path const & path)
+	{
+		if (value) { add(weak<gfx::program>{ value }, path); }
+	}
+
+	void asset_service::watch(ref<gfx::texture2d> const & value, fs::path const & path)
+	{
+		if (value) { add(weak<gfx::texture2d>{ value }, path); }
+	}
+
+	void asset_service::watch(ref<mesh> const & value, fs::path const & path)
+	{
+		if (value) { add(weak<mesh>{ value }, path); }
+	}
+
+	void asset_service::watch(ref<font> const & value, fs::path const & path)
+	{
+		if (value) { add(weak<font>{ value }, path); }
+	}
+
+	size_t asset_service::update()
+	{
+		// saves mark everything built from the file, the earliest save is the one that gets timed
+		m_changes.clear();
+		m_watcher.poll(m_changes);
+		for (file_watcher::change const & e : m_changes)
+		{
+			auto const edge{ m_edges.find(hashof(e.path.string())) };
+			if (edge == m_edges.end()) { continue; }
+			for (uint64 const id : edge->second)
+			{
+				asset & a{ m_assets[id] };
+				if (!a.dirty) { a.changed = e.time; }
+				else { a.changed = ML_min(a.changed, e.time); }
+				a.dirty = true;
+			}
+		}
+
+		// objects that are gone stop being watched, the rest start decoding
+		for (auto it{ m_assets.begin() }; it != m_assets.end();)
+		{
+			asset & a{ it->second };
+			if (std::visit([](auto const & e) { return e.expired(); }, a.object) && !a.busy)
+			{
+				link(it->first, {});
+				it = m_assets.erase(it);
+				continue;
+			}
+			if (a.dirty && !a.busy) { decode(it->first); }
+			++it;
+		}
+
+		// decoded since the last update
+		list<upload> uploads{ get_shared_resource() }; // swapped with m_uploads, same resource
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			uploads.swap(m_uploads);
+		}
+		size_t count{};
+		for (upload const & u : uploads)
+		{
+			auto const it{ m_assets.find(u.id) };
+			if (it == m_assets.end()) { continue; }
+
+			asset & a{ it->second };
+			a.busy = false;
+			if (std::invoke(u.apply, a))
+			{
+				++count;
+				m_frame.push_back(u.changed);
+			}
+
+			// saved again while it was decoding
+			if (a.dirty) { decode(u.id); }
+		}
+		m_reloads += count;
+		return count;
+	}
+
+	void asset_service::end_frame()
+	{
+		if (m_frame.empty()) { return; }
+		duration const now{ m_watcher.get_time() };
+		for (duration const & changed : m_frame)
+		{
+			m_last = now - changed;
+			m_worst = ML_max(m_worst, m_last);
+			ML_log_info("assets: reload took {0} ms from save to frame", m_last.count() * 1000.f);
+		}
+		m_frame.clear();
+	}
+
+	asset_service::stats asset_service::get_stats() const noexcept
+	{
+		return { m_assets.size(), m_reloads, m_last, m_worst };
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void asset_service::add(object_type const & value, fs::path const & path)
+	{
+		uint64 const id{ ++m_next_id };
+		asset & a{ m_assets[id] };
+		a.object = value;
+		a.path = file_watcher::normalize(path);
+
+		// programs learn their includes by parsing, until then they only depend on themselves
+		list<fs::path> deps{ m_alloc };
+		if (std::holds_alternative<weak<gfx::program>>(value))
+		{
+			gfx::program_source src{};
+			(void)gfx::parse_source(a.path, src, &deps);
+		}
+		if (deps.empty()) { deps.push_back(a.path); }
+		link(id, deps);
+	}
+
+	void asset_service::link(uint64 id, list<fs::path> const & deps)
+	{
+		asset & a{ m_assets[id] };
+		for (hash_t const h : a.deps)
+		{
+			if (auto const edge{ m_edges.find(h) }; edge != m_edges.end())
+			{
+				list<uint64> & ids{ edge->second };
+				ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+				if (ids.empty()) { m_edges.erase(edge); }
+			}
+		}
+		a.deps.clear();
+		for (fs::path const & e : deps)
+		{
+			fs::path const file{ file_watcher::normalize(e) };
+			hash_t const h{ hashof(file.string()) };
+			if (std::find(a.deps.begin(), a.deps.end(), h) != a.deps.end()) { continue; }
+			a.deps.push_back(h);
+			m_edges[h].push_back(id);
+			m_watcher.watch(file);
+		}
+	}
+
+	void asset_service::decode(uint64 id)
+	{
+		asset & a{ m_assets[id] };
+		a.dirty = false;
+		a.busy = true;
+
+		// decoded data travels in refs, uploads are copied in and out of the queue,
+		// jobs build it from the shared resource while the main thread uses the default one
+		pmr::polymorphic_allocator<byte> const alloc{ get_shared_resource() };
+		fs::path const path{ a.path };
+		duration const changed{ a.changed };
+		switch (a.object.index())
+		{
+		case 0: m_jobs->run([this, id, path, changed, alloc]()
+		{
+			auto const src{ alloc_ref<gfx::program_source>(alloc) };
+			auto const deps{ alloc_ref<list<fs::path>>(alloc, alloc) };
+			bool const good{ gfx::parse_source(path, *src, deps.get(), alloc) };
+			post(id, changed, [this, id, path, src, deps, good](asset & a)
+			{
+				ref<gfx::program> const p{ std::get<weak<gfx::program>>(a.object).lock() };
+				if (!p || !good) { return false; }
+				link(id, *deps);
+
+				// built on the side, the running program is only replaced by one that compiled and linked
+				gfx::program::spec_type desc{};
+				for (size_t i = 0; i < src->size(); ++i)
+				{
+					if ((*src)[i]) { desc.source[i] = { *(*src)[i] }; }
+				}
+				ref<gfx::program> const next{ gfx::program::create(desc) };
+				bool built{ next && next->get_status() == gfx::program_status_ready };
+				for (size_t i = 0; built && i < src->size(); ++i)
+				{
+					built = !(*src)[i] || next->get_shaders()[i];
+				}
+				if (!built)
+				{
+					ML_log_error("assets: {0} failed to build, keeping the old program\n{1}", path.string(),
+						next ? next->get_info_log() : string{});
+					return false;
+				}
+				return p->swap(*next);
+			});
+		}, &m_decoding); break;
+
+		case 1: m_jobs->run([this, id, path, changed, alloc]()
+		{
+			auto const img{ alloc_ref<bitmap>(alloc, path, true, 0, alloc) };
+			post(id, changed, [img, path](asset & a)
+			{
+				ref<gfx::texture2d> const t{ std::get<weak<gfx::texture2d>>(a.object).lock() };
+				if (!t || !*img) { return false; }
+
+				// the texture keeps its format, a different channel count needs a new texture
+				if (gfx::calc_channel_format(img->channels()) != t->get_format().color)
+				{
+					ML_log_error("assets: {0} changed channel count", path.string());
+					return false;
+				}
+				t->lock();
+				t->update((vec2i)img->size(), img->data());
+				t->unlock();
+				return true;
+			});
+		}, &m_decoding); break;
+
+		case 2: m_jobs->run([this, id, path, changed, alloc]()
+		{
+			auto const verts{ alloc_ref<list<vertex>>(alloc, mesh::load_from_file(path, alloc)) };
+			post(id, changed, [verts](asset & a)
+			{
+				ref<mesh> const m{ std::get<weak<mesh>>(a.object).lock() };
+				if (!m || verts->empty()) { return false; }
+				*m = mesh{ *verts, list<uint32>{}, m->get_layout() };
+				return true;
+			});
+		}, &m_decoding); break;
+
+		case 3: m_jobs->run([this, id, path, changed, alloc]()
+		{
+			auto const next{ alloc_ref<font>(alloc, alloc) };
+			bool const good{ next->load_from_file(path) };
+			post(id, changed, [next, good](asset & a)
+			{
+				ref<font> const f{ std::get<weak<font>>(a.object).lock() };
+				if (!f || !good) { return false; }
+
+				// glyphs are rendered again on first use
+				f->swap(*next);
+				return true;
+			});
+		}, &m_decoding); break;
+		}
+	}
+
+	void asset_service::post(uint64 id, duration changed, apply_fn apply)
+	{
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_uploads.push_back({ id, changed, std::move(apply) });
+		}
+		if (m_wake) { std::invoke(m_wake); }
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// global asset service
+namespace ml::globals
+{
+	static asset_service * g_asset_service{};
+
+	ML_impl_global(asset_service) get_global() { return g_asset_service; }
+
+	ML_impl_global(asset_service) set_global(asset_service * value) { return g_asset_service = value; }
+}
\ No newline at end of file
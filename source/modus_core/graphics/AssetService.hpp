@@ -0,0 +1,142 @@
+#ifndef _ML_ASSET_SERVICE_HPP_
+#define _ML_ASSET_SERVICE_HPP_
+
+#include <modus_core/graphics/Bitmap.hpp>
+#include <modus_core/graphics/Font.hpp>
+#include <modus_core/graphics/Mesh.hpp>
+#include <modus_core/graphics/Shader.hpp>
+#include <modus_core/system/FileWatcher.hpp>
+#include <modus_core/system/JobSystem.hpp>
+
+namespace ml
+{
+	// rebuilds watched gpu objects in place when their files are saved,
+	// files are read and decoded on the job system, the main thread only uploads
+	struct ML_CORE_API asset_service final : non_copyable, trackable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		using allocator_type = typename pmr::polymorphic_allocator<byte>;
+
+		using task = typename method<void()>;
+
+		struct ML_NODISCARD stats final
+		{
+			size_t		watched, reloads;	// objects watched, objects rebuilt
+			duration	last, worst;		// file saved to frame submitted
+		};
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		explicit asset_service(allocator_type alloc = {});
+
+		~asset_service() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// starts watching, the job system global has to outlive the service
+		ML_NODISCARD bool start(json const & settings = {});
+
+		// waits for decodes in flight, pending uploads are dropped
+		void stop() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// rebuilt when the file or anything it includes changes
+		void watch(ref<gfx::program> const & value, fs::path const & path);
+
+		void watch(ref<gfx::texture2d> const & value, fs::path const & path);
+
+		void watch(ref<mesh> const & value, fs::path const & path);
+
+		void watch(ref<font> const & value, fs::path const & path);
+
+		// main thread, hands saved files to the job system and rebuilds whatever finished decoding,
+		// returns how many were rebuilt, the frame needs drawing if any were
+		size_t update();
+
+		// main thread, after the frame is submitted, reloads it picked up are timed up to here
+		void end_frame();
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD bool is_running() const noexcept { return m_watcher.is_running(); }
+
+		ML_NODISCARD stats get_stats() const noexcept;
+
+		// called whenever saves settle or a decode finishes, set before start
+		void set_wake(task fn) noexcept { m_wake = std::move(fn); }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		using object_type = typename std::variant<
+			weak<gfx::program>,
+			weak<gfx::texture2d>,
+			weak<mesh>,
+			weak<font>
+		>;
+
+		struct asset final
+		{
+			object_type		object	; // what gets rebuilt
+			fs::path		path	; // file it's loaded from
+			list<hash_t>	deps	; // files it was built from, includes too
+			duration		changed	; // earliest unhandled save, on the watcher clock
+			bool			dirty	; // saved since the last decode started
+			bool			busy	; // decode in flight
+		};
+
+		// runs on the main thread once decoding is done, false if nothing was rebuilt
+		using apply_fn = typename method<bool(asset &)>;
+
+		struct upload final
+		{
+			uint64		id		; // asset
+			duration	changed	; // save that started it
+			apply_fn	apply	; // decoded data and how to use it
+		};
+
+		void add(object_type const & value, fs::path const & path);
+
+		void link(uint64 id, list<fs::path> const & deps);
+
+		void decode(uint64 id);
+
+		void post(uint64 id, duration changed, apply_fn apply);
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		allocator_type					m_alloc		; // allocator
+		file_watcher					m_watcher	; // file changes
+		job_system *					m_jobs		; // decoders
+		job_counter						m_decoding	; // decodes in flight
+		task							m_wake		; // wakes the main loop
+
+		uint64							m_next_id	; // next asset id
+		hash_map<uint64, asset>			m_assets	; // watched objects
+		hash_map<hash_t, list<uint64>>	m_edges		; // file to the assets built from it
+		list<file_watcher::change>		m_changes	; // settled saves, scratch
+
+		std::mutex						m_mutex		; // guards uploads
+		list<upload>					m_uploads	; // decoded, waiting for the main thread
+
+		list<duration>					m_frame		; // reloads in the frame being built
+		size_t							m_reloads	; // objects rebuilt
+		duration						m_last		; // latest reload latency
+		duration						m_worst		; // worst reload latency
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+// global asset service
+namespace ml::globals
+{
+	ML_decl_global(asset_service) get_global();
+
+	ML_decl_global(asset_service) set_global(asset_service *);
+}
+
+#endif // !_ML_ASSET_SERVICE_HPP_
\ No newline at end of file
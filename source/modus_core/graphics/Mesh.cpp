@@ -14,7 +14,7 @@ namespace ml
 {
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	list<vertex> mesh::load_from_file(fs::path const & path)
+	list<vertex> mesh::load_from_file(fs::path const & path, pmr::polymorphic_allocator<byte> alloc)
 	{
 		return load_from_file(path,
 			aiProcess_CalcTangentSpace |
@@ -22,14 +22,15 @@ namespace ml
 			aiProcess_JoinIdenticalVertices |
 			aiProcess_SortByPType |
 			aiProcess_GenNormals |
-			aiProcess_GenUVCoords);
+			aiProcess_GenUVCoords,
+			alloc);
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	list<vertex> mesh::load_from_file(fs::path const & path, int32 flags)
+	list<vertex> mesh::load_from_file(fs::path const & path, int32 flags, pmr::polymorphic_allocator<byte> alloc)
 	{
-		list<vertex> verts{};
+		list<vertex> verts{ alloc };
 
 		// open scene
 		Assimp::Importer _ai;
@@ -117,9 +117,10 @@ namespace ml
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-		static list<vertex> load_from_file(fs::path const & path);
+		// the vertices come from alloc, decode jobs pass a thread safe one
+		static list<vertex> load_from_file(fs::path const & path, pmr::polymorphic_allocator<byte> alloc = {});
 
-		static list<vertex> load_from_file(fs::path const & path, int32 flags);
+		static list<vertex> load_from_file(fs::path const & path, int32 flags, pmr::polymorphic_allocator<byte> alloc = {});
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
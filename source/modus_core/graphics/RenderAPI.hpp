@@ -47,13 +47,26 @@ namespace ml::gfx
 		// shaders
 		bool shaders_available;
 		bool geometry_shaders_available;
+		bool parallel_shader_compile_available;
 		string shading_language_version;
 	};
 
 	// render device specification
 	template <> struct ML_NODISCARD spec<render_device> final
 	{
-		int32 api{ context_api_opengl };
+		int32	api					{ context_api_opengl };
+		int32	target_granularity	{ 64 }; // transient target sizes round up to this
+		size_t	target_lifetime		{ 3 }; // frames an unused transient target is kept
+	};
+
+	// render target pool stats
+	struct ML_NODISCARD target_pool_stats final
+	{
+		size_t
+			allocations	{}, // targets created
+			reuses		{}, // targets handed out again
+			releases	{}, // targets dropped after going unused
+			pooled		{}; // targets currently held
 	};
 
 	// base render device
@@ -114,6 +127,27 @@ namespace ml::gfx
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+		ML_NODISCARD virtual list<ref<program>> new_programs(list<spec<program>> const & desc, allocator_type alloc = {}) noexcept = 0;
+
+		virtual size_t poll_programs() noexcept = 0;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD virtual ref<framebuffer> get_transient_framebuffer(spec<framebuffer> const & desc) noexcept = 0;
+
+		ML_NODISCARD virtual ref<texture2d> get_transient_texture2d(spec<texture2d> const & desc) noexcept = 0;
+
+		// hand a target back before the frame ends so a later pass can alias it
+		virtual void release_transient(ref<framebuffer> & value) noexcept = 0;
+
+		virtual void release_transient(ref<texture2d> & value) noexcept = 0;
+
+		virtual size_t update_transients() noexcept = 0;
+
+		ML_NODISCARD virtual target_pool_stats const & get_target_pool_stats() const noexcept = 0;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 		ML_NODISCARD virtual list<weak<render_context>> const & all_contexts() const noexcept = 0;
 
 		ML_NODISCARD virtual list<weak<vertexarray>> const & all_vertexarrays() const noexcept = 0;
@@ -1027,9 +1061,20 @@ namespace ml::gfx
 // program
 namespace ml::gfx
 {
+	// program status
+	enum program_status_ : int32
+	{
+		program_status_none,	// nothing linked
+		program_status_pending,	// compile / link in flight
+		program_status_ready,	// linked successfully
+		program_status_error,	// compile / link failed
+	};
+
 	// program specification
 	template <> struct ML_NODISCARD spec<program> final
 	{
+		array<list<string>, shader_type_MAX>	source		{}; // source per shader type
+		bool									deferred	{}; // poll status instead of blocking
 	};
 
 	// base program
@@ -1051,6 +1096,9 @@ namespace ml::gfx
 
 		virtual bool revalue() = 0;
 
+		// trades objects and caches with another program of the same backend
+		virtual bool swap(program & other) noexcept = 0;
+
 		ML_NODISCARD virtual object_id get_handle() const noexcept override = 0;
 
 		ML_NODISCARD virtual typeof_t<> const & get_self_type() const noexcept override = 0;
@@ -1076,10 +1124,16 @@ namespace ml::gfx
 
 		virtual bool link() = 0;
 
+		virtual int32 poll() = 0;
+
 		virtual bool bind_uniform(cstring name, method<void(uniform_id)> const & fn) = 0;
 
 		ML_NODISCARD virtual uniform_id get_uniform_location(cstring name) noexcept = 0;
 
+		ML_NODISCARD virtual int32 get_status() const noexcept = 0;
+
+		ML_NODISCARD inline bool is_ready() const noexcept { return get_status() == program_status_ready; }
+
 		ML_NODISCARD virtual string const & get_info_log() const noexcept = 0;
 
 		ML_NODISCARD virtual array<object_id, shader_type_MAX> const & get_shaders() const noexcept = 0;
@@ -3,6 +3,7 @@
 
 #include <modus_core/detail/FlatMap.hpp>
 #include <modus_core/detail/Method.hpp>
+#include <modus_core/detail/SmallVector.hpp>
 #include <modus_core/graphics/Bitmap.hpp>
 
 // types
@@ -539,7 +540,7 @@ namespace ml::gfx
 	// buffer layout
 	struct ML_NODISCARD buffer_layout final
 	{
-		using storage_type				= typename list<buffer_element>;
+		using storage_type				= typename small_vector<buffer_element, 8>;
 		using iterator					= typename storage_type::iterator;
 		using const_iterator			= typename storage_type::const_iterator;
 		using reverse_iterator			= typename storage_type::reverse_iterator;
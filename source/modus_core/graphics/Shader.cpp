@@ -13,22 +13,26 @@ namespace ml::gfx
 {
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	bool parse_source(std::istream & in, program_source & out)
+	bool parse_source(std::istream & in, program_source & out, pmr::polymorphic_allocator<byte> alloc)
 	{
 		if (!in) { return false; }
 
-		array<stringstream, shader_type_MAX> src{};
-		stringstream * dst{ &src[0] };
-		string line{};
+		// std strings while parsing, only the results come from alloc
+		array<std::string, shader_type_MAX> src{};
+		std::string * dst{ &src[0] };
+		std::string line{};
 		
 		while (std::getline(in, line))
 		{
 			if (line.empty() || util::trim(line).empty()) { continue; }
 			else if (line.front() == '#')
 			{
-				auto const toks{ util::tokenize(line, "# ") };
+				// counted into a fixed array, a long directive mustn't spill to the heap
+				std::string_view toks[3]{};
+				size_t count{};
+				util::for_each_token(line, "# ", [&](std::string_view tok) { if (count < 3) { toks[count] = tok; } ++count; });
 
-				if ((3 == toks.size()) && (toks[0] == "pragma") && (toks[1] == "shader"))
+				if ((3 == count) && (toks[0] == "pragma") && (toks[1] == "shader"))
 				{
 					switch (hashof(toks[2]))
 					{
@@ -36,29 +40,65 @@ namespace ml::gfx
 					case hashof("pixel")	: dst = &src[shader_type_pixel]; break;
 					case hashof("geometry")	: dst = &src[shader_type_geometry]; break;
 					}
-				}
-				else
-				{
-					(*dst) << line << '\n';
+					continue;
 				}
 			}
-			else
-			{
-				(*dst) << line << '\n';
-			}
+			dst->append(line).push_back('\n');
 		}
 
 		for (size_t i = 0; i < src.size(); ++i)
 		{
-			if (string str{ src[i].str() }; !str.empty())
+			if (!src[i].empty())
 			{
-				out[i] = str;
+				out[i].emplace(src[i].data(), src[i].size(), alloc);
 			}
 		}
 
 		return true;
 	}
 
+	// includes nested deeper than this are taken to be a cycle
+	static constexpr int32 include_depth_max{ 16 };
+
+	static bool expand_includes(fs::path const & path, std::string & out, list<fs::path> * deps, int32 depth)
+	{
+		if (include_depth_max < depth) { return debug::fail("include depth exceeded at {0}", path.string()); }
+
+		std::ifstream f{ path };
+		ML_defer(&f) { f.close(); };
+		if (!f) { return false; }
+		if (deps) { deps->push_back(path); }
+
+		std::string line{};
+		while (std::getline(f, line))
+		{
+			size_t const first{ line.find_first_not_of(" \t") };
+			if (first != line.npos && !line.compare(first, 8, "#include"))
+			{
+				size_t const open{ line.find('"', first + 8) };
+				size_t const close{ (open != line.npos) ? line.find('"', open + 1) : line.npos };
+				if (close != line.npos)
+				{
+					fs::path name{ line.substr(open + 1, close - open - 1) };
+					if (!fs::exists(name)) { name = path.parent_path() / name; }
+					if (!expand_includes(name, out, deps, depth + 1)) { return false; }
+					continue;
+				}
+			}
+			out.append(line).push_back('\n');
+		}
+		return true;
+	}
+
+	bool parse_source(fs::path const & path, program_source & out, list<fs::path> * deps, pmr::polymorphic_allocator<byte> alloc)
+	{
+		// std strings until the end, this runs on decode jobs
+		std::string text{};
+		if (!expand_includes(path, text, deps, 0)) { return false; }
+		std::istringstream s{ std::move(text) };
+		return parse_source(s, out, alloc);
+	}
+
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	
 	std::ostream & shader_builder::emit_source(std::ostream & out, json const & in)
@@ -15,7 +15,8 @@ namespace ml::gfx
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	// parse program source
-	ML_CORE_API bool parse_source(std::istream & in, program_source & out);
+	// strings in out come from alloc, decode jobs pass a thread safe one
+	ML_CORE_API bool parse_source(std::istream & in, program_source & out, pmr::polymorphic_allocator<byte> alloc = {});
 
 	template <size_t N
 	> bool parse_source(const char(&in)[N], program_source & out) noexcept
@@ -30,11 +31,13 @@ namespace ml::gfx
 		return parse_source(s, out);
 	}
 
+	// #include "file" is resolved from the working directory, then next to the includer,
+	// every file read is appended to deps
+	ML_CORE_API bool parse_source(fs::path const & path, program_source & out, list<fs::path> * deps, pmr::polymorphic_allocator<byte> alloc = {});
+
 	inline bool parse_source(fs::path const & path, program_source & out) noexcept
 	{
-		std::ifstream f{ path };
-		ML_defer(&f) { f.close(); };
-		return parse_source(f, out);
+		return parse_source(path, out, nullptr);
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -61,6 +64,25 @@ namespace ml::gfx
 		}
 	}
 
+	// parse programs (batched)
+	template <class In> list<ref<program>> parse_programs(list<In> const & in)
+	{
+		list<spec<program>> desc{};
+		desc.reserve(in.size());
+		for (auto const & e : in)
+		{
+			spec<program> & d{ desc.emplace_back() };
+			if (program_source src{}; _ML gfx::parse_source(e, src))
+			{
+				for (size_t i = 0; i < src.size(); ++i)
+				{
+					if (src[i]) { d.source[i] = { *src[i] }; }
+				}
+			}
+		}
+		return ML_get_global(render_device)->new_programs(desc);
+	}
+
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	// shader builder
@@ -195,7 +195,7 @@ namespace ml::ImGuiExt
 						ImGui::EndMenu();
 					}
 					ImGui::Separator();
-					if (ImGui::MenuItem("clear")) { Output.Lines.clear(); }
+					if (ImGui::MenuItem("clear")) { Output.Clear(); }
 					ImGui::Separator();
 					ImGui::EndMenuBar();
 				}
@@ -16,7 +16,7 @@ namespace ml::ImGuiExt
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-		using PrinterSignature = typename void(list<string> const &, size_t);
+		using PrinterSignature = typename void(std::string_view);
 
 		// printer
 		struct ML_NODISCARD Printer final : method< PrinterSignature >
@@ -24,11 +24,11 @@ namespace ml::ImGuiExt
 			using method< PrinterSignature >::method;
 
 			Printer() noexcept : Printer{ [
-			](list<pmr::string> const & lines, size_t i) noexcept
+			](std::string_view line) noexcept
 			{
-				auto check_prefix = [&lines, i](cstring str) noexcept -> bool
+				auto check_prefix = [line](std::string_view str) noexcept -> bool
 				{
-					return !std::strncmp(lines[i].c_str(), str, std::strlen(str));
+					return !line.compare(0, str.size(), str);
 				};
 
 				color c;
@@ -49,7 +49,7 @@ namespace ml::ImGuiExt
 				}
 
 				ImGui::PushStyleColor(ImGuiCol_Text, c);
-				ImGui::TextUnformatted(lines[i].c_str());
+				ImGui::TextUnformatted(line.data(), line.data() + line.size());
 				ImGui::PopStyleColor();
 			} }
 			{
@@ -59,7 +59,9 @@ namespace ml::ImGuiExt
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 		ImGuiTextFilter			Filter			; // filter
-		list<string>			Lines			; // lines
+		string					Buffer			; // text of every line
+		list<size_t>			LineOffsets		; // start of each line in the buffer
+		size_t					MaxLines		; // oldest lines are dropped past this, zero for no limit
 		bool					AutoScroll		; // auto scroll
 		bool					ScrollToBottom	; // scroll to bottom
 
@@ -67,10 +69,16 @@ namespace ml::ImGuiExt
 
 		TextLog(cstring default_filter = "", bool auto_scroll = true, allocator_type alloc = {}) noexcept
 			: Filter		{ default_filter }
-			, Lines			{ alloc }
+			, Buffer		{ alloc }
+			, LineOffsets	{ alloc }
+			, MaxLines		{ 1 << 20 }
 			, AutoScroll	{ auto_scroll }
 			, ScrollToBottom{}
+			, m_filter_text	{ alloc }
+			, m_filtered	{ alloc }
+			, m_checked		{}
 		{
+			LineOffsets.push_back(0);
 		}
 
 		explicit TextLog(allocator_type alloc) noexcept : TextLog{ "", true, alloc }
@@ -79,39 +87,60 @@ namespace ml::ImGuiExt
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+		void Clear() noexcept
+		{
+			Buffer.clear();
+			LineOffsets.assign(1, 0);
+			m_filtered.clear();
+			m_checked = 0;
+		}
+
+		ML_NODISCARD size_t GetLineCount() const noexcept
+		{
+			return LineOffsets.size();
+		}
+
+		ML_NODISCARD std::string_view GetLine(size_t i) const noexcept
+		{
+			size_t const first{ LineOffsets[i] };
+			size_t const last{ (i + 1 < LineOffsets.size()) ? (LineOffsets[i + 1] - 1) : Buffer.size() };
+			return { Buffer.data() + first, last - first };
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 		TextLog & Write(char value) noexcept {
-			switch (value)
-			{
-			default: { // default
-				if (Lines.empty()) { Lines.push_back({}); }
-				Lines.back().push_back(value);
-			} break;
-
-			case '\n': { // new line
-				Lines.push_back({});
-			} break;
+			Buffer.push_back(value);
+			if (value == '\n') {
+				LineOffsets.push_back(Buffer.size());
+				Trim();
 			}
 			return (*this);
 		}
 
-		TextLog & Print(cstring value = "\n") noexcept {
-			std::for_each_n(value, std::strlen(value), [&](char c) noexcept {
-				this->Write(c);
-			});
+		TextLog & Print(std::string_view value) noexcept {
+			size_t const base{ Buffer.size() };
+			Buffer.append(value.data(), value.size());
+			for (cstring it{ Buffer.data() + base }, end{ Buffer.data() + Buffer.size() }
+			; (it = (cstring)std::memchr(it, '\n', (size_t)(end - it))); ) {
+				LineOffsets.push_back((size_t)(++it - Buffer.data()));
+			}
+			Trim();
 			return (*this);
 		}
 
+		TextLog & Print(cstring value = "\n") noexcept {
+			return this->Print(std::string_view{ value });
+		}
+
 		TextLog & Print(string const & value = "\n") noexcept {
-			for (char c : value) {
-				this->Write(c);
-			}
-			return (*this);
+			return this->Print(std::string_view{ value });
 		}
 
 		template <class ... Args
 		> TextLog & Printf(cstring str, Args && ... args) noexcept {
 			char buf[256]{};
-			std::sprintf(buf, str, ML_forward(args)...);
+			std::snprintf(buf, sizeof(buf), str, ML_forward(args)...);
 			return this->Print(buf);
 		}
 
@@ -129,25 +158,34 @@ namespace ml::ImGuiExt
 		template <class T
 		> TextLog & operator<<(T && value) noexcept
 		{
-			stringstream ss{};
-			ss << ML_forward(value);
-			return this->Dump(ss);
+			return this->Print(util::format("{0}", value));
 		}
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 		void Draw(Printer const & printer = {})
 		{
-			// print lines
-			ImGui::BeginGroup();
-			for (size_t i = 0, imax = Lines.size(); i < imax; ++i)
+			// only lines added since the last frame are filtered
+			UpdateFilter();
+			size_t const line_count{ GetLineCount() };
+			bool const filtering{ Filter.IsActive() };
+			bool const last_passes{ filtering && PassFilter(line_count - 1) };
+			size_t const count{ filtering ? (m_filtered.size() + last_passes) : line_count };
+
+			// print visible lines
+			ImGuiListClipper clipper;
+			clipper.Begin((int32)count);
+			while (clipper.Step())
 			{
-				if (Filter.PassFilter(Lines[i].c_str()))
+				for (int32 i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
 				{
-					printer(Lines, i);
+					size_t const line{ !filtering ? (size_t)i
+						: ((size_t)i < m_filtered.size()) ? m_filtered[(size_t)i]
+						: (line_count - 1) };
+					printer(GetLine(line));
 				}
 			}
-			ImGui::EndGroup();
+			clipper.End();
 
 			// scroll to bottom
 			if (ScrollToBottom || (AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY()))
@@ -157,6 +195,55 @@ namespace ml::ImGuiExt
 			ScrollToBottom = false;
 		}
 
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		ML_NODISCARD bool PassFilter(size_t i) const noexcept
+		{
+			std::string_view const line{ GetLine(i) };
+			return Filter.PassFilter(line.data(), line.data() + line.size());
+		}
+
+		void UpdateFilter() noexcept
+		{
+			// restart when the filter changes
+			if (m_filter_text != Filter.InputBuf)
+			{
+				m_filter_text = Filter.InputBuf;
+				m_filtered.clear();
+				m_checked = 0;
+			}
+			if (!Filter.IsActive()) { return; }
+
+			// the last line may still grow, it is checked every frame instead
+			for (size_t const complete{ GetLineCount() - 1 }; m_checked < complete; ++m_checked)
+			{
+				if (PassFilter(m_checked)) { m_filtered.push_back(m_checked); }
+			}
+		}
+
+		void Trim() noexcept
+		{
+			if (!MaxLines || LineOffsets.size() <= MaxLines) { return; }
+
+			// drop a quarter at once so the buffer is not shifted every line
+			size_t const drop{ std::min(LineOffsets.size() - MaxLines + MaxLines / 4, LineOffsets.size() - 1) };
+			size_t const cut{ LineOffsets[drop] };
+			Buffer.erase(0, cut);
+			LineOffsets.erase(LineOffsets.begin(), LineOffsets.begin() + (ptrdiff_t)drop);
+			for (size_t & e : LineOffsets) { e -= cut; }
+
+			// shift filter results
+			auto const it{ std::lower_bound(m_filtered.begin(), m_filtered.end(), drop) };
+			m_filtered.erase(m_filtered.begin(), it);
+			for (size_t & e : m_filtered) { e -= drop; }
+			m_checked = (m_checked > drop) ? (m_checked - drop) : 0;
+		}
+
+		string			m_filter_text	; // filter used for the results
+		list<size_t>	m_filtered		; // complete lines passing the filter
+		size_t			m_checked		; // complete lines already filtered
+
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	};
 }
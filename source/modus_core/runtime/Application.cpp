@@ -10,14 +10,21 @@ namespace ml
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	application::application(int32 argc, char * argv[], json const & argj, allocator_type alloc)
-		: gui_application{ argc, argv, argj, alloc }
+		: gui_application	{ argc, argv, argj, alloc }
+		, m_scripts			{ alloc }
+		, m_assets			{ alloc }
+		, m_startup_trace	{ alloc }
+		, m_startup_logged	{}
 	{
 		ML_ctor_global(application);
 
+		trace_startup("core");
+
 		subscribe<
 			runtime_startup_event,
 			runtime_shutdown_event,
 			runtime_idle_event,
+			runtime_fixed_update_event,
 			dockspace_builder_event,
 			runtime_gui_event,
 			runtime_end_frame_event
@@ -27,11 +34,32 @@ namespace ml
 		{
 			ML_verify(initialize_interpreter(get_app_file_name(), get_app_data_path()));
 		}
+		trace_startup("interpreter");
+
+		// python runs on its own thread from here on, main thread users take the gil
+		json const j_python{ has_attr("python") ? get_attr("python") : json::object() };
+		m_scripts.set_wake([this]() { wake(); });
+		m_scripts.set_cache_path(get_path_to(j_python.value("cache_path", "cache/python")));
+		ML_verify(ML_begin_global(script_service, &m_scripts));
+		ML_verify(m_scripts.start(j_python));
+		trace_startup("script thread");
+
+		// saved assets are decoded on the job system and rebuilt between frames
+		json const j_assets{ has_attr("assets") ? get_attr("assets") : json::object() };
+		m_assets.set_wake([this]() { wake(); });
+		ML_verify(ML_begin_global(asset_service, &m_assets));
+		if (j_assets.value("hot_reload", true)) { ML_verify(m_assets.start(j_assets)); }
 	}
 
 	application::~application() noexcept
 	{
 		ML_dtor_global(application);
+
+		m_assets.stop();
+		ML_verify(ML_end_global(asset_service, &m_assets));
+
+		m_scripts.stop();
+		ML_verify(ML_end_global(script_service, &m_scripts));
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -41,12 +69,22 @@ namespace ml
 		gui_application::on_event(value);
 		switch (value)
 		{
-		case runtime_startup_event	::ID: { auto const & ev{ (runtime_startup_event const &)value }; } break;
+		case runtime_startup_event	::ID: { auto const & ev{ (runtime_startup_event const &)value };
+			trace_startup("startup");
+		} break;
 		case runtime_shutdown_event	::ID: { auto const & ev{ (runtime_shutdown_event const &)value }; } break;
-		case runtime_idle_event		::ID: { auto const & ev{ (runtime_idle_event const &)value }; } break;
+		case runtime_idle_event		::ID: { auto const & ev{ (runtime_idle_event const &)value };
+			m_scripts.update();
+			if (m_scripts.has_routines()) { request_redraw(); }
+			if (m_assets.update()) { request_redraw(); }
+		} break;
+		case runtime_fixed_update_event::ID: { auto const & ev{ (runtime_fixed_update_event const &)value }; } break;
 		case dockspace_builder_event::ID: { auto const & ev{ (dockspace_builder_event const &)value }; } break;
 		case runtime_gui_event		::ID: { auto const & ev{ (runtime_gui_event const &)value }; } break;
-		case runtime_end_frame_event::ID: { auto const & ev{ (runtime_end_frame_event const &)value }; } break;
+		case runtime_end_frame_event::ID: { auto const & ev{ (runtime_end_frame_event const &)value };
+			m_assets.end_frame();
+			if (!m_startup_logged) { log_startup(); }
+		} break;
 
 		case char_event				::ID: { auto const & ev{ (char_event const &)value }; } break;
 		case key_event				::ID: { auto const & ev{ (key_event const &)value }; } break;
@@ -57,6 +95,24 @@ namespace ml
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void application::log_startup()
+	{
+		trace_startup("first frame");
+		m_startup_logged = true;
+
+		// marks from other threads can land out of order
+		std::stable_sort(m_startup_trace.begin(), m_startup_trace.end(), [](auto const & a, auto const & b) { return a.second < b.second; });
+		duration prev{};
+		for (auto const & [label, time] : m_startup_trace)
+		{
+			ML_log_info("startup {0}: {1} ms (+{2} ms)", label, time.count() * 1000.f, (time - prev).count() * 1000.f);
+			prev = time;
+		}
+		m_startup_trace.clear();
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 }
 
 // global application
@@ -2,6 +2,8 @@
 #define _ML_APPLICATION_HPP_
 
 #include <modus_core/runtime/GuiApplication.hpp>
+#include <modus_core/embed/ScriptService.hpp>
+#include <modus_core/graphics/AssetService.hpp>
 #include <modus_core/scene/SceneTree.hpp>
 
 namespace ml
@@ -19,10 +21,35 @@ namespace ml
 		virtual ~application() noexcept override;
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		ML_NODISCARD auto get_scripts() const noexcept { return const_cast<script_service *>(&m_scripts); }
+
+		ML_NODISCARD auto get_assets() const noexcept { return const_cast<asset_service *>(&m_assets); }
+
+		// marks a startup step, the trace is logged with the first frame, main thread only
+		void trace_startup(cstring label, duration time) { if (!m_startup_logged) { m_startup_trace.push_back({ label, time }); } }
+
+		void trace_startup(cstring label) { trace_startup(label, get_time()); }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 		
 	protected:
 		virtual void on_event(event const & value) override;
 
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		void log_startup();
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		script_service						m_scripts			; // python thread
+		asset_service						m_assets			; // asset hot reload
+		list<std::pair<cstring, duration>>	m_startup_trace		; // launch to first frame
+		bool								m_startup_logged	; // trace is done
+
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	};
 }
@@ -7,6 +7,7 @@ namespace ml
 
 	core_application::core_application(int32 argc, char * argv[], json const & argj, allocator_type alloc)
 		: event_listener	{ &m_event_bus, LLONG_MIN }
+		, m_logger			{ alloc }
 		, m_exit_code		{ EXIT_SUCCESS }
 		, m_app_data_path	{}
 		, m_app_file_name	{ argv[0] }
@@ -20,6 +21,7 @@ namespace ml
 
 		, m_main_timer		{ true }
 		, m_event_bus		{ alloc }
+		, m_jobs			{ argj.contains("jobs") ? argj["jobs"].value("threads", (size_t)0) : 0, alloc }
 		, m_libs			{ alloc }
 		, m_addons			{ &m_event_bus, alloc }
 	{
@@ -30,6 +32,16 @@ namespace ml
 		if (auto j{ attr.find("app_name") }; j != attr.end()) { j->get_to(m_app_name); }
 		if (auto j{ attr.find("app_version") }; j != attr.end()) { j->get_to(m_app_version); }
 		if (auto j{ attr.find("arguments") }; j != attr.end()) { j->get_to(m_arguments); }
+
+		// setup logger
+		ML_verify(ML_begin_global(logger, &m_logger));
+		json const j_log{ attr.contains("log") ? attr["log"] : json::object() };
+		if (j_log.value("console", true)) { m_logger.add_sink(logger::console_sink()); }
+		if (auto j{ j_log.find("file") }; j != j_log.end()) { m_logger.add_sink(logger::file_sink(j->get<fs::path>())); }
+		if (auto j{ j_log.find("level") }; j != j_log.end()) { m_logger.set_level(j->get<int32>()); }
+
+		// setup jobs
+		ML_verify(ML_begin_global(job_system, &m_jobs));
 	}
 
 	core_application::~core_application() noexcept
@@ -38,6 +50,8 @@ namespace ml
 
 		if (is_interpreter_initialized()) { ML_verify(finalize_interpreter()); }
 
+		ML_verify(ML_end_global(job_system, &m_jobs));
+
 		unsubscribe(); // manual unsubscribe required because we own the bus
 	}
 
@@ -3,6 +3,8 @@
 
 #include <modus_core/detail/Timer.hpp>
 #include <modus_core/embed/AddonManager.hpp>
+#include <modus_core/system/JobSystem.hpp>
+#include <modus_core/system/Logger.hpp>
 
 namespace ml
 {
@@ -55,6 +57,12 @@ namespace ml
 
 		ML_NODISCARD auto get_arguments(size_t i) const noexcept -> string const & { return m_arguments[i]; }
 
+		ML_NODISCARD auto get_addons() noexcept -> addon_manager & { return m_addons; }
+
+		ML_NODISCARD auto get_jobs() noexcept -> job_system & { return m_jobs; }
+
+		ML_NODISCARD auto get_logger() noexcept -> logger & { return m_logger; }
+
 		ML_NODISCARD auto get_attr() noexcept -> json & { return m_attributes; }
 
 		ML_NODISCARD auto get_attr() const noexcept -> json const & { return m_attributes; }
@@ -164,6 +172,11 @@ namespace ml
 
 		auto install_addon(fs::path const & path, void * userptr = nullptr) noexcept -> hash_t { return install_addon(load_library(path), userptr); }
 
+		// hot reloaded, rebuilds are picked up between frames
+		auto watch_addon(fs::path const & path, void * userptr = nullptr) noexcept -> hash_t { return m_addons.watch_addon(path, userptr); }
+
+		bool reload_addon(hash_t id) noexcept { return m_addons.reload_addon(id); }
+
 		bool uninstall_addon(hash_t id) noexcept { return m_addons.uninstall_addon(id); }
 
 		bool uninstall_addon(fs::path const & path) noexcept { return uninstall_addon(hashof(path.filename().string())); }
@@ -180,6 +193,7 @@ namespace ml
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	private:
+		logger			m_logger		; // logger
 		int32			m_exit_code		; // exit code
 		fs::path		m_app_data_path	; // app data path
 		fs::path		m_app_file_name	; // app file name
@@ -193,6 +207,7 @@ namespace ml
 
 		timer			m_main_timer	; // main timer
 		event_bus		m_event_bus		; // event bus
+		job_system		m_jobs			; // job system
 		library_storage	m_libs			; // library manager
 		addon_manager	m_addons		; // addon manager
 
@@ -20,6 +20,31 @@ namespace ml
 		, m_frame_index		{}
 		, m_fps				{ 120, alloc }
 		, m_input			{}
+
+		, m_fixed_delta_time	{}
+		, m_fixed_accumulator	{}
+		, m_fixed_index			{}
+		, m_fixed_max_steps		{ 5 }
+		, m_fixed_alpha			{ 1.f }
+		, m_frame_rate			{}
+		, m_idle_rate			{ 10.f }
+		, m_limiter				{}
+
+		, m_update_time			{}
+		, m_render_time			{}
+		, m_frame_times			{}
+
+		, m_idle_timeout		{}
+		, m_awake_frames		{}
+		, m_animations			{}
+		, m_wake_posted			{}
+		, m_redraw				{}
+		, m_draw_hash			{}
+		, m_draw_dirty			{ true }
+		, m_report				{}
+		, m_report_next			{}
+		, m_report_timer		{ true }
+		, m_report_cpu			{ frame_limiter::get_process_time() }
 	{
 		ML_ctor_global(gui_application);
 
@@ -28,7 +53,13 @@ namespace ml
 			key_event,
 			mouse_button_event,
 			mouse_pos_event,
-			mouse_wheel_event
+			mouse_wheel_event,
+			mouse_enter_event,
+			window_drop_event,
+			window_focus_event,
+			window_framebuffer_resize_event,
+			window_iconify_event,
+			window_refresh_event
 		>();
 
 		// create imgui context
@@ -64,7 +95,21 @@ namespace ml
 		while (m_window.is_open())
 		{
 			m_loop_timer.restart();
-			window_api::poll_events();
+
+			// block once nothing is changing, input, wake and the timeout end the wait
+			if (0.f < m_idle_timeout && !m_awake_frames && !m_animations && !m_draw_dirty && !get_jobs().has_pending())
+			{
+				window_api::wait_events(m_idle_timeout);
+				++m_report_next.waits;
+			}
+			else
+			{
+				window_api::poll_events();
+			}
+			if (m_wake_posted.exchange(false, std::memory_order_acq_rel)) { request_redraw(); }
+
+			run_fixed_steps(accumulate_fixed_steps(m_delta_time));
+
 			on_idle(m_delta_time);
 
 			_ML ImGui_NewFrame();
@@ -73,8 +118,34 @@ namespace ml
 			on_gui();
 			ImGui::Render();
 
+			// frames with the same draw data as the last one aren't submitted
+			if (0.f < m_idle_timeout)
+			{
+				hash_t const draw_hash{ hash_draw_data() };
+				bool const changed{ draw_hash != std::exchange(m_draw_hash, draw_hash) };
+				m_draw_dirty = std::exchange(m_redraw, false) || (0 < m_animations) || changed;
+			}
+			else
+			{
+				m_draw_dirty = true;
+				m_redraw = false;
+			}
+
+			timer const render_timer{ true };
 			on_end_frame();
+			m_render_time = render_timer.elapsed();
+
+			// sleep out the rest of the frame
+			if (float32 const rate{ m_window.is_iconified() ? m_idle_rate : m_frame_rate }; 0.f < rate)
+			{
+				m_limiter.wait(m_loop_timer, duration{ 1.f / rate });
+			}
+
 			m_delta_time = m_loop_timer.elapsed();
+			m_frame_times.update(m_delta_time);
+			++m_frame_index;
+			if (m_awake_frames) { --m_awake_frames; }
+			update_report();
 		}
 
 		on_shutdown();
@@ -150,6 +221,16 @@ namespace ml
 			}
 		}
 
+		// setup loop
+		if (has_attr("loop")) {
+			json & j_loop{ get_attr("loop") };
+			set_fixed_rate(j_loop.value("fixed_rate", 0.f));
+			set_frame_rate(j_loop.value("frame_rate", 0.f));
+			m_idle_rate = j_loop.value("idle_rate", m_idle_rate);
+			set_idle_timeout(j_loop.value("idle_timeout", m_idle_timeout));
+			m_fixed_max_steps = ML_max(j_loop.value("max_steps", m_fixed_max_steps), 1u);
+		}
+
 		get_bus()->broadcast<runtime_startup_event>(this);
 	}
 
@@ -164,6 +245,12 @@ namespace ml
 		// fps tracker
 		m_fps.update(dt);
 
+		// poll pending programs
+		m_render_device->poll_programs();
+
+		// rebuilt addons are swapped in here, never from inside a broadcast
+		if (get_addons().check_for_changes()) { request_redraw(); }
+
 		// handle input
 		m_input.mouse_delta = m_input.mouse_pos - m_input.last_mouse_pos;
 		m_input.last_mouse_pos = m_input.mouse_pos;
@@ -185,6 +272,11 @@ namespace ml
 		get_bus()->broadcast<runtime_idle_event>(this);
 	}
 
+	void gui_application::on_fixed_update(duration dt)
+	{
+		get_bus()->broadcast<runtime_fixed_update_event>(this);
+	}
+
 	void gui_application::on_gui()
 	{
 		bool const main_menu_bar{ (bool)ImGui::FindWindowByName("##MainMenuBar") };
@@ -202,37 +294,117 @@ namespace ml
 
 	void gui_application::on_end_frame()
 	{
-		// clear screen
-		get_render_context()->execute([&](gfx::render_context * ctx) noexcept
+		if (m_draw_dirty)
 		{
-			ctx->set_viewport({ { 0, 0 }, (vec2)m_window.get_framebuffer_size() });
-			ctx->set_clear_color(colors::black);
-			ctx->clear(gfx::clear_flags_color);
-		});
-
-		// render gui
-		_ML ImGui_RenderDrawData(&m_imgui->Viewports[0]->DrawDataP);
+			// clear screen
+			get_render_context()->execute([&](gfx::render_context * ctx) noexcept
+			{
+				ctx->set_viewport({ { 0, 0 }, (vec2)m_window.get_framebuffer_size() });
+				ctx->set_clear_color(colors::black);
+				ctx->clear(gfx::clear_flags_color);
+			});
+
+			// render gui
+			_ML ImGui_RenderDrawData(&m_imgui->Viewports[0]->DrawDataP);
+		}
 
 		// update gui windows
 		if (m_imgui->IO.ConfigFlags & ImGuiConfigFlags_DockingEnable) {
 			window_handle const backup{ window_api::get_active_window() };
 			ImGui::UpdatePlatformWindows();
-			ImGui::RenderPlatformWindowsDefault();
+			if (m_draw_dirty) { ImGui::RenderPlatformWindowsDefault(); }
 			window_api::set_active_window(backup);
 		}
 
 		// swap buffers
-		if (m_window.has_hints(window_hints_doublebuffer)) {
+		if (m_draw_dirty && m_window.has_hints(window_hints_doublebuffer)) {
 			window_api::swap_buffers(m_window.get_handle());
 		}
+		++(m_draw_dirty ? m_report_next.rendered : m_report_next.skipped);
 
 		// reset inputs
 		m_input.mouse_wheel = 0.f;
 
+		// recycle transient targets
+		m_render_device->update_transients();
+
 		// end frame event
 		get_bus()->broadcast<runtime_end_frame_event>(this);
 	}
 
+	uint32 gui_application::accumulate_fixed_steps(duration dt) noexcept
+	{
+		// without a fixed rate the simulation is always current
+		if (m_fixed_delta_time <= 0.f) { m_fixed_alpha = 1.f; return 0; }
+
+		// time past the catch up limit is dropped so slow frames can't spiral
+		m_fixed_accumulator = duration{ ML_min(m_fixed_accumulator + dt, m_fixed_delta_time * (float32)m_fixed_max_steps) };
+		uint32 steps{};
+		while (m_fixed_delta_time <= m_fixed_accumulator)
+		{
+			m_fixed_accumulator = duration{ m_fixed_accumulator - m_fixed_delta_time };
+			++steps;
+		}
+		m_fixed_alpha = m_fixed_accumulator / m_fixed_delta_time;
+		return steps;
+	}
+
+	void gui_application::run_fixed_steps(uint32 count)
+	{
+		timer const update_timer{ true };
+		for (uint32 i = 0; i < count; ++i)
+		{
+			on_fixed_update(m_fixed_delta_time);
+			++m_fixed_index;
+		}
+		m_update_time = update_timer.elapsed();
+	}
+
+	hash_t gui_application::hash_draw_data() const noexcept
+	{
+		hash_t h{};
+		for (ImGuiViewportP const * vp : m_imgui->Viewports)
+		{
+			ImDrawData const * const dd{ vp->DrawData };
+			if (!dd || !dd->Valid) { continue; }
+
+			float32 const frame[]{ dd->DisplayPos.x, dd->DisplayPos.y, dd->DisplaySize.x, dd->DisplaySize.y, dd->FramebufferScale.x, dd->FramebufferScale.y };
+			h = fast_hash{}(frame, sizeof(frame), h);
+
+			for (int32 i = 0; i < dd->CmdListsCount; ++i)
+			{
+				ImDrawList const * const dl{ dd->CmdLists[i] };
+				h = fast_hash{}(dl->VtxBuffer.Data, dl->VtxBuffer.size_in_bytes(), h);
+				h = fast_hash{}(dl->IdxBuffer.Data, dl->IdxBuffer.size_in_bytes(), h);
+				for (ImDrawCmd const & cmd : dl->CmdBuffer)
+				{
+					// callbacks can draw anything
+					if (cmd.UserCallback) { return ~m_draw_hash; }
+
+					uint64 const state[]{ (uint64)(intptr_t)cmd.TextureId, cmd.VtxOffset, cmd.IdxOffset, cmd.ElemCount };
+					h = fast_hash{}(&cmd.ClipRect, sizeof(cmd.ClipRect), h);
+					h = fast_hash{}(state, sizeof(state), h);
+				}
+			}
+		}
+		return h;
+	}
+
+	void gui_application::update_report() noexcept
+	{
+		duration const elapsed{ m_report_timer.elapsed() };
+		if (elapsed.count() < frame_report::window) { return; }
+
+		duration const cpu{ frame_limiter::get_process_time() };
+		m_report_next.cpu_usage = (cpu.count() - m_report_cpu.count()) / elapsed.count();
+		m_report_next.rendered_per_minute = (float32)m_report_next.rendered * 60.f / elapsed.count();
+		m_report = std::exchange(m_report_next, frame_report{});
+		m_report_cpu = cpu;
+		m_report_timer.restart();
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 	void gui_application::on_event(event const & value)
 	{
 		core_application::on_event(value);
@@ -241,6 +413,7 @@ namespace ml
 		case char_event::ID: {
 			auto const & ev{ (char_event const &)value };
 			m_input.last_char = ev.value;
+			keep_awake();
 		} break;
 
 		case key_event::ID: {
@@ -250,21 +423,34 @@ namespace ml
 			m_input.is_ctrl = m_input.keys_down[keycode_left_ctrl] || m_input.keys_down[keycode_right_ctrl];
 			m_input.is_alt = m_input.keys_down[keycode_left_alt] || m_input.keys_down[keycode_right_alt];
 			m_input.is_super = m_input.keys_down[keycode_left_super] || m_input.keys_down[keycode_right_super];
+			keep_awake();
 		} break;
 
 		case mouse_button_event::ID: {
 			auto const & ev{ (mouse_button_event const &)value };
 			m_input.mouse_down[ev.button] = ev.action != ML_key_release;
+			keep_awake();
 		} break;
 
 		case mouse_pos_event::ID: {
 			auto const & ev{ (mouse_pos_event const &)value };
 			m_input.mouse_pos = { (float32)ev.x, (float32)ev.y };
+			keep_awake();
 		} break;
 
 		case mouse_wheel_event::ID: {
 			auto const & ev{ (mouse_wheel_event const &)value };
 			m_input.mouse_wheel = (float32)ev.y;
+			keep_awake();
+		} break;
+
+		case mouse_enter_event::ID:
+		case window_drop_event::ID:
+		case window_focus_event::ID:
+		case window_framebuffer_resize_event::ID:
+		case window_iconify_event::ID:
+		case window_refresh_event::ID: {
+			request_redraw(); // the os may have discarded what was presented
 		} break;
 		}
 	}
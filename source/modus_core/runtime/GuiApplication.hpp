@@ -5,6 +5,7 @@
 #include <modus_core/graphics/RenderTarget.hpp>
 #include <modus_core/gui/Dockspace.hpp>
 #include <modus_core/gui/PanelWindow.hpp>
+#include <modus_core/system/FrameLimiter.hpp>
 #include <modus_core/window/NativeWindow.hpp>
 
 namespace ml
@@ -30,6 +31,52 @@ namespace ml
 			value = (0.f < accum) ? (1.f / (accum / (float32)times.size())) : FLT_MAX;
 		}
 	};
+
+	// frame time histogram
+	struct ML_NODISCARD frame_histogram final
+	{
+		static constexpr size_t		bucket_count{ 64 };		// last bucket holds everything slower
+		static constexpr float32	bucket_width{ 0.001f };	// one millisecond
+
+		float32	buckets[bucket_count]; // frames per bucket, floats so they can be plotted
+		size_t	total; // frames recorded
+
+		frame_histogram() noexcept : buckets{}, total{} {}
+
+		void clear() noexcept
+		{
+			std::fill(std::begin(buckets), std::end(buckets), 0.f);
+			total = 0;
+		}
+
+		void update(duration dt) noexcept
+		{
+			buckets[ML_min((size_t)(dt.count() / bucket_width), bucket_count - 1)] += 1.f;
+			++total;
+		}
+
+		// upper edge of the bucket containing the given fraction of frames
+		ML_NODISCARD duration percentile(float32 fraction) const noexcept
+		{
+			float32 const target{ fraction * (float32)total };
+			float32 count{};
+			for (size_t i = 0; i < bucket_count; ++i)
+			{
+				if ((count += buckets[i]) >= target && 0.f < count) { return duration{ (float32)(i + 1) * bucket_width }; }
+			}
+			return duration{};
+		}
+	};
+
+	// power use over the last report window
+	struct ML_NODISCARD frame_report final
+	{
+		static constexpr float32 window{ 10.f }; // seconds per report
+
+		uint64	rendered, skipped, waits;	// frames presented, frames with unchanged draw data, blocking waits
+		float32	cpu_usage;					// process cpu time over wall time, one core is 1.0
+		float32	rendered_per_minute;		// presented frames scaled to a minute
+	};
 }
 
 namespace ml
@@ -94,6 +141,23 @@ namespace ml
 
 		ML_NODISCARD auto get_frame() const noexcept -> uint64 { return m_frame_index; }
 
+		ML_NODISCARD auto get_fixed_delta_time() const noexcept -> duration { return m_fixed_delta_time; }
+
+		ML_NODISCARD auto get_fixed_step() const noexcept -> uint64 { return m_fixed_index; }
+
+		// progress from the previous fixed step toward the current one
+		ML_NODISCARD auto get_interpolation() const noexcept -> float32 { return m_fixed_alpha; }
+
+		ML_NODISCARD auto get_frame_rate() const noexcept -> float32 { return m_frame_rate; }
+
+		ML_NODISCARD auto get_frame_times() const noexcept { return const_cast<frame_histogram *>(&m_frame_times); }
+
+		ML_NODISCARD auto get_update_time() const noexcept -> duration { return m_update_time; }
+
+		ML_NODISCARD auto get_render_time() const noexcept -> duration { return m_render_time; }
+
+		ML_NODISCARD auto get_frame_report() const noexcept -> frame_report const & { return m_report; }
+
 		ML_NODISCARD auto get_input() const noexcept { return const_cast<input_state *>(&m_input); }
 
 		ML_NODISCARD auto get_main_window() const noexcept { return const_cast<native_window *>(&m_window); }
@@ -106,6 +170,32 @@ namespace ml
 
 		ML_NODISCARD auto get_dockspace() const noexcept { return const_cast<ImGuiExt::Dockspace *>(&m_dockspace); }
 
+		// steps per second, zero disables fixed updates
+		void set_fixed_rate(float32 value) noexcept { m_fixed_delta_time = duration{ (0.f < value) ? (1.f / value) : 0.f }; }
+
+		// frames per second, zero is unlimited
+		void set_frame_rate(float32 value) noexcept { m_frame_rate = value; }
+
+		// seconds to block on window events once nothing changes, zero always polls
+		void set_idle_timeout(float32 value) noexcept { m_idle_timeout = value; }
+
+		// submit this frame even if its draw data is unchanged, for animation imgui can't see,
+		// main thread only
+		void request_redraw() noexcept { m_redraw = true; keep_awake(); }
+
+		// something changes the frame on its own, the loop stays awake until it ends,
+		// main thread only
+		void begin_animation() noexcept { ++m_animations; }
+
+		void end_animation() noexcept { ML_assert(0 < m_animations); --m_animations; }
+
+		// request a redraw from any thread, waking the loop if it is blocked
+		void wake() noexcept
+		{
+			m_wake_posted.store(true, std::memory_order_release);
+			window_api::post_empty_event();
+		}
+
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	protected:
@@ -115,6 +205,8 @@ namespace ml
 
 		virtual void on_idle(duration dt);
 
+		virtual void on_fixed_update(duration dt);
+
 		virtual void on_gui();
 
 		virtual void on_end_frame();
@@ -123,6 +215,20 @@ namespace ml
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+	private:
+		ML_NODISCARD uint32 accumulate_fixed_steps(duration dt) noexcept;
+
+		void run_fixed_steps(uint32 count);
+
+		// input takes a few frames to settle in imgui
+		void keep_awake() noexcept { m_awake_frames = ML_max(m_awake_frames, 3u); }
+
+		ML_NODISCARD hash_t hash_draw_data() const noexcept;
+
+		void update_report() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 	private:
 		native_window				m_window		; // main window
 		scary<gfx::render_device>	m_render_device	; // render device
@@ -134,6 +240,31 @@ namespace ml
 		uint64			m_frame_index	; // frame index
 		fps_tracker		m_fps			; // fps tracker
 		input_state		m_input			; // input state
+
+		duration		m_fixed_delta_time	; // simulation step
+		duration		m_fixed_accumulator	; // time not yet simulated
+		uint64			m_fixed_index		; // steps taken
+		uint32			m_fixed_max_steps	; // catch up limit per frame
+		float32			m_fixed_alpha		; // progress toward the next step
+		float32			m_frame_rate		; // frame limit
+		float32			m_idle_rate			; // frame limit while minimized
+		frame_limiter	m_limiter			; // frame limiter
+
+		duration		m_update_time		; // time spent in fixed updates
+		duration		m_render_time		; // time spent submitting
+		frame_histogram	m_frame_times		; // frame times
+
+		float32				m_idle_timeout	; // longest block while idle
+		uint32				m_awake_frames	; // frames left before blocking
+		uint32				m_animations	; // running animations, each keeps the loop awake
+		std::atomic<bool>	m_wake_posted	; // redraw requested off thread
+		bool				m_redraw		; // redraw requested
+		hash_t				m_draw_hash		; // last frame's draw data
+		bool				m_draw_dirty	; // draw data changed this frame
+		frame_report		m_report		; // last finished report
+		frame_report		m_report_next	; // report being counted
+		timer				m_report_timer	; // report window
+		duration			m_report_cpu	; // process time when the window began
 		
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	};
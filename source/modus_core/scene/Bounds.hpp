@@ -0,0 +1,261 @@
+#ifndef _ML_BOUNDS_HPP_
+#define _ML_BOUNDS_HPP_
+
+#include <modus_core/detail/MatrixMath.hpp>
+#include <modus_core/detail/Rect.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// axis aligned bounding box
+	struct ML_NODISCARD aabb final
+	{
+		vec3 min, max;
+
+		ML_NODISCARD static constexpr aabb from_sphere(vec3 const & center, float32 radius) noexcept
+		{
+			return {
+				{ center[0] - radius, center[1] - radius, center[2] - radius },
+				{ center[0] + radius, center[1] + radius, center[2] + radius } };
+		}
+
+		ML_NODISCARD constexpr vec3 center() const noexcept
+		{
+			return { (min[0] + max[0]) * .5f, (min[1] + max[1]) * .5f, (min[2] + max[2]) * .5f };
+		}
+
+		ML_NODISCARD constexpr vec3 extents() const noexcept
+		{
+			return { (max[0] - min[0]) * .5f, (max[1] - min[1]) * .5f, (max[2] - min[2]) * .5f };
+		}
+
+		// half the surface area, used as the insertion cost
+		ML_NODISCARD constexpr float32 perimeter() const noexcept
+		{
+			float32 const x{ max[0] - min[0] }, y{ max[1] - min[1] }, z{ max[2] - min[2] };
+			return x * y + y * z + z * x;
+		}
+
+		ML_NODISCARD constexpr bool contains(aabb const & other) const noexcept
+		{
+			return min[0] <= other.min[0] && min[1] <= other.min[1] && min[2] <= other.min[2]
+				&& other.max[0] <= max[0] && other.max[1] <= max[1] && other.max[2] <= max[2];
+		}
+
+		ML_NODISCARD constexpr bool overlaps(aabb const & other) const noexcept
+		{
+			return min[0] <= other.max[0] && other.min[0] <= max[0]
+				&& min[1] <= other.max[1] && other.min[1] <= max[1]
+				&& min[2] <= other.max[2] && other.min[2] <= max[2];
+		}
+
+		ML_NODISCARD constexpr aabb merge(aabb const & other) const noexcept
+		{
+			return {
+				{ std::min(min[0], other.min[0]), std::min(min[1], other.min[1]), std::min(min[2], other.min[2]) },
+				{ std::max(max[0], other.max[0]), std::max(max[1], other.max[1]), std::max(max[2], other.max[2]) } };
+		}
+
+		ML_NODISCARD constexpr aabb inflate(float32 value) const noexcept
+		{
+			return {
+				{ min[0] - value, min[1] - value, min[2] - value },
+				{ max[0] + value, max[1] + value, max[2] + value } };
+		}
+
+		// bounds of this box after a transform (column major)
+		ML_NODISCARD aabb transform(mat4 const & m) const noexcept
+		{
+			vec3 const c{ center() }, e{ extents() };
+			aabb temp{};
+			for (size_t r = 0; r < 3; ++r)
+			{
+				float32 const tc{ m[r] * c[0] + m[4 + r] * c[1] + m[8 + r] * c[2] + m[12 + r] };
+				float32 const te{ std::abs(m[r]) * e[0] + std::abs(m[4 + r]) * e[1] + std::abs(m[8 + r]) * e[2] };
+				temp.min[r] = tc - te;
+				temp.max[r] = tc + te;
+			}
+			return temp;
+		}
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// ray
+	struct ML_NODISCARD ray final
+	{
+		vec3 origin, direction;
+
+		// distance to the box along the ray, or a negative number on a miss
+		ML_NODISCARD float32 intersect(aabb const & box, float32 max_distance = FLT_MAX) const noexcept
+		{
+			float32 t0{ 0.f }, t1{ max_distance };
+			for (size_t i = 0; i < 3; ++i)
+			{
+				float32 const inv{ 1.f / direction[i] };
+				float32 tn{ (box.min[i] - origin[i]) * inv };
+				float32 tf{ (box.max[i] - origin[i]) * inv };
+				if (tn > tf) { std::swap(tn, tf); }
+				t0 = std::max(t0, tn);
+				t1 = std::min(t1, tf);
+				if (t0 > t1) { return -1.f; }
+			}
+			return t0;
+		}
+
+		// ray through a point on screen
+		ML_NODISCARD static ray from_screen(vec2 const & pos, float_rect const & view, mat4 const & view_matrix, mat4 const & proj_matrix) noexcept
+		{
+			// screen to normalized device coordinates, flipping y
+			float32 const x{ (pos[0] - view.left()) / view.width() * 2.f - 1.f };
+			float32 const y{ (view.bottom() - pos[1]) / view.height() * 2.f - 1.f };
+
+			mat4 const inv{ util::inverse(util::multiply(proj_matrix, view_matrix)) };
+			vec4 const n{ util::transform(inv, vec4{ x, y, -1.f, 1.f }) };
+			vec4 const f{ util::transform(inv, vec4{ x, y, 1.f, 1.f }) };
+
+			vec3 const a{ n[0] / n[3], n[1] / n[3], n[2] / n[3] };
+			vec3 d{ f[0] / f[3] - a[0], f[1] / f[3] - a[1], f[2] / f[3] - a[2] };
+			if (float32 const len{ std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]) }; len > 0.f) { d /= len; }
+			return { a, d };
+		}
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// frustum
+	struct ML_NODISCARD frustum final
+	{
+		enum : int32 { outside, intersects, inside };
+
+		vec4 planes[6]; // left, right, bottom, top, near, far
+
+		alignas(32) float32 lanes[4][8]; // planes by component for the simd tests, the last two keep everything
+
+		// planes from a view projection matrix (column major)
+		ML_NODISCARD static frustum from_matrix(mat4 const & m) noexcept
+		{
+			frustum temp{};
+			for (size_t i = 0; i < 6; ++i)
+			{
+				size_t const r{ i / 2 };
+				float32 const s{ (i % 2) ? -1.f : 1.f };
+				vec4 & p{ temp.planes[i] };
+				for (size_t c = 0; c < 4; ++c)
+				{
+					p[c] = m[c * 4 + 3] + s * m[c * 4 + r];
+				}
+				float32 const len{ std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]) };
+				if (len > 0.f) { for (auto & e : p) { e /= len; } }
+				for (size_t c = 0; c < 4; ++c) { temp.lanes[c][i] = p[c]; }
+			}
+			temp.lanes[3][6] = temp.lanes[3][7] = 1.f;
+			return temp;
+		}
+
+		ML_NODISCARD static frustum from_camera(mat4 const & view_matrix, mat4 const & proj_matrix) noexcept
+		{
+			return from_matrix(util::multiply(proj_matrix, view_matrix));
+		}
+
+		// classify a box against all six planes
+		ML_NODISCARD int32 test(aabb const & box) const noexcept;
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// SCALAR
+namespace ml::impl
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	inline int32 scalar_frustum_test(frustum const & f, aabb const & box) noexcept
+	{
+		vec3 const c{ box.center() }, e{ box.extents() };
+		int32 result{ frustum::inside };
+		for (vec4 const & p : f.planes)
+		{
+			float32 const d{ p[0] * c[0] + p[1] * c[1] + p[2] * c[2] + p[3] };
+			float32 const r{ std::abs(p[0]) * e[0] + std::abs(p[1]) * e[1] + std::abs(p[2]) * e[2] };
+			if (d + r < 0.f) { return frustum::outside; }
+			if (d - r < 0.f) { result = frustum::intersects; }
+		}
+		return result;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// SSE2 / AVX
+#if ML_has_sse2
+namespace ml::impl
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// four planes per register
+	inline int32 sse2_frustum_test(frustum const & f, aabb const & box) noexcept
+	{
+		vec3 const c{ box.center() }, e{ box.extents() };
+		__m128 const cx{ _mm_set1_ps(c[0]) }, cy{ _mm_set1_ps(c[1]) }, cz{ _mm_set1_ps(c[2]) };
+		__m128 const ex{ _mm_set1_ps(e[0]) }, ey{ _mm_set1_ps(e[1]) }, ez{ _mm_set1_ps(e[2]) };
+		__m128 const sign{ _mm_set1_ps(-0.f) }, zero{ _mm_setzero_ps() };
+		int32 out{}, cross{};
+		for (size_t i = 0; i < 8; i += 4)
+		{
+			__m128 const px{ _mm_load_ps(&f.lanes[0][i]) }, py{ _mm_load_ps(&f.lanes[1][i]) };
+			__m128 const pz{ _mm_load_ps(&f.lanes[2][i]) }, pw{ _mm_load_ps(&f.lanes[3][i]) };
+			__m128 const d{ _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, cx), _mm_mul_ps(py, cy)), _mm_add_ps(_mm_mul_ps(pz, cz), pw)) };
+			__m128 const r{ _mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(_mm_andnot_ps(sign, px), ex),
+				_mm_mul_ps(_mm_andnot_ps(sign, py), ey)),
+				_mm_mul_ps(_mm_andnot_ps(sign, pz), ez)) };
+			out |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(d, r), zero));
+			cross |= _mm_movemask_ps(_mm_cmplt_ps(_mm_sub_ps(d, r), zero));
+		}
+		return out ? frustum::outside : (cross ? frustum::intersects : frustum::inside);
+	}
+
+	// all eight planes in one register
+	ML_TARGET_AVX inline int32 avx_frustum_test(frustum const & f, aabb const & box) noexcept
+	{
+		vec3 const c{ box.center() }, e{ box.extents() };
+		__m256 const px{ _mm256_load_ps(f.lanes[0]) }, py{ _mm256_load_ps(f.lanes[1]) };
+		__m256 const pz{ _mm256_load_ps(f.lanes[2]) }, pw{ _mm256_load_ps(f.lanes[3]) };
+		__m256 const sign{ _mm256_set1_ps(-0.f) }, zero{ _mm256_setzero_ps() };
+		__m256 const d{ _mm256_add_ps(
+			_mm256_add_ps(_mm256_mul_ps(px, _mm256_set1_ps(c[0])), _mm256_mul_ps(py, _mm256_set1_ps(c[1]))),
+			_mm256_add_ps(_mm256_mul_ps(pz, _mm256_set1_ps(c[2])), pw)) };
+		__m256 const r{ _mm256_add_ps(_mm256_add_ps(
+			_mm256_mul_ps(_mm256_andnot_ps(sign, px), _mm256_set1_ps(e[0])),
+			_mm256_mul_ps(_mm256_andnot_ps(sign, py), _mm256_set1_ps(e[1]))),
+			_mm256_mul_ps(_mm256_andnot_ps(sign, pz), _mm256_set1_ps(e[2]))) };
+		if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(d, r), zero, _CMP_LT_OQ))) { return frustum::outside; }
+		if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_sub_ps(d, r), zero, _CMP_LT_OQ))) { return frustum::intersects; }
+		return frustum::inside;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+#endif // ML_has_sse2
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// picked once along with the mat4 kernels
+	inline int32 frustum::test(aabb const & box) const noexcept
+	{
+#if ML_has_sse2
+		static auto const fn{ (simd_level_avx <= util::get_simd_level()) ? &impl::avx_frustum_test : &impl::sse2_frustum_test };
+		return fn(*this, box);
+#else
+		return impl::scalar_frustum_test(*this, box);
+#endif
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+#endif // !_ML_BOUNDS_HPP_
\ No newline at end of file
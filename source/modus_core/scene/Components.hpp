@@ -5,6 +5,8 @@
 
 #include <modus_core/detail/Timer.hpp>
 #include <modus_core/scene/BehaviorScript.hpp>
+#include <modus_core/scene/DynamicBVH.hpp>
+#include <modus_core/scene/TransformSystem.hpp>
 #include <modus_core/graphics/Camera.hpp>
 
 namespace ml
@@ -14,7 +16,7 @@ namespace ml
 	// tag component
 	struct ML_NODISCARD tag_component
 	{
-		string tag; // 
+		interned_string tag; // 
 	};
 
 	inline void from_json(json const & j, tag_component & v)
@@ -38,10 +40,7 @@ namespace ml
 
 		ML_NODISCARD mat4 get_transform() const
 		{
-			return util::glm_cast(
-				glm::translate(glm::mat4{ 1.f }, (glm::vec3)position) *
-				glm::toMat4(glm::quat{ (glm::vec3)rotation }) *
-				glm::scale(glm::mat4{ 1.f }, (glm::vec3)scale));
+			return util::compose(position, util::quaternion(vec3{ rotation[0], rotation[1], rotation[2] }), scale);
 		}
 	};
 
@@ -61,6 +60,36 @@ namespace ml
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+	// hierarchy component, runtime only, added and removed along with the transform
+	struct ML_NODISCARD hierarchy_component
+	{
+		transform_system::id_type id{ transform_system::npos }; // slot in the scene's transform system
+		transform_system::id_type parent{ transform_system::npos }; // transform of the nearest entity above it in the nodes
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// bounds component
+	struct ML_NODISCARD bounds_component
+	{
+		aabb bounds; // local bounds
+		int32 proxy{ dynamic_bvh::npos }; // spatial proxy
+	};
+
+	inline void from_json(json const & j, bounds_component & v)
+	{
+		j["min"].get_to(v.bounds.min);
+		j["max"].get_to(v.bounds.max);
+	}
+
+	inline void to_json(json & j, bounds_component const & v)
+	{
+		j["min"] = v.bounds.min;
+		j["max"] = v.bounds.max;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 	// camera component
 	struct ML_NODISCARD camera_component
 	{
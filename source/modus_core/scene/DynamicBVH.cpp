@@ -0,0 +1,226 @@
+#include <modus_core/scene/DynamicBVH.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	int32 dynamic_bvh::create_proxy(aabb const & box, uint32 data)
+	{
+		int32 const id{ allocate_node() };
+		element & e{ m_nodes[(size_t)id] };
+		e.box = box.inflate(m_margin);
+		e.data = data;
+		e.height = 0;
+		insert_leaf(id);
+		++m_count;
+		return id;
+	}
+
+	void dynamic_bvh::destroy_proxy(int32 id)
+	{
+		ML_assert(0 <= id && (size_t)id < m_nodes.size() && m_nodes[(size_t)id].is_leaf());
+		remove_leaf(id);
+		free_node(id);
+		--m_count;
+	}
+
+	bool dynamic_bvh::move_proxy(int32 id, aabb const & box)
+	{
+		ML_assert(0 <= id && (size_t)id < m_nodes.size() && m_nodes[(size_t)id].is_leaf());
+
+		// still inside the fat box, nothing to do
+		if (m_nodes[(size_t)id].box.contains(box)) { return false; }
+
+		remove_leaf(id);
+		m_nodes[(size_t)id].box = box.inflate(m_margin);
+		insert_leaf(id);
+		return true;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	int32 dynamic_bvh::allocate_node()
+	{
+		if (m_free == npos)
+		{
+			m_nodes.emplace_back();
+			return (int32)m_nodes.size() - 1;
+		}
+		int32 const id{ m_free };
+		m_free = m_nodes[(size_t)id].parent;
+		m_nodes[(size_t)id] = {};
+		return id;
+	}
+
+	void dynamic_bvh::free_node(int32 id)
+	{
+		element & e{ m_nodes[(size_t)id] };
+		e.parent = m_free;
+		e.height = -1;
+		m_free = id;
+	}
+
+	void dynamic_bvh::insert_leaf(int32 leaf)
+	{
+		if (m_root == npos)
+		{
+			m_root = leaf;
+			m_nodes[(size_t)leaf].parent = npos;
+			return;
+		}
+
+		// find the cheapest sibling
+		aabb const leaf_box{ m_nodes[(size_t)leaf].box };
+		int32 index{ m_root };
+		while (!m_nodes[(size_t)index].is_leaf())
+		{
+			element const & e{ m_nodes[(size_t)index] };
+			float32 const area{ e.box.perimeter() };
+			float32 const combined{ e.box.merge(leaf_box).perimeter() };
+
+			// cost of pairing with this node, and the cost pushed down to children
+			float32 const cost{ 2.f * combined };
+			float32 const inherited{ 2.f * (combined - area) };
+
+			auto const child_cost{ [&](int32 c) noexcept
+			{
+				element const & ch{ m_nodes[(size_t)c] };
+				float32 const merged{ ch.box.merge(leaf_box).perimeter() };
+				return ch.is_leaf() ? (merged + inherited) : (merged - ch.box.perimeter() + inherited);
+			} };
+			float32 const cost_left{ child_cost(e.left) };
+			float32 const cost_right{ child_cost(e.right) };
+
+			if (cost < cost_left && cost < cost_right) { break; }
+
+			index = (cost_left < cost_right) ? e.left : e.right;
+		}
+
+		// new parent for the sibling and the leaf
+		int32 const sibling{ index };
+		int32 const old_parent{ m_nodes[(size_t)sibling].parent };
+		int32 const new_parent{ allocate_node() };
+		{
+			element & p{ m_nodes[(size_t)new_parent] };
+			p.parent = old_parent;
+			p.box = leaf_box.merge(m_nodes[(size_t)sibling].box);
+			p.height = m_nodes[(size_t)sibling].height + 1;
+			p.left = sibling;
+			p.right = leaf;
+		}
+		if (old_parent != npos)
+		{
+			element & op{ m_nodes[(size_t)old_parent] };
+			(op.left == sibling ? op.left : op.right) = new_parent;
+		}
+		else
+		{
+			m_root = new_parent;
+		}
+		m_nodes[(size_t)sibling].parent = new_parent;
+		m_nodes[(size_t)leaf].parent = new_parent;
+
+		// refit ancestors
+		for (index = new_parent; index != npos; index = m_nodes[(size_t)index].parent)
+		{
+			index = balance(index);
+			element & e{ m_nodes[(size_t)index] };
+			element const & l{ m_nodes[(size_t)e.left] };
+			element const & r{ m_nodes[(size_t)e.right] };
+			e.height = 1 + std::max(l.height, r.height);
+			e.box = l.box.merge(r.box);
+		}
+	}
+
+	void dynamic_bvh::remove_leaf(int32 leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = npos;
+			return;
+		}
+
+		int32 const parent{ m_nodes[(size_t)leaf].parent };
+		int32 const grand_parent{ m_nodes[(size_t)parent].parent };
+		int32 const sibling{ (m_nodes[(size_t)parent].left == leaf) ? m_nodes[(size_t)parent].right : m_nodes[(size_t)parent].left };
+
+		if (grand_parent == npos)
+		{
+			m_root = sibling;
+			m_nodes[(size_t)sibling].parent = npos;
+			free_node(parent);
+			return;
+		}
+
+		// splice the sibling into the grand parent
+		element & gp{ m_nodes[(size_t)grand_parent] };
+		(gp.left == parent ? gp.left : gp.right) = sibling;
+		m_nodes[(size_t)sibling].parent = grand_parent;
+		free_node(parent);
+
+		// refit ancestors
+		for (int32 index{ grand_parent }; index != npos; index = m_nodes[(size_t)index].parent)
+		{
+			index = balance(index);
+			element & e{ m_nodes[(size_t)index] };
+			element const & l{ m_nodes[(size_t)e.left] };
+			element const & r{ m_nodes[(size_t)e.right] };
+			e.height = 1 + std::max(l.height, r.height);
+			e.box = l.box.merge(r.box);
+		}
+	}
+
+	int32 dynamic_bvh::balance(int32 ia)
+	{
+		// rotate the taller child up when the subtree leans too far
+		element & a{ m_nodes[(size_t)ia] };
+		if (a.is_leaf() || a.height < 2) { return ia; }
+
+		int32 const ib{ a.left }, ic{ a.right };
+		element & b{ m_nodes[(size_t)ib] };
+		element & c{ m_nodes[(size_t)ic] };
+		int32 const diff{ c.height - b.height };
+
+		auto const rotate{ [&](int32 iup, int32 iother) noexcept
+		{
+			// iup replaces a, a takes the shorter grand child of iup
+			element & up{ m_nodes[(size_t)iup] };
+			element & other{ m_nodes[(size_t)iother] };
+			int32 const ix{ up.left }, iy{ up.right };
+			element & x{ m_nodes[(size_t)ix] };
+			element & y{ m_nodes[(size_t)iy] };
+
+			up.left = ia;
+			up.parent = a.parent;
+			a.parent = iup;
+
+			if (up.parent != npos)
+			{
+				element & p{ m_nodes[(size_t)up.parent] };
+				(p.left == ia ? p.left : p.right) = iup;
+			}
+			else
+			{
+				m_root = iup;
+			}
+
+			int32 const keep{ (x.height > y.height) ? ix : iy };
+			int32 const give{ (x.height > y.height) ? iy : ix };
+			up.right = keep;
+			(a.left == iup ? a.left : a.right) = give;
+			m_nodes[(size_t)give].parent = ia;
+
+			a.box = other.box.merge(m_nodes[(size_t)give].box);
+			a.height = 1 + std::max(other.height, m_nodes[(size_t)give].height);
+			up.box = a.box.merge(m_nodes[(size_t)keep].box);
+			up.height = 1 + std::max(a.height, m_nodes[(size_t)keep].height);
+			return iup;
+		} };
+
+		if (diff > 1) { return rotate(ic, ib); }
+		if (diff < -1) { return rotate(ib, ic); }
+		return ia;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
\ No newline at end of file
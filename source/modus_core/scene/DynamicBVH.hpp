@@ -0,0 +1,191 @@
+#ifndef _ML_DYNAMIC_BVH_HPP_
+#define _ML_DYNAMIC_BVH_HPP_
+
+#include <modus_core/scene/Bounds.hpp>
+#include <modus_core/system/Memory.hpp>
+
+namespace ml
+{
+	// dynamic bounding volume hierarchy
+	struct ML_CORE_API dynamic_bvh final : non_copyable, trackable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		using allocator_type = typename pmr::polymorphic_allocator<byte>;
+
+		static constexpr int32 npos{ -1 };
+
+		struct ML_NODISCARD element final
+		{
+			aabb	box		{}; // fat bounds
+			uint32	data	{}; // user data
+			int32	parent	{ npos }; // parent, or next free
+			int32	left	{ npos }; // first child, npos for leaves
+			int32	right	{ npos }; // second child
+			int32	height	{ -1 }; // 0 for leaves, -1 when free
+
+			ML_NODISCARD bool is_leaf() const noexcept { return left == npos; }
+		};
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		dynamic_bvh(float32 margin = .1f, allocator_type alloc = {}) noexcept
+			: m_margin	{ margin }
+			, m_root	{ npos }
+			, m_free	{ npos }
+			, m_count	{}
+			, m_nodes	{ alloc }
+			, m_stack	{ alloc }
+		{
+		}
+
+		void swap(dynamic_bvh & other) noexcept
+		{
+			if (this != std::addressof(other))
+			{
+				std::swap(m_margin, other.m_margin);
+				std::swap(m_root, other.m_root);
+				std::swap(m_free, other.m_free);
+				std::swap(m_count, other.m_count);
+				std::swap(m_nodes, other.m_nodes);
+				std::swap(m_stack, other.m_stack);
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// insert a box, returns a proxy id
+		int32 create_proxy(aabb const & box, uint32 data);
+
+		void destroy_proxy(int32 id);
+
+		// returns true if the proxy had to be reinserted
+		bool move_proxy(int32 id, aabb const & box);
+
+		void clear() noexcept
+		{
+			m_root = m_free = npos;
+			m_count = 0;
+			m_nodes.clear();
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD size_t size() const noexcept { return m_count; }
+
+		ML_NODISCARD uint32 get_data(int32 id) const noexcept { return m_nodes[(size_t)id].data; }
+
+		ML_NODISCARD aabb const & get_fat_bounds(int32 id) const noexcept { return m_nodes[(size_t)id].box; }
+
+		ML_NODISCARD int32 get_height() const noexcept { return (m_root == npos) ? 0 : m_nodes[(size_t)m_root].height; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// visit every proxy inside or touching the frustum
+		template <class Fn
+		> void query(frustum const & value, Fn && fn)
+		{
+			if (m_root == npos) { return; }
+			m_stack.clear();
+			m_stack.push_back(m_root);
+			while (!m_stack.empty())
+			{
+				element const & e{ m_nodes[(size_t)m_stack.back()] };
+				m_stack.pop_back();
+				switch (value.test(e.box))
+				{
+				case frustum::outside: break;
+				case frustum::inside: visit_leaves(e, fn); break;
+				default:
+					if (e.is_leaf()) { fn(e.data); }
+					else { m_stack.push_back(e.left); m_stack.push_back(e.right); }
+					break;
+				}
+			}
+		}
+
+		// visit every proxy overlapping the box
+		template <class Fn
+		> void query(aabb const & value, Fn && fn)
+		{
+			if (m_root == npos) { return; }
+			m_stack.clear();
+			m_stack.push_back(m_root);
+			while (!m_stack.empty())
+			{
+				element const & e{ m_nodes[(size_t)m_stack.back()] };
+				m_stack.pop_back();
+				if (!e.box.overlaps(value)) { continue; }
+				if (e.is_leaf()) { fn(e.data); }
+				else { m_stack.push_back(e.left); m_stack.push_back(e.right); }
+			}
+		}
+
+		// closest hit along the ray, fn(data) returns the exact distance or a negative number to ignore
+		template <class Fn
+		> bool raycast(ray const & value, Fn && fn, uint32 * hit = nullptr, float32 * distance = nullptr, float32 max_distance = FLT_MAX)
+		{
+			if (m_root == npos) { return false; }
+			bool found{};
+			float32 best{ max_distance };
+			m_stack.clear();
+			m_stack.push_back(m_root);
+			while (!m_stack.empty())
+			{
+				element const & e{ m_nodes[(size_t)m_stack.back()] };
+				m_stack.pop_back();
+				if (float32 const t{ value.intersect(e.box, best) }; t < 0.f) { continue; }
+				else if (!e.is_leaf()) { m_stack.push_back(e.left); m_stack.push_back(e.right); }
+				else if (float32 const d{ fn(e.data) }; 0.f <= d && d < best)
+				{
+					best = d;
+					found = true;
+					if (hit) { *hit = e.data; }
+				}
+			}
+			if (found && distance) { *distance = best; }
+			return found;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		template <class Fn
+		> void visit_leaves(element const & root, Fn && fn)
+		{
+			if (root.is_leaf()) { fn(root.data); return; }
+			size_t const base{ m_stack.size() };
+			m_stack.push_back(root.left);
+			m_stack.push_back(root.right);
+			while (m_stack.size() > base)
+			{
+				element const & e{ m_nodes[(size_t)m_stack.back()] };
+				m_stack.pop_back();
+				if (e.is_leaf()) { fn(e.data); }
+				else { m_stack.push_back(e.left); m_stack.push_back(e.right); }
+			}
+		}
+
+		int32 allocate_node();
+
+		void free_node(int32 id);
+
+		void insert_leaf(int32 leaf);
+
+		void remove_leaf(int32 leaf);
+
+		int32 balance(int32 a);
+
+		float32			m_margin	; // fat box margin
+		int32			m_root		; // root node
+		int32			m_free		; // free list
+		size_t			m_count		; // proxy count
+		list<element>	m_nodes		; // nodes
+		list<int32>		m_stack		; // traversal stack
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+#endif // !_ML_DYNAMIC_BVH_HPP_
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef _ML_NODE_HPP_
 #define _ML_NODE_HPP_
 
+#include <modus_core/detail/SmallVector.hpp>
+#include <modus_core/system/StringTable.hpp>
 #include <modus_core/system/Variable.hpp>
 
 namespace ml
@@ -14,16 +16,17 @@ namespace ml
 
 	public:
 		using allocator_type			= typename pmr::polymorphic_allocator<byte>;
-		using iterator					= typename list<ref<node>>::iterator;
-		using const_iterator			= typename list<ref<node>>::const_iterator;
-		using reverse_iterator			= typename list<ref<node>>::reverse_iterator;
-		using const_reverse_iterator	= typename list<ref<node>>::const_reverse_iterator;
+		using child_storage				= typename small_vector<ref<node>, 4>;
+		using iterator					= typename child_storage::iterator;
+		using const_iterator			= typename child_storage::const_iterator;
+		using reverse_iterator			= typename child_storage::reverse_iterator;
+		using const_reverse_iterator	= typename child_storage::const_reverse_iterator;
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	public:
 		node(allocator_type alloc = {}) noexcept
-			: m_name	{ "New Node", alloc }
+			: m_name	{ "New Node" }
 			, m_tree	{}
 			, m_parent	{}
 			, m_children{ alloc }
@@ -31,8 +34,8 @@ namespace ml
 		{
 		}
 
-		node(string const & name, scene_tree * tree, ref<node> const & parent = {}, allocator_type alloc = {})
-			: m_name	{ name.empty() ? "New Node" : name, alloc }
+		node(interned_string const & name, scene_tree * tree, ref<node> const & parent = {}, allocator_type alloc = {})
+			: m_name	{ name.empty() ? interned_string{ "New Node" } : name }
 			, m_tree	{ tree }
 			, m_parent	{ parent }
 			, m_children{ alloc }
@@ -41,7 +44,7 @@ namespace ml
 		}
 
 		node(node && other, allocator_type alloc = {}) noexcept
-			: m_name	{ alloc }
+			: m_name	{}
 			, m_tree	{}
 			, m_parent	{}
 			, m_children{ alloc }
@@ -71,15 +74,19 @@ namespace ml
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	public:
-		ML_NODISCARD auto get_name() const noexcept -> string const & { return m_name; }
+		ML_NODISCARD auto get_name() const noexcept -> interned_string const & { return m_name; }
 
-		void set_name(string const & value) noexcept { if (m_name != value) { m_name = value; } }
+		void set_name(interned_string const & value) noexcept { m_name = value; }
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	public:
 		template <class T, class ... Args
-		> auto & emplace(Args && ... args) noexcept { return m_value.emplace<T>(ML_forward(args)...); }
+		> auto & emplace(Args && ... args) noexcept
+		{
+			this->on_hierarchy_changed(); // may be an entity
+			return m_value.emplace<T>(ML_forward(args)...);
+		}
 
 		template <class T> ML_NODISCARD bool has() const noexcept { return m_value.has<T>(); }
 
@@ -109,12 +116,12 @@ namespace ml
 			return m_children.size();
 		}
 
-		ML_NODISCARD auto get_children() noexcept -> list<ref<node>> &
+		ML_NODISCARD auto get_children() noexcept -> child_storage &
 		{
 			return m_children;
 		}
 
-		ML_NODISCARD auto get_children() const noexcept -> list<ref<node>> const &
+		ML_NODISCARD auto get_children() const noexcept -> child_storage const &
 		{
 			return m_children;
 		}
@@ -176,8 +183,9 @@ namespace ml
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-		auto new_child(string const & name) -> ref<node> &
+		auto new_child(interned_string const & name) -> ref<node> &
 		{
+			this->on_hierarchy_changed();
 			return m_children.emplace_back(_ML make_ref<node>(name, m_tree, shared_from_this()));
 		}
 
@@ -188,16 +196,18 @@ namespace ml
 
 		void delete_child(size_t i)
 		{
-			if (i < m_children.size()) { m_children.erase(m_children.begin() + (ptrdiff_t)i); }
+			if (i < m_children.size()) { m_children.erase(m_children.begin() + (ptrdiff_t)i); this->on_hierarchy_changed(); }
 		}
 
 		void clear_children()
 		{
+			this->on_hierarchy_changed();
 			m_children.clear();
 		}
 
 		void detatch_children()
 		{
+			this->on_hierarchy_changed();
 			for (auto const & child : m_children)
 			{
 				child->m_parent = m_parent;
@@ -222,6 +232,8 @@ namespace ml
 
 				m_parent = value;
 
+				this->on_hierarchy_changed();
+
 				return true;
 			}
 		}
@@ -307,13 +319,13 @@ namespace ml
 		}
 
 		template <bool Recursive = false
-		> auto find(string const & name) -> ref<node>
+		> auto find(interned_string const & name) -> ref<node>
 		{
 			return this->find_if<Recursive>([&](auto const & e) { return e && e->get_name() == name; });
 		}
 
 		template <bool Recursive = false
-		> auto find(string const & name) const -> ref<node>
+		> auto find(interned_string const & name) const -> ref<node>
 		{
 			return this->find_if<Recursive>([&](auto const & e) { return e && e->get_name() == name; });
 		}
@@ -350,10 +362,13 @@ namespace ml
 	private:
 		friend scene_tree;
 
-		string					m_name		; // name
+		// entity transforms are parented again on the tree's next update
+		void on_hierarchy_changed() noexcept;
+
+		interned_string			m_name		; // name
 		scene_tree *		m_tree		; // tree
 		weak<node>			m_parent	; // parent
-		list<ref<node>>		m_children	; // children
+		child_storage		m_children	; // children
 		variable				m_value		; // value
 		
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -0,0 +1,408 @@
+#include <modus_core/scene/SceneSerializer.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	static_assert(std::is_trivially_copyable_v<transform_component>);
+
+	static_assert(std::is_trivially_copyable_v<aabb>);
+
+	// nodes in pre-order with the index of their parent
+	static void flatten_nodes(ref<node> const & root, list<std::pair<node const *, int32>> & out)
+	{
+		list<std::pair<node const *, int32>> stack{};
+		stack.push_back({ root.get(), -1 });
+		while (!stack.empty())
+		{
+			auto const [n, parent] { stack.back() };
+			stack.pop_back();
+
+			int32 const self{ (int32)out.size() };
+			out.push_back({ n, parent });
+
+			// push in reverse so children come out in order
+			for (auto it{ n->rbegin() }; it != n->rend(); ++it)
+			{
+				if (*it) { stack.push_back({ it->get(), self }); }
+			}
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	bool save_scene(fs::path const & path, scene_tree & value)
+	{
+		std::ofstream file{ path, std::ios_base::binary };
+		ML_defer(&file) { file.close(); };
+		if (!file) { return false; }
+
+		auto const put{ [&](auto const & v) { file.write((cstring)std::addressof(v), sizeof(v)); } };
+
+		auto const put_string{ [&](std::string_view v) { put((uint32)v.size()); file.write(v.data(), (std::streamsize)v.size()); } };
+
+		// tag, size, payload
+		auto const put_chunk{ [&](uint32 tag, auto && fn)
+		{
+			put(tag);
+			auto const size_pos{ file.tellp() };
+			put(uint32{});
+			fn();
+			auto const end_pos{ file.tellp() };
+			file.seekp(size_pos);
+			put((uint32)(end_pos - size_pos - (std::streamoff)sizeof(uint32)));
+			file.seekp(end_pos);
+		} };
+
+		// header
+		put((uint32)scene_chunk_magic);
+		put(scene_format_version);
+		put(scene_byte_order_mark);
+
+		// entities
+		entt::registry & reg{ value.get_reg() };
+		hash_map<entt::entity, uint32> index{};
+		reg.each([&](entt::entity e) { index.insert({ e, (uint32)index.size() }); });
+		put_chunk(scene_chunk_entities, [&]()
+		{
+			put((uint32)index.size());
+		});
+
+		// nodes
+		list<std::pair<node const *, int32>> nodes{};
+		if (value.get_root()) { flatten_nodes(value.get_root(), nodes); }
+		put_chunk(scene_chunk_nodes, [&]()
+		{
+			put((uint32)nodes.size());
+			for (auto const & [n, parent] : nodes)
+			{
+				int32 ent{ -1 };
+				if (n->has<entity>())
+				{
+					if (auto const it{ index.find(n->get<entity>().get_handle()) }; it != index.end())
+					{
+						ent = (int32)it->second;
+					}
+				}
+				put(parent);
+				put(ent);
+				put_string(parent < 0 ? value.get_name() : n->get_name());
+			}
+		});
+
+		// components, one column at a time straight out of the pools
+		auto const put_entities{ [&](auto const & view)
+		{
+			put((uint32)view.size());
+			for (size_t i = 0, imax = view.size(); i < imax; ++i)
+			{
+				put(index[view.data()[i]]);
+			}
+		} };
+
+		put_chunk(scene_chunk_tags, [&, view = reg.view<tag_component>()]()
+		{
+			put_entities(view);
+			for (size_t i = 0, imax = view.size(); i < imax; ++i)
+			{
+				put_string(view.raw()[i].tag);
+			}
+		});
+
+		put_chunk(scene_chunk_transforms, [&, view = reg.view<transform_component>()]()
+		{
+			put_entities(view);
+			file.write((cstring)view.raw(), (std::streamsize)(view.size() * sizeof(transform_component)));
+		});
+
+		put_chunk(scene_chunk_bounds, [&, view = reg.view<bounds_component>()]()
+		{
+			put_entities(view);
+			for (size_t i = 0, imax = view.size(); i < imax; ++i)
+			{
+				put(view.raw()[i].bounds);
+			}
+		});
+
+		return (bool)file;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	bool scene_loader::open(fs::path const & path) noexcept
+	{
+		this->close();
+
+		if (!m_file.open(path)) { return false; }
+
+		// header
+		m_chunk_end = m_file.size();
+		uint32 magic{}, version{}, order{ scene_byte_order_mark };
+		if (!read(magic) || !read(version) || magic != scene_chunk_magic || version > scene_format_version ||
+			(1 < version && (!read(order) || order != scene_byte_order_mark)))
+		{
+			m_error = true;
+			m_file.close();
+			return false;
+		}
+		m_chunk_end = m_cursor;
+		return true;
+	}
+
+	void scene_loader::close() noexcept
+	{
+		m_file.close();
+		m_cursor = m_chunk_end = m_column = 0;
+		m_chunk_tag = m_count = m_index = 0;
+		m_entities.clear();
+		m_nodes.clear();
+		m_done = m_error = false;
+	}
+
+	bool scene_loader::step(scene_tree & value, size_t budget)
+	{
+		if (!m_file || m_done || m_error) { return m_done; }
+
+		while (budget && !m_error)
+		{
+			// next chunk
+			if (m_cursor >= m_chunk_end)
+			{
+				if (m_cursor >= m_file.size()) { m_done = true; break; }
+
+				if (!begin_chunk()) { break; }
+			}
+
+			// out of budget
+			if (!step_chunk(value, budget)) { break; }
+		}
+		return m_done;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	bool scene_loader::read(interned_string & value) noexcept
+	{
+		uint32 size{};
+		if (!read(size)) { return false; }
+		if (m_cursor + size > m_chunk_end) { m_error = true; return false; }
+		value = interned_string{ std::string_view{ (cstring)m_file.data() + m_cursor, size } };
+		m_cursor += size;
+		return true;
+	}
+
+	bool scene_loader::begin_chunk() noexcept
+	{
+		m_chunk_end = m_file.size();
+		uint32 tag{}, size{};
+		if (!read(tag) || !read(size)) { return false; }
+		if (m_cursor + size > m_file.size()) { m_error = true; return false; }
+
+		m_chunk_tag = tag;
+		m_chunk_end = m_cursor + size;
+		m_count = m_index = 0;
+		switch (tag)
+		{
+		case scene_chunk_entities:
+		case scene_chunk_nodes:
+			read(m_count);
+			break;
+
+		case scene_chunk_tags:
+		case scene_chunk_transforms:
+		case scene_chunk_bounds:
+			read(m_count);
+			m_column = m_cursor;
+			m_cursor += (size_t)m_count * sizeof(uint32);
+			if (m_cursor > m_chunk_end) { m_error = true; }
+			break;
+
+		default: // skip
+			m_cursor = m_chunk_end;
+			break;
+		}
+		return !m_error;
+	}
+
+	bool scene_loader::step_chunk(scene_tree & value, size_t & budget)
+	{
+		entt::registry & reg{ value.get_reg() };
+
+		auto const spend{ [&](size_t n) noexcept { budget = (n < budget) ? (budget - n) : 0; } };
+
+		auto const entity_at{ [&](uint32 i) noexcept -> entt::entity
+		{
+			uint32 k{};
+			std::memcpy(&k, m_file.data() + m_column + i * sizeof(uint32), sizeof(uint32));
+			return (k < m_entities.size()) ? m_entities[k] : entt::null;
+		} };
+
+		switch (m_chunk_tag)
+		{
+		case scene_chunk_entities: {
+			m_entities.reserve(m_count);
+			for (; m_index < m_count; ++m_index) { m_entities.push_back(reg.create()); }
+			spend((size_t)m_count * sizeof(uint32));
+		} break;
+
+		case scene_chunk_nodes: {
+			for (; m_index < m_count && budget; ++m_index)
+			{
+				size_t const start{ m_cursor };
+				int32 parent{}, ent{};
+				interned_string name{};
+				if (!read(parent) || !read(ent) || !read(name)) { return false; }
+
+				ref<node> n{};
+				if (parent < 0)
+				{
+					n = value.get_root();
+					n->set_name(name);
+					value.set_name(name);
+				}
+				else if ((size_t)parent < m_nodes.size())
+				{
+					n = m_nodes[(size_t)parent]->new_child(name);
+				}
+				else
+				{
+					m_error = true;
+					return false;
+				}
+				if (0 <= ent && (size_t)ent < m_entities.size())
+				{
+					n->emplace<entity>(&value, m_entities[(size_t)ent]);
+				}
+				m_nodes.push_back(n);
+				spend(m_cursor - start);
+			}
+		} break;
+
+		case scene_chunk_tags: {
+			for (; m_index < m_count && budget; ++m_index)
+			{
+				size_t const start{ m_cursor };
+				tag_component c{};
+				if (!read(c.tag)) { return false; }
+				if (entt::entity const e{ entity_at(m_index) }; reg.valid(e))
+				{
+					reg.emplace_or_replace<tag_component>(e, std::move(c));
+				}
+				spend(m_cursor - start);
+			}
+		} break;
+
+		case scene_chunk_transforms: {
+			for (; m_index < m_count && budget; ++m_index)
+			{
+				transform_component c{};
+				if (!read(c)) { return false; }
+				if (entt::entity const e{ entity_at(m_index) }; reg.valid(e))
+				{
+					reg.emplace_or_replace<transform_component>(e, c);
+				}
+				spend(sizeof(c));
+			}
+		} break;
+
+		case scene_chunk_bounds: {
+			for (; m_index < m_count && budget; ++m_index)
+			{
+				bounds_component c{};
+				if (!read(c.bounds)) { return false; }
+				if (entt::entity const e{ entity_at(m_index) }; reg.valid(e))
+				{
+					reg.emplace_or_replace<bounds_component>(e, c);
+				}
+				spend(sizeof(c.bounds));
+			}
+		} break;
+		}
+
+		if (m_index < m_count) { return false; }
+
+		m_cursor = m_chunk_end;
+		return true;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void from_json(json const & j, scene_tree & v)
+	{
+		entt::registry & reg{ v.get_reg() };
+
+		// entities
+		list<entt::entity> entities{};
+		if (j.contains("entities"))
+		{
+			for (json const & je : j["entities"])
+			{
+				entt::entity const e{ entities.emplace_back(reg.create()) };
+				if (je.contains("tag")) { reg.emplace<tag_component>(e, je["tag"].get<tag_component>()); }
+				if (je.contains("transform")) { reg.emplace<transform_component>(e, je["transform"].get<transform_component>()); }
+				if (je.contains("bounds")) { reg.emplace<bounds_component>(e, je["bounds"].get<bounds_component>()); }
+			}
+		}
+
+		// nodes
+		list<ref<node>> nodes{};
+		if (j.contains("nodes"))
+		{
+			for (json const & jn : j["nodes"])
+			{
+				int32 const parent{ jn["parent"].get<int32>() };
+				int32 const ent{ jn["entity"].get<int32>() };
+				interned_string name{};
+				jn["name"].get_to(name);
+
+				ref<node> n{};
+				if (parent < 0) { n = v.get_root(); n->set_name(name); v.set_name(name); }
+				else if ((size_t)parent < nodes.size()) { n = nodes[(size_t)parent]->new_child(name); }
+				else { continue; }
+
+				if (0 <= ent && (size_t)ent < entities.size()) { n->emplace<entity>(&v, entities[(size_t)ent]); }
+				nodes.push_back(n);
+			}
+		}
+	}
+
+	void to_json(json & j, scene_tree const & v)
+	{
+		entt::registry const & reg{ v.get_reg() };
+
+		// entities
+		hash_map<entt::entity, int32> index{};
+		json & je{ j["entities"] = json::array() };
+		reg.each([&](entt::entity e)
+		{
+			index.insert({ e, (int32)index.size() });
+			json & c{ je.emplace_back(json::object()) };
+			if (reg.has<tag_component>(e)) { c["tag"] = reg.get<tag_component>(e); }
+			if (reg.has<transform_component>(e)) { c["transform"] = reg.get<transform_component>(e); }
+			if (reg.has<bounds_component>(e)) { c["bounds"] = reg.get<bounds_component>(e); }
+		});
+
+		// nodes
+		list<std::pair<node const *, int32>> nodes{};
+		if (v.get_root()) { flatten_nodes(v.get_root(), nodes); }
+		json & jn{ j["nodes"] = json::array() };
+		for (auto const & [n, parent] : nodes)
+		{
+			int32 ent{ -1 };
+			if (n->has<entity>())
+			{
+				if (auto const it{ index.find(n->get<entity>().get_handle()) }; it != index.end())
+				{
+					ent = it->second;
+				}
+			}
+			json & o{ jn.emplace_back(json::object()) };
+			o["name"] = (parent < 0) ? v.get_name() : n->get_name();
+			o["parent"] = parent;
+			o["entity"] = ent;
+		}
+		j["name"] = v.get_name();
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
\ No newline at end of file
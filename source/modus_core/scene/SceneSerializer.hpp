@@ -0,0 +1,123 @@
+#ifndef _ML_SCENE_SERIALIZER_HPP_
+#define _ML_SCENE_SERIALIZER_HPP_
+
+#include <modus_core/scene/Components.hpp>
+#include <modus_core/system/MappedFile.hpp>
+
+// binary scene format
+//
+// header	: magic, version, byte order mark
+// chunks	: tag, size, payload
+//
+// ENTS		: entity count
+// NODE		: node count, then per node in pre-order { parent, entity, name }
+// TAGS		: count, entity column, then per tag { name }
+// XFRM		: count, entity column, transform column
+// BNDS		: count, entity column, bounds column
+//
+// unknown chunks are skipped, values are stored in the byte order of the host that wrote them
+// so columns can be copied straight out of the pools, files from a host of the other order are rejected
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	static constexpr uint32 make_scene_tag(char a, char b, char c, char d) noexcept
+	{
+		return (uint32)a | ((uint32)b << 8) | ((uint32)c << 16) | ((uint32)d << 24);
+	}
+
+	enum scene_chunk_ : uint32
+	{
+		scene_chunk_magic		= make_scene_tag('M', 'L', 'S', 'C'),
+		scene_chunk_entities	= make_scene_tag('E', 'N', 'T', 'S'),
+		scene_chunk_nodes		= make_scene_tag('N', 'O', 'D', 'E'),
+		scene_chunk_tags		= make_scene_tag('T', 'A', 'G', 'S'),
+		scene_chunk_transforms	= make_scene_tag('X', 'F', 'R', 'M'),
+		scene_chunk_bounds		= make_scene_tag('B', 'N', 'D', 'S'),
+	};
+
+	static constexpr uint32 scene_format_version{ 2 };
+
+	static constexpr uint32 scene_byte_order_mark{ 0x01020304 };
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// write a scene in the binary format
+	ML_CORE_API bool save_scene(fs::path const & path, scene_tree & value);
+
+	// streaming binary scene loader
+	struct ML_CORE_API scene_loader final : non_copyable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		scene_loader() noexcept = default;
+
+		explicit scene_loader(fs::path const & path) noexcept { this->open(path); }
+
+		// map the file and check the header
+		bool open(fs::path const & path) noexcept;
+
+		void close() noexcept;
+
+		// load up to budget bytes into the tree, returns true once everything is in
+		bool step(scene_tree & value, size_t budget = static_cast<size_t>(-1));
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD bool is_open() const noexcept { return (bool)m_file; }
+
+		ML_NODISCARD bool is_done() const noexcept { return m_done; }
+
+		ML_NODISCARD bool has_error() const noexcept { return m_error; }
+
+		ML_NODISCARD float32 get_progress() const noexcept
+		{
+			return m_file.size() ? ((float32)m_cursor / (float32)m_file.size()) : 1.f;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		// read from the current chunk
+		template <class T> bool read(T & value) noexcept
+		{
+			if (m_cursor + sizeof(T) > m_chunk_end) { m_error = true; return false; }
+			std::memcpy(&value, m_file.data() + m_cursor, sizeof(T));
+			m_cursor += sizeof(T);
+			return true;
+		}
+
+		bool read(interned_string & value) noexcept;
+
+		bool begin_chunk() noexcept;
+
+		bool step_chunk(scene_tree & value, size_t & budget);
+
+		mapped_file				m_file		{}; // mapped scene
+		size_t					m_cursor	{}; // read position
+		size_t					m_chunk_end	{}; // end of the current chunk
+		uint32					m_chunk_tag	{}; // current chunk
+		uint32					m_count		{}; // elements in the current chunk
+		uint32					m_index		{}; // next element in the current chunk
+		size_t					m_column	{}; // entity column of the current chunk
+		list<entt::entity>		m_entities	{}; // file index -> entity
+		list<ref<node>>			m_nodes		{}; // file index -> node
+		bool					m_done		{}; // finished
+		bool					m_error		{}; // malformed file
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+
+	// load a whole scene at once
+	inline bool load_scene(fs::path const & path, scene_tree & value)
+	{
+		scene_loader loader{ path };
+		return loader.is_open() && loader.step(value) && !loader.has_error();
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+#endif // !_ML_SCENE_SERIALIZER_HPP_
\ No newline at end of file
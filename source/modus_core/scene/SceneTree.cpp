@@ -1,11 +1,24 @@
 #include <modus_core/scene/Components.hpp>
+#include <modus_core/scene/Entity.hpp>
 #include <modus_core/events/SceneEvents.hpp>
+#include <modus_core/runtime/GuiApplication.hpp>
 
 namespace ml
 {
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-	scene_tree::~scene_tree() noexcept {}
+	scene_tree::~scene_tree() noexcept
+	{
+		this->set_animating(false);
+		this->disconnect_signals();
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void node::on_hierarchy_changed() noexcept
+	{
+		if (m_tree) { m_tree->m_hierarchy = true; }
+	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
@@ -24,6 +37,186 @@ namespace ml
 
 			scr.instance->on_update(dt);
 		});
+
+		// running behaviors change the scene every step, the loop can't block on input
+		this->set_animating(has_behaviors());
+
+		// components are written directly, only what changed is handed to the transform system
+		if (m_hierarchy) { this->update_hierarchy(); }
+		m_reg.view<transform_component, hierarchy_component>().each([&](auto e, transform_component & xf, hierarchy_component & h)
+		{
+			if (m_transforms.get_position(h.id) != xf.position) { m_transforms.set_position(h.id, xf.position); }
+			if (m_transforms.get_rotation(h.id) != xf.rotation) { m_transforms.set_rotation(h.id, xf.rotation); }
+			if (m_transforms.get_scale(h.id) != xf.scale) { m_transforms.set_scale(h.id, xf.scale); }
+		});
+		m_transforms.update();
+
+		// keep entity bounds in the bvh, moves inside the fat box are free
+		m_reg.view<transform_component, bounds_component>().each([&](auto e, transform_component & xf, bounds_component & b)
+		{
+			aabb const box{ b.bounds.transform(get_world_matrix(e)) };
+			if (b.proxy == dynamic_bvh::npos)
+			{
+				b.proxy = m_bvh.create_proxy(box, static_cast<uint32>(e));
+			}
+			else
+			{
+				m_bvh.move_proxy(b.proxy, box);
+			}
+		});
+	}
+
+	bool scene_tree::has_behaviors() const noexcept
+	{
+		// unbound components don't count
+		auto const view{ m_reg.view<behavior_component const>() };
+		for (auto const e : view)
+		{
+			if (behavior_component const & scr{ view.get<behavior_component const>(e) }; scr.instance || scr.create_instance)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void scene_tree::set_animating(bool value) noexcept
+	{
+		if (m_animating == value) { return; }
+		m_animating = value;
+		if (gui_application * const app{ ML_get_global(gui_application) })
+		{
+			value ? app->begin_animation() : app->end_animation();
+		}
+	}
+
+	entt::entity scene_tree::pick(ray const & value, float32 * distance)
+	{
+		uint32 hit{};
+		bool const found{ m_bvh.raycast(value, [&](uint32 data)
+		{
+			// test the tight box, the tree only stores fat ones
+			auto const e{ static_cast<entt::entity>(data) };
+			if (!m_reg.valid(e) || !m_reg.has<transform_component, bounds_component>(e)) { return -1.f; }
+			return value.intersect(m_reg.get<bounds_component>(e).bounds.transform(get_world_matrix(e)));
+		}, &hit, distance) };
+		return found ? static_cast<entt::entity>(hit) : entt::null;
+	}
+
+	mat4 scene_tree::get_world_matrix(entt::entity value) const
+	{
+		if (!m_reg.valid(value)) { return mat4::identity(); }
+		else if (auto const h{ m_reg.try_get<hierarchy_component>(value) }; h && m_transforms.contains(h->id))
+		{
+			return m_transforms.get_world_matrix(h->id);
+		}
+		else if (auto const xf{ m_reg.try_get<transform_component>(value) })
+		{
+			return xf->get_transform();
+		}
+		else
+		{
+			return mat4::identity();
+		}
+	}
+
+	mat4 scene_tree::get_world_matrix(entt::entity value, float32 alpha) const
+	{
+		if (auto const h{ m_reg.valid(value) ? m_reg.try_get<hierarchy_component>(value) : nullptr }; h && m_transforms.contains(h->id))
+		{
+			return m_transforms.get_world_matrix(h->id, alpha);
+		}
+		else
+		{
+			return get_world_matrix(value);
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void scene_tree::connect_signals()
+	{
+		m_reg.on_construct<transform_component>().connect<&scene_tree::on_transform_construct>(this);
+		m_reg.on_destroy<transform_component>().connect<&scene_tree::on_transform_destroy>(this);
+		m_reg.on_destroy<hierarchy_component>().connect<&scene_tree::on_hierarchy_destroy>(this);
+		m_reg.on_destroy<bounds_component>().connect<&scene_tree::on_bounds_destroy>(this);
+	}
+
+	void scene_tree::disconnect_signals()
+	{
+		m_reg.on_construct<transform_component>().disconnect(this);
+		m_reg.on_destroy<transform_component>().disconnect(this);
+		m_reg.on_destroy<hierarchy_component>().disconnect(this);
+		m_reg.on_destroy<bounds_component>().disconnect(this);
+	}
+
+	void scene_tree::on_transform_construct(entt::registry & reg, entt::entity e)
+	{
+		// parented once the nodes are walked, the values are copied in on update
+		transform_component const & xf{ reg.get<transform_component>(e) };
+		reg.emplace_or_replace<hierarchy_component>(e, hierarchy_component{
+			m_transforms.create(transform_system::npos, xf.position, xf.rotation, xf.scale)
+		});
+		m_hierarchy = true;
+	}
+
+	void scene_tree::on_transform_destroy(entt::registry & reg, entt::entity e)
+	{
+		if (reg.has<hierarchy_component>(e)) { reg.remove<hierarchy_component>(e); }
+	}
+
+	void scene_tree::on_hierarchy_destroy(entt::registry & reg, entt::entity e)
+	{
+		// entities below keep their place in the world until the nodes are walked again
+		m_transforms.destroy(reg.get<hierarchy_component>(e).id, false);
+		m_hierarchy = true;
+	}
+
+	void scene_tree::on_bounds_destroy(entt::registry & reg, entt::entity e)
+	{
+		// removed with the component or the entity, so queries never see dead ids
+		if (bounds_component & b{ reg.get<bounds_component>(e) }; b.proxy != dynamic_bvh::npos)
+		{
+			m_bvh.destroy_proxy(std::exchange(b.proxy, dynamic_bvh::npos));
+		}
+	}
+
+	void scene_tree::update_hierarchy()
+	{
+		m_hierarchy = false;
+		m_reg.view<hierarchy_component>().each([&](auto e, hierarchy_component & h)
+		{
+			h.parent = transform_system::npos;
+		});
+
+		// each entity follows the nearest node above it that holds an entity with a transform
+		list<std::pair<node const *, transform_system::id_type>> stack{};
+		if (m_root) { stack.push_back({ m_root.get(), transform_system::npos }); }
+		while (!stack.empty())
+		{
+			auto const [n, parent] { stack.back() };
+			stack.pop_back();
+
+			transform_system::id_type self{ parent };
+			if (n->has<entity>())
+			{
+				entt::entity const e{ n->get<entity>().get_handle() };
+				if (hierarchy_component * const h{ m_reg.valid(e) ? m_reg.try_get<hierarchy_component>(e) : nullptr })
+				{
+					h->parent = parent;
+					self = h->id;
+				}
+			}
+			for (ref<node> const & child : *n)
+			{
+				if (child) { stack.push_back({ child.get(), self }); }
+			}
+		}
+
+		m_reg.view<hierarchy_component>().each([&](auto e, hierarchy_component & h)
+		{
+			if (m_transforms.get_parent(h.id) != h.parent) { (void)m_transforms.set_parent(h.id, h.parent); }
+		});
 	}
 
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -36,6 +229,10 @@ namespace ml
 	{
 	}
 
+	template <> void scene_tree::on_component_added<bounds_component>(entity & e, bounds_component & c)
+	{
+	}
+
 	template <> void scene_tree::on_component_added<camera_component>(entity & e, camera_component & c)
 	{
 	}
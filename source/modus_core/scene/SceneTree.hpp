@@ -3,7 +3,9 @@
 
 #include <modus_core/detail/Duration.hpp>
 #include <modus_core/detail/Matrix.hpp>
+#include <modus_core/scene/DynamicBVH.hpp>
 #include <modus_core/scene/Node.hpp>
+#include <modus_core/scene/TransformSystem.hpp>
 #include <modus_core/system/EventSystem.hpp>
 #include <entt/entt.hpp>
 
@@ -23,17 +25,26 @@ namespace ml
 	public:
 		virtual ~scene_tree() noexcept override;
 
-		scene_tree(string const & name, allocator_type alloc = {}) noexcept
-			: m_name{ name.empty() ? "New Scene" : name, alloc }
-			, m_reg	{}
-			, m_root{ _ML make_ref<node>(name, this, nullptr, alloc) }
+		scene_tree(interned_string const & name, allocator_type alloc = {}) noexcept
+			: m_name		{ name.empty() ? interned_string{ "New Scene" } : name }
+			, m_reg			{}
+			, m_root		{ _ML make_ref<node>(name, this, nullptr, alloc) }
+			, m_transforms	{ alloc }
+			, m_bvh			{ .1f, alloc }
+			, m_hierarchy	{}
+			, m_animating	{}
 		{
+			this->connect_signals();
 		}
 
 		scene_tree(scene_tree && other, allocator_type alloc = {}) noexcept
-			: m_name{ alloc }
-			, m_reg	{}
-			, m_root{}
+			: m_name		{}
+			, m_reg			{}
+			, m_root		{}
+			, m_transforms	{ alloc }
+			, m_bvh			{ .1f, alloc }
+			, m_hierarchy	{}
+			, m_animating	{}
 		{
 			this->swap(std::move(other));
 		}
@@ -48,16 +59,25 @@ namespace ml
 		{
 			if (this != std::addressof(other))
 			{
+				// registry signals are bound to the tree that owns the registry
+				this->disconnect_signals();
+				other.disconnect_signals();
 				std::swap(m_name, other.m_name);
 				std::swap(m_reg, other.m_reg);
 				std::swap(m_root, other.m_root);
+				m_transforms.swap(other.m_transforms);
+				m_bvh.swap(other.m_bvh);
+				std::swap(m_hierarchy, other.m_hierarchy);
+				std::swap(m_animating, other.m_animating);
+				this->connect_signals();
+				other.connect_signals();
 			}
 		}
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	public:
-		ML_NODISCARD auto get_name() const noexcept -> string const & { return m_name; }
+		ML_NODISCARD auto get_name() const noexcept -> interned_string const & { return m_name; }
 
 		ML_NODISCARD auto get_reg() noexcept -> entt::registry & { return m_reg; }
 
@@ -67,13 +87,43 @@ namespace ml
 
 		ML_NODISCARD auto get_root() const noexcept -> ref<node> const & { return m_root; }
 
-		void set_name(string const & name) noexcept { if (m_name != name) { m_name = name; } }
+		ML_NODISCARD auto get_transforms() noexcept -> transform_system & { return m_transforms; }
+
+		ML_NODISCARD auto get_transforms() const noexcept -> transform_system const & { return m_transforms; }
+
+		ML_NODISCARD auto get_bvh() noexcept -> dynamic_bvh & { return m_bvh; }
+
+		ML_NODISCARD auto get_bvh() const noexcept -> dynamic_bvh const & { return m_bvh; }
+
+		void set_name(interned_string const & name) noexcept { m_name = name; }
+
+		// world matrix of an entity as of the last update
+		ML_NODISCARD mat4 get_world_matrix(entt::entity value) const;
+
+		// world matrix between the last two updates, alpha from gui_application::get_interpolation
+		ML_NODISCARD mat4 get_world_matrix(entt::entity value, float32 alpha) const;
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	public:
 		void on_runtime_update(duration dt);
 
+		// anything the simulation moves on its own
+		ML_NODISCARD bool has_behaviors() const noexcept;
+
+		// visit entities inside the frustum
+		template <class Fn
+		> void cull(frustum const & value, Fn && fn)
+		{
+			m_bvh.query(value, [&](uint32 data)
+			{
+				if (auto const e{ static_cast<entt::entity>(data) }; m_reg.valid(e)) { fn(e); }
+			});
+		}
+
+		// closest entity under the ray
+		ML_NODISCARD entt::entity pick(ray const & value, float32 * distance = nullptr);
+
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 	protected:
@@ -81,13 +131,38 @@ namespace ml
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+	private:
+		void connect_signals();
+
+		void disconnect_signals();
+
+		void on_transform_construct(entt::registry & reg, entt::entity e);
+
+		void on_transform_destroy(entt::registry & reg, entt::entity e);
+
+		void on_hierarchy_destroy(entt::registry & reg, entt::entity e);
+
+		void on_bounds_destroy(entt::registry & reg, entt::entity e);
+
+		// parent entity transforms along the nodes
+		void update_hierarchy();
+
+		// hold an animation on the application while behaviors run
+		void set_animating(bool value) noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 	private:
 		friend node;
 		friend entity;
 
-		string			m_name	; // name
-		entt::registry	m_reg	; // registry
-		ref<node>		m_root	; // root node
+		interned_string		m_name			; // name
+		entt::registry		m_reg			; // registry
+		ref<node>			m_root			; // root node
+		transform_system	m_transforms	; // transform hierarchy
+		dynamic_bvh			m_bvh			; // entity bounds
+		bool				m_hierarchy		; // nodes or entity transforms changed
+		bool				m_animating		; // keeping the application awake
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	};
@@ -95,9 +170,9 @@ namespace ml
 
 namespace ml
 {
-	inline void from_json(json const & j, scene_tree & v) noexcept {}
+	ML_CORE_API void from_json(json const & j, scene_tree & v);
 
-	inline void to_json(json & j, scene_tree const & v) noexcept {}
+	ML_CORE_API void to_json(json & j, scene_tree const & v);
 }
 
 #endif // !_ML_SCENE_TREE_HPP_
\ No newline at end of file
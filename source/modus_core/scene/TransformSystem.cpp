@@ -0,0 +1,281 @@
+#include <modus_core/scene/TransformSystem.hpp>
+#include <modus_core/scene/Components.hpp>
+#include <modus_core/detail/MatrixMath.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	transform_system::id_type transform_system::create(id_type parent, vec3 const & position, vec4 const & rotation, vec3 const & scale)
+	{
+		ML_assert(parent == npos || contains(parent));
+
+		// get id
+		id_type id{};
+		if (!m_free.empty())
+		{
+			id = m_free.back();
+			m_free.pop_back();
+		}
+		else
+		{
+			id = (id_type)m_sparse.size();
+			m_sparse.push_back(npos);
+		}
+
+		// appending only keeps the levels valid when it lands on the deepest one
+		uint32 const depth{ (parent == npos) ? 0 : m_data.get<ID_depth>()[index_of(parent)] + 1 };
+		if (m_sorted && (depth + 1 != m_levels.size()))
+		{
+			if (depth == m_levels.size()) { m_levels.push_back(m_data.size()); }
+			else { m_sorted = false; }
+		}
+
+		m_sparse[id] = (id_type)m_data.size();
+		m_data.push_back(
+			id,
+			parent,
+			depth,
+			(int32)(transform_flags_dirty | transform_flags_fresh),
+			position,
+			rotation,
+			scale,
+			mat4::identity(),
+			mat4::identity(),
+			mat4::identity());
+		return id;
+	}
+
+	void transform_system::destroy(id_type id, bool recursive)
+	{
+		if (!contains(id)) { return; }
+
+		// children are picked up by the next sort
+		m_data.get<ID_flags>()[index_of(id)] |= recursive
+			? (int32)transform_flags_dead
+			: (int32)(transform_flags_dead | transform_flags_detach);
+
+		m_sorted = false;
+	}
+
+	bool transform_system::set_parent(id_type id, id_type parent)
+	{
+		if (!contains(id) || (parent != npos && !contains(parent))) { return false; }
+
+		// can't move a transform under itself
+		for (id_type p{ parent }; p != npos; p = get_parent(p))
+		{
+			if (p == id) { return false; }
+		}
+
+		size_t const i{ index_of(id) };
+		m_data.get<ID_parent>()[i] = parent;
+		m_data.get<ID_flags>()[i] |= transform_flags_moved;
+
+		m_sorted = false;
+		return true;
+	}
+
+	size_t transform_system::update()
+	{
+		if (!m_sorted) { sort(); }
+
+		size_t const n{ m_data.size() };
+		auto const & parents{ m_data.get<ID_parent>() };
+		auto & flags{ m_data.get<ID_flags>() };
+		auto const & positions{ m_data.get<ID_position>() };
+		auto const & rotations{ m_data.get<ID_rotation>() };
+		auto const & scales{ m_data.get<ID_scale>() };
+		auto & locals{ m_data.get<ID_local>() };
+		auto & worlds{ m_data.get<ID_world>() };
+		auto & previous{ m_data.get<ID_previous>() };
+
+		// keep the last result so rendering can blend between updates
+		std::copy(worlds.begin(), worlds.end(), previous.begin());
+
+		// local matrices
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (flags[i] & transform_flags_dirty)
+			{
+				locals[i] = transform_component{ positions[i], rotations[i], scales[i] }.get_transform();
+			}
+		}
+
+		// world matrices, one depth at a time so a batch only reads finished parents
+		size_t count{};
+		for (size_t d = 0; d < m_levels.size(); ++d)
+		{
+			size_t const first{ m_levels[d] };
+			size_t const last{ (d + 1 < m_levels.size()) ? m_levels[d + 1] : n };
+
+			m_batch_parent.clear();
+			m_batch_local.clear();
+			m_batch_world.clear();
+			for (size_t i = first; i < last; ++i)
+			{
+				size_t const p{ (parents[i] == npos) ? npos : m_sparse[parents[i]] };
+
+				if ((flags[i] & (transform_flags_dirty | transform_flags_moved)) ||
+					(p != npos && (flags[p] & transform_flags_changed)))
+				{
+					flags[i] |= transform_flags_changed;
+
+					if (p == npos) { worlds[i] = locals[i]; }
+					else
+					{
+						m_batch_parent.push_back(&worlds[p]);
+						m_batch_local.push_back(&locals[i]);
+						m_batch_world.push_back(&worlds[i]);
+					}
+
+					++count;
+				}
+			}
+
+			util::multiply(m_batch_parent.data(), m_batch_local.data(), m_batch_world.size(), m_batch_world.data());
+		}
+
+		// new transforms have nothing to blend from
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (flags[i] & transform_flags_fresh) { previous[i] = worlds[i]; }
+		}
+
+		// clear flags
+		for (int32 & f : flags)
+		{
+			f &= ~(transform_flags_dirty | transform_flags_moved | transform_flags_changed | transform_flags_fresh);
+		}
+		return count;
+	}
+
+	mat4 transform_system::get_world_matrix(id_type id, float32 alpha) const noexcept
+	{
+		// a linear blend, steps are short enough that the basis stays close to orthogonal
+		size_t const i{ index_of(id) };
+		mat4 const & a{ m_data.get<ID_previous>()[i] };
+		mat4 const & b{ m_data.get<ID_world>()[i] };
+		mat4 result{};
+		for (size_t k = 0; k < 16; ++k)
+		{
+			result[k] = a[k] + (b[k] - a[k]) * alpha;
+		}
+		return result;
+	}
+
+	void transform_system::sort()
+	{
+		size_t const n{ m_data.size() };
+		auto const & ids{ m_data.get<ID_id>() };
+		auto & parents{ m_data.get<ID_parent>() };
+		auto & depths{ m_data.get<ID_depth>() };
+		auto & flags{ m_data.get<ID_flags>() };
+
+		// children of a transform removed on its own keep their local matrix as their world one
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (parents[i] != npos && (flags[m_sparse[parents[i]]] & transform_flags_detach))
+			{
+				parents[i] = npos;
+				flags[i] |= transform_flags_moved;
+			}
+		}
+
+		// recompute depths, dead parents take their children with them
+		list<byte> known(n, 0);
+		list<size_t> path{};
+		for (size_t i = 0; i < n; ++i)
+		{
+			for (size_t j{ i }; !known[j]; j = m_sparse[parents[j]])
+			{
+				path.push_back(j);
+
+				if (parents[j] == npos) { break; }
+			}
+			while (!path.empty())
+			{
+				size_t const k{ path.back() };
+				path.pop_back();
+				if (parents[k] == npos)
+				{
+					depths[k] = 0;
+				}
+				else
+				{
+					size_t const p{ m_sparse[parents[k]] };
+					depths[k] = depths[p] + 1;
+					flags[k] |= (flags[p] & transform_flags_dead);
+				}
+				known[k] = 1;
+			}
+		}
+
+		// live transforms ordered by depth, dead ones after them
+		list<size_t> order{};
+		order.reserve(n);
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (flags[i] & transform_flags_dead)
+			{
+				m_sparse[ids[i]] = npos;
+				m_free.push_back(ids[i]);
+			}
+			else
+			{
+				order.push_back(i);
+			}
+		}
+		size_t const live{ order.size() };
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) noexcept
+		{
+			return depths[a] < depths[b];
+		});
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (flags[i] & transform_flags_dead) { order.push_back(i); }
+		}
+
+		// permute each column in place along the cycles of the order
+		auto permute = [&](auto & col) noexcept
+		{
+			std::fill(known.begin(), known.end(), byte{});
+			for (size_t k = 0; k < n; ++k)
+			{
+				if (known[k] || order[k] == k) { continue; }
+				auto temp{ std::move(col[k]) };
+				size_t j{ k };
+				for (size_t src{ order[j] }; src != k; j = src, src = order[j])
+				{
+					col[j] = std::move(col[src]);
+					known[j] = 1;
+				}
+				col[j] = std::move(temp);
+				known[j] = 1;
+			}
+		};
+		permute(m_data.get<ID_id>());
+		permute(m_data.get<ID_parent>());
+		permute(m_data.get<ID_depth>());
+		permute(m_data.get<ID_flags>());
+		permute(m_data.get<ID_position>());
+		permute(m_data.get<ID_rotation>());
+		permute(m_data.get<ID_scale>());
+		permute(m_data.get<ID_local>());
+		permute(m_data.get<ID_world>());
+		permute(m_data.get<ID_previous>());
+		m_data.resize(live);
+
+		// rebuild lookup and levels
+		m_levels.clear();
+		for (size_t k = 0; k < m_data.size(); ++k)
+		{
+			m_sparse[m_data.get<ID_id>()[k]] = (id_type)k;
+
+			while (m_levels.size() <= m_data.get<ID_depth>()[k]) { m_levels.push_back(k); }
+		}
+		m_sorted = true;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
\ No newline at end of file
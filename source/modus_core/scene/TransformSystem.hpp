@@ -0,0 +1,200 @@
+#ifndef _ML_TRANSFORM_SYSTEM_HPP_
+#define _ML_TRANSFORM_SYSTEM_HPP_
+
+#include <modus_core/detail/BatchVector.hpp>
+#include <modus_core/detail/Matrix.hpp>
+#include <modus_core/system/Memory.hpp>
+
+namespace ml
+{
+	// transform flags
+	enum transform_flags_ : int32
+	{
+		transform_flags_none	= 0,		// clean
+		transform_flags_dirty	= 1 << 0,	// local changed
+		transform_flags_moved	= 1 << 1,	// parent changed
+		transform_flags_changed	= 1 << 2,	// world recomputed this update
+		transform_flags_dead	= 1 << 3,	// pending removal
+		transform_flags_detach	= 1 << 4,	// pending removal, children move to the root
+		transform_flags_fresh	= 1 << 5,	// no previous world matrix yet
+	};
+
+	// transform system
+	struct ML_CORE_API transform_system final : non_copyable, trackable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		using allocator_type = typename pmr::polymorphic_allocator<byte>;
+
+		using id_type = typename uint32;
+
+		static constexpr id_type npos{ static_cast<id_type>(-1) };
+
+		enum : size_t { ID_id, ID_parent, ID_depth, ID_flags, ID_position, ID_rotation, ID_scale, ID_local, ID_world, ID_previous };
+
+		using storage_type = typename batch_vector
+		<
+			id_type,	// id
+			id_type,	// parent id
+			uint32,		// depth
+			int32,		// flags
+			vec3,		// position
+			vec4,		// rotation
+			vec3,		// scale
+			mat4,		// local matrix
+			mat4,		// world matrix
+			mat4		// world matrix of the previous update
+		>;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		transform_system(allocator_type alloc = {}) noexcept
+			: m_data	{ alloc }
+			, m_sparse	{ alloc }
+			, m_free	{ alloc }
+			, m_levels	{ alloc }
+			, m_batch_parent{ alloc }
+			, m_batch_local	{ alloc }
+			, m_batch_world	{ alloc }
+			, m_sorted	{ true }
+		{
+		}
+
+		void swap(transform_system & other) noexcept
+		{
+			if (this != std::addressof(other))
+			{
+				m_data.swap(other.m_data);
+				std::swap(m_sparse, other.m_sparse);
+				std::swap(m_free, other.m_free);
+				std::swap(m_levels, other.m_levels);
+				std::swap(m_batch_parent, other.m_batch_parent);
+				std::swap(m_batch_local, other.m_batch_local);
+				std::swap(m_batch_world, other.m_batch_world);
+				std::swap(m_sorted, other.m_sorted);
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// add a transform, parent must already exist
+		id_type create(id_type parent = npos, vec3 const & position = {}, vec4 const & rotation = {}, vec3 const & scale = vec3::one());
+
+		// remove a transform and everything under it, or only it with its children kept as roots
+		void destroy(id_type id, bool recursive = true);
+
+		// move a transform under another
+		bool set_parent(id_type id, id_type parent);
+
+		// recompute dirty subtrees, returns the number of world matrices written
+		size_t update();
+
+		void clear() noexcept
+		{
+			m_data.clear();
+			m_sparse.clear();
+			m_free.clear();
+			m_levels.clear();
+			m_sorted = true;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD bool contains(id_type id) const noexcept
+		{
+			return (id < m_sparse.size()) && (m_sparse[id] != npos);
+		}
+
+		ML_NODISCARD size_t size() const noexcept
+		{
+			return m_data.size();
+		}
+
+		ML_NODISCARD id_type get_parent(id_type id) const noexcept
+		{
+			return m_data.get<ID_parent>()[index_of(id)];
+		}
+
+		ML_NODISCARD vec3 const & get_position(id_type id) const noexcept
+		{
+			return m_data.get<ID_position>()[index_of(id)];
+		}
+
+		ML_NODISCARD vec4 const & get_rotation(id_type id) const noexcept
+		{
+			return m_data.get<ID_rotation>()[index_of(id)];
+		}
+
+		ML_NODISCARD vec3 const & get_scale(id_type id) const noexcept
+		{
+			return m_data.get<ID_scale>()[index_of(id)];
+		}
+
+		ML_NODISCARD mat4 const & get_local_matrix(id_type id) const noexcept
+		{
+			return m_data.get<ID_local>()[index_of(id)];
+		}
+
+		ML_NODISCARD mat4 const & get_world_matrix(id_type id) const noexcept
+		{
+			return m_data.get<ID_world>()[index_of(id)];
+		}
+
+		ML_NODISCARD mat4 const & get_previous_matrix(id_type id) const noexcept
+		{
+			return m_data.get<ID_previous>()[index_of(id)];
+		}
+
+		// world matrix blended from the previous update toward the last one
+		ML_NODISCARD mat4 get_world_matrix(id_type id, float32 alpha) const noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		void set_position(id_type id, vec3 const & value) noexcept
+		{
+			size_t const i{ index_of(id) };
+			m_data.get<ID_position>()[i] = value;
+			m_data.get<ID_flags>()[i] |= transform_flags_dirty;
+		}
+
+		void set_rotation(id_type id, vec4 const & value) noexcept
+		{
+			size_t const i{ index_of(id) };
+			m_data.get<ID_rotation>()[i] = value;
+			m_data.get<ID_flags>()[i] |= transform_flags_dirty;
+		}
+
+		void set_scale(id_type id, vec3 const & value) noexcept
+		{
+			size_t const i{ index_of(id) };
+			m_data.get<ID_scale>()[i] = value;
+			m_data.get<ID_flags>()[i] |= transform_flags_dirty;
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		ML_NODISCARD size_t index_of(id_type id) const noexcept
+		{
+			ML_assert(contains(id));
+			return m_sparse[id];
+		}
+
+		// reorder by depth, drop dead transforms
+		void sort();
+
+		storage_type	m_data		; // transforms, parents before children
+		list<id_type>	m_sparse	; // id -> index
+		list<id_type>	m_free		; // recycled ids
+		list<size_t>	m_levels	; // first index of each depth
+		list<mat4 const *>	m_batch_parent	; // parent worlds of the level being recomputed
+		list<mat4 const *>	m_batch_local	; // locals of the level being recomputed
+		list<mat4 *>		m_batch_world	; // worlds of the level being recomputed
+		bool			m_sorted	; // levels are valid
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+#endif // !_ML_TRANSFORM_SYSTEM_HPP_
\ No newline at end of file
@@ -1,7 +1,9 @@
 #ifndef _ML_EVENT_SYSTEM_HPP_
 #define _ML_EVENT_SYSTEM_HPP_
 
+#include <modus_core/detail/DenseHashMap.hpp>
 #include <modus_core/detail/FlatMap.hpp>
+#include <modus_core/detail/SmallVector.hpp>
 #include <modus_core/system/Memory.hpp>
 #include <modus_core/detail/Method.hpp>
 
@@ -213,7 +215,7 @@ namespace ml
 		using base_type					= typename event_delegate<void>;
 		using self_type					= typename event_delegate<event_type>;
 		using method_type				= typename method<void(event_type const &)>;
-		using storage_type				= typename list<method_type>;
+		using storage_type				= typename small_vector<method_type, 2>;
 		using iterator					= typename storage_type::iterator;
 		using const_iterator			= typename storage_type::const_iterator;
 		using reverse_iterator			= typename storage_type::reverse_iterator;
@@ -254,7 +256,7 @@ namespace ml
 		ML_NODISCARD auto operator[](size_t i) const noexcept -> method_type const & { return m_data[i]; }
 
 		template <class ... Args
-		> auto insert(size_t i, Args && ... args) noexcept -> method_type & { return m_data.emplace(begin() + i, ML_forward(args)...); }
+		> auto insert(size_t i, Args && ... args) noexcept -> method_type & { return *m_data.emplace(begin() + i, ML_forward(args)...); }
 
 		template <class ... Args
 		> auto add(Args && ... args) noexcept -> method_type & { return m_data.emplace_back(ML_forward(args)...); }
@@ -324,8 +326,8 @@ namespace ml
 
 		using allocator_type	= typename pmr::polymorphic_allocator<byte>;
 		using listener_set		= typename flat_set<event_listener *, comparator>;
-		using listener_map		= typename flat_map<hash_t, listener_set>;
-		using delegate_map		= typename flat_map<hash_t, event_delegate<void> *>;
+		using listener_map		= typename dense_hash_map<hash_t, listener_set>;
+		using delegate_map		= typename dense_hash_map<hash_t, event_delegate<void> *>;
 		using dummy_ref			= typename ref<dummy_listener>;
 		using dummy_list		= typename list<dummy_ref>;
 
@@ -0,0 +1,263 @@
+#include <modus_core/system/FileWatcher.hpp>
+#include <modus_core/system/Logger.hpp>
+
+#if defined(ML_os_linux)
+#	include <cstring>
+#	include <poll.h>
+#	include <sys/eventfd.h>
+#	include <sys/inotify.h>
+#	include <unistd.h>
+#endif
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#if !defined(ML_os_linux)
+	// without change notifications write times are checked this often
+	static constexpr std::chrono::milliseconds file_watcher_interval{ 100 };
+#endif
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	file_watcher::file_watcher(allocator_type alloc)
+		: m_alloc	{ alloc }
+		, m_thread	{}
+		, m_clock	{ true }
+		, m_debounce{}
+		, m_wake	{}
+		, m_stop	{}
+		, m_notify	{ -1 }
+		, m_signal	{ -1 }
+		, m_mutex	{}
+		, m_files	{ get_shared_resource() } // the watch thread grows these too
+		, m_dirs	{ get_shared_resource() }
+		, m_added	{ get_shared_resource() }
+		, m_pending	{ get_shared_resource() }
+		, m_last	{ get_shared_resource() }
+		, m_ready	{ get_shared_resource() }
+	{
+	}
+
+	file_watcher::~file_watcher() noexcept
+	{
+		stop();
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	bool file_watcher::start(duration debounce)
+	{
+		if (is_running()) { return false; }
+
+#if defined(ML_os_linux)
+		m_notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		m_signal = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (m_notify < 0 || m_signal < 0)
+		{
+			ML_log_error("file watcher: {0}", std::strerror(errno));
+			if (0 <= m_notify) { close(std::exchange(m_notify, -1)); }
+			if (0 <= m_signal) { close(std::exchange(m_signal, -1)); }
+			return false;
+		}
+#endif
+
+		m_debounce = debounce;
+		m_stop.store(false, std::memory_order_release);
+		m_thread = std::thread{ &file_watcher::worker_main, this };
+		return true;
+	}
+
+	void file_watcher::stop() noexcept
+	{
+		if (!is_running()) { return; }
+		m_stop.store(true, std::memory_order_release);
+#if defined(ML_os_linux)
+		uint64 const one{ 1 };
+		(void)write(m_signal, &one, sizeof(one));
+#endif
+		m_thread.join();
+
+#if defined(ML_os_linux)
+		// closing the descriptor drops its watches
+		close(std::exchange(m_notify, -1));
+		close(std::exchange(m_signal, -1));
+		m_dirs.clear();
+		for (auto const & [id, file] : m_files)
+		{
+			if (std::find(m_added.begin(), m_added.end(), file.parent_path()) == m_added.end()) { m_added.push_back(file.parent_path()); }
+		}
+#endif
+	}
+
+	bool file_watcher::watch(fs::path const & path)
+	{
+		fs::path const file{ normalize(path) };
+		if (file.empty()) { return false; }
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			if (!m_files.insert({ hashof(file.string()), file }).second) { return true; }
+
+			// one watch per directory, names are filtered against the watched files
+			fs::path const dir{ file.parent_path() };
+			bool const known{ std::any_of(m_dirs.begin(), m_dirs.end(), [&](auto const & e) { return e.second == dir; })
+				|| std::find(m_added.begin(), m_added.end(), dir) != m_added.end() };
+			if (known) { return true; }
+			m_added.push_back(dir);
+		}
+#if defined(ML_os_linux)
+		if (is_running())
+		{
+			uint64 const one{ 1 };
+			(void)write(m_signal, &one, sizeof(one));
+		}
+#endif
+		return true;
+	}
+
+	size_t file_watcher::poll(list<change> & out)
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		size_t const count{ m_ready.size() };
+		std::move(m_ready.begin(), m_ready.end(), std::back_inserter(out));
+		m_ready.clear();
+		return count;
+	}
+
+	fs::path file_watcher::normalize(fs::path const & path)
+	{
+		std::error_code ec{};
+		fs::path const temp{ fs::absolute(path, ec) };
+		return (ec ? path : temp).lexically_normal();
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void file_watcher::worker_main()
+	{
+#if defined(ML_os_linux)
+		alignas(inotify_event) char buffer[4096];
+		pollfd fds[2]{ { m_notify, POLLIN, 0 }, { m_signal, POLLIN, 0 } };
+		while (!m_stop.load(std::memory_order_acquire))
+		{
+			// wait for a write, or until the oldest pending change goes quiet
+			int32 timeout{ -1 };
+			{
+				std::lock_guard<std::mutex> lock{ m_mutex };
+				for (fs::path const & dir : m_added)
+				{
+					// editors save by rename as often as by writing in place
+					if (int32 const wd{ inotify_add_watch(m_notify, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) }; 0 <= wd)
+					{
+						m_dirs[wd] = dir;
+					}
+					else
+					{
+						ML_log_error("file watcher: {0}: {1}", dir.string(), std::strerror(errno));
+					}
+				}
+				m_added.clear();
+				if (!m_last.empty())
+				{
+					duration const due{ *std::min_element(m_last.begin(), m_last.end()) + m_debounce - m_clock.elapsed() };
+					timeout = ML_max((int32)std::ceil(due.count() * 1000.f), 0);
+				}
+			}
+			if (::poll(fds, 2, timeout) < 0 && errno != EINTR) { break; }
+
+			if (fds[1].revents & POLLIN)
+			{
+				uint64 value{};
+				(void)read(m_signal, &value, sizeof(value));
+			}
+
+			if (fds[0].revents & POLLIN)
+			{
+				ssize_t size{};
+				while (0 < (size = read(m_notify, buffer, sizeof(buffer))))
+				{
+					for (char const * ptr{ buffer }; ptr < buffer + size;)
+					{
+						inotify_event const * const ev{ (inotify_event const *)ptr };
+						ptr += sizeof(inotify_event) + ev->len;
+						if (!ev->len) { continue; }
+
+						fs::path file{};
+						{
+							std::lock_guard<std::mutex> lock{ m_mutex };
+							if (auto const it{ m_dirs.find(ev->wd) }; it != m_dirs.end()) { file = it->second / ev->name; }
+							if (file.empty() || !m_files.count(hashof(file.string()))) { continue; }
+						}
+						touch(file);
+					}
+				}
+			}
+
+			settle();
+		}
+#else
+		hash_map<hash_t, fs::file_time_type> stamps{ get_shared_resource() };
+		while (!m_stop.load(std::memory_order_acquire))
+		{
+			list<fs::path> files{ get_shared_resource() };
+			{
+				std::lock_guard<std::mutex> lock{ m_mutex };
+				m_added.clear();
+				for (auto const & [id, file] : m_files) { files.push_back(file); }
+			}
+			for (fs::path const & file : files)
+			{
+				std::error_code ec{};
+				fs::file_time_type const stamp{ fs::last_write_time(file, ec) };
+				if (ec) { continue; }
+
+				// the first look only records the stamp
+				auto const [it, added] { stamps.insert({ hashof(file.string()), stamp }) };
+				if (!added && it->second != stamp)
+				{
+					it->second = stamp;
+					touch(file);
+				}
+			}
+			settle();
+			std::this_thread::sleep_for(file_watcher_interval);
+		}
+#endif
+	}
+
+	void file_watcher::touch(fs::path const & path)
+	{
+		duration const now{ m_clock.elapsed() };
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		if (auto const it{ std::find_if(m_pending.begin(), m_pending.end(), [&](change const & e) { return e.path == path; }) }
+		; it != m_pending.end())
+		{
+			m_last[(size_t)std::distance(m_pending.begin(), it)] = now;
+		}
+		else
+		{
+			m_pending.push_back({ path, now });
+			m_last.push_back(now);
+		}
+	}
+
+	void file_watcher::settle()
+	{
+		bool ready{};
+		{
+			duration const now{ m_clock.elapsed() };
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			for (size_t i = m_pending.size(); i-- > 0;)
+			{
+				if (now - m_last[i] < m_debounce) { continue; }
+				m_ready.push_back(std::move(m_pending[i]));
+				m_pending.erase(m_pending.begin() + (ptrdiff_t)i);
+				m_last.erase(m_last.begin() + (ptrdiff_t)i);
+				ready = true;
+			}
+		}
+		if (ready && m_wake) { std::invoke(m_wake); }
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef _ML_FILE_WATCHER_HPP_
+#define _ML_FILE_WATCHER_HPP_
+
+#include <modus_core/detail/Method.hpp>
+#include <modus_core/detail/Timer.hpp>
+
+namespace ml
+{
+	// reports files that were written and then left alone for the debounce time,
+	// inotify on linux, write times are polled elsewhere
+	struct ML_CORE_API file_watcher final : non_copyable, trackable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		using allocator_type = typename pmr::polymorphic_allocator<byte>;
+
+		using task = typename method<void()>;
+
+		struct ML_NODISCARD change final
+		{
+			fs::path	path;	// absolute, normalized
+			duration	time;	// first write since the last report, on get_time
+		};
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		explicit file_watcher(allocator_type alloc = {});
+
+		~file_watcher() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// starts the watch thread, saves closer together than debounce are reported once
+		ML_NODISCARD bool start(duration debounce);
+
+		void stop() noexcept;
+
+		// any thread, the file doesn't have to exist yet
+		bool watch(fs::path const & path);
+
+		// moves out everything that settled since the last call
+		size_t poll(list<change> & out);
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD bool is_running() const noexcept { return m_thread.joinable(); }
+
+		// clock the change times are measured on
+		ML_NODISCARD auto get_time() const noexcept -> duration { return m_clock.elapsed(); }
+
+		// called from the watch thread whenever changes are ready, set before start
+		void set_wake(task fn) noexcept { m_wake = std::move(fn); }
+
+		// canonical form watched and reported paths are compared in
+		ML_NODISCARD static fs::path normalize(fs::path const & path);
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		void worker_main();
+
+		void touch(fs::path const & path);
+
+		void settle();
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		allocator_type				m_alloc		; // allocator
+		std::thread					m_thread	; // watch thread
+		timer						m_clock		; // change times
+		duration					m_debounce	; // quiet time before a change is reported
+		task						m_wake		; // changes are ready
+		std::atomic<bool>			m_stop		; // shutting down
+		int32						m_notify	; // inotify descriptor
+		int32						m_signal	; // wakes the watch thread on stop and watch
+
+		std::mutex					m_mutex		; // guards everything below
+		hash_map<hash_t, fs::path>	m_files		; // watched files
+		hash_map<int32, fs::path>	m_dirs		; // watched directories by descriptor
+		list<fs::path>				m_added		; // directories the watch thread hasn't seen yet
+		list<change>				m_pending	; // written, not yet quiet
+		list<duration>				m_last		; // last write of each pending change
+		list<change>				m_ready		; // quiet, waiting for poll
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+#endif // !_ML_FILE_WATCHER_HPP_
\ No newline at end of file
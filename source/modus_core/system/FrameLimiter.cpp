@@ -0,0 +1,84 @@
+#include <modus_core/system/FrameLimiter.hpp>
+
+#if defined(ML_os_windows)
+#	include <Windows.h>
+#	ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#	define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#	endif
+#else
+#	include <ctime>
+#endif
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// the scheduler may wake us a little late, leave this much to yield away
+	static constexpr float32 frame_limiter_slack{ 0.0005f };
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	frame_limiter::frame_limiter() noexcept
+		: m_timer	{}
+		, m_slept	{}
+	{
+#if defined(ML_os_windows)
+		// high resolution timers need windows 10 1803, older versions get a regular one
+		m_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+		if (!m_timer) { m_timer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS); }
+#endif
+	}
+
+	frame_limiter::~frame_limiter() noexcept
+	{
+#if defined(ML_os_windows)
+		if (m_timer) { CloseHandle((HANDLE)m_timer); }
+#endif
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void frame_limiter::wait(timer const & frame, duration target) noexcept
+	{
+		duration const before{ frame.elapsed() };
+		float32 const remaining{ target.count() - before.count() - frame_limiter_slack };
+		if (remaining > 0.f)
+		{
+#if defined(ML_os_windows)
+			if (m_timer)
+			{
+				LARGE_INTEGER due{};
+				due.QuadPart = -(LONGLONG)(remaining * 1e7f); // relative, in 100ns units
+				if (SetWaitableTimerEx((HANDLE)m_timer, &due, 0, nullptr, nullptr, nullptr, 0))
+				{
+					WaitForSingleObject((HANDLE)m_timer, INFINITE);
+				}
+			}
+			else
+			{
+				std::this_thread::sleep_for(chrono::duration<float32>{ remaining });
+			}
+#else
+			std::this_thread::sleep_for(chrono::duration<float32>{ remaining });
+#endif
+		}
+
+		while (frame.elapsed() < target) { std::this_thread::yield(); }
+
+		m_slept = frame.elapsed() - before;
+	}
+
+	duration frame_limiter::get_process_time() noexcept
+	{
+#if defined(ML_os_windows)
+		FILETIME created, exited, kernel, user;
+		if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) { return {}; }
+		auto const ticks{ [](FILETIME const & t) { return ((uint64)t.dwHighDateTime << 32) | t.dwLowDateTime; } };
+		return duration{ (float32)((float64)(ticks(kernel) + ticks(user)) * 1e-7) }; // 100ns units
+#else
+		return duration{ (float32)((float64)std::clock() / CLOCKS_PER_SEC) };
+#endif
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
\ No newline at end of file
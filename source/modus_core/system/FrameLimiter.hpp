@@ -0,0 +1,39 @@
+#ifndef _ML_FRAME_LIMITER_HPP_
+#define _ML_FRAME_LIMITER_HPP_
+
+#include <modus_core/detail/Timer.hpp>
+
+namespace ml
+{
+	// sleeps out the rest of a frame on a high resolution timer instead of spinning
+	struct ML_CORE_API frame_limiter final : non_copyable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		frame_limiter() noexcept;
+
+		~frame_limiter() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// returns once the frame timer reaches the target
+		void wait(timer const & frame, duration target) noexcept;
+
+		// time spent asleep in the last wait
+		ML_NODISCARD auto get_slept() const noexcept -> duration { return m_slept; }
+
+		// cpu time used by every thread of the process
+		ML_NODISCARD static duration get_process_time() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		void *		m_timer	; // waitable timer on windows
+		duration	m_slept	; // last sleep
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+#endif // !_ML_FRAME_LIMITER_HPP_
\ No newline at end of file
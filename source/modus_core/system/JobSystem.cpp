@@ -0,0 +1,345 @@
+#include <modus_core/system/JobSystem.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// lane of the calling thread if it is one of our workers
+	static thread_local struct { job_system const * system; size_t lane; } t_worker{};
+
+	// victim selection
+	static thread_local uint32 t_seed{ 0x9e3779b9u };
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// owner only
+	static bool deque_push(std::atomic<int64> & top, std::atomic<int64> & bottom, std::atomic<job *> * slots, job * value) noexcept
+	{
+		int64 const b{ bottom.load(std::memory_order_relaxed) };
+		int64 const t{ top.load(std::memory_order_acquire) };
+		if (b - t >= (int64)job_system::lane_capacity) { return false; }
+		slots[b & (job_system::lane_capacity - 1)].store(value, std::memory_order_relaxed);
+		bottom.store(b + 1, std::memory_order_release);
+		return true;
+	}
+
+	// owner only
+	static job * deque_pop(std::atomic<int64> & top, std::atomic<int64> & bottom, std::atomic<job *> * slots) noexcept
+	{
+		int64 const b{ bottom.load(std::memory_order_relaxed) - 1 };
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64 t{ top.load(std::memory_order_relaxed) };
+		if (t > b)
+		{
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		job * value{ slots[b & (job_system::lane_capacity - 1)].load(std::memory_order_relaxed) };
+		if (t == b)
+		{
+			// last one, race the thieves for it
+			if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) { value = nullptr; }
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+		return value;
+	}
+
+	// any thread
+	static job * deque_steal(std::atomic<int64> & top, std::atomic<int64> & bottom, std::atomic<job *> * slots) noexcept
+	{
+		int64 t{ top.load(std::memory_order_acquire) };
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64 const b{ bottom.load(std::memory_order_acquire) };
+		if (t >= b) { return nullptr; }
+		job * const value{ slots[t & (job_system::lane_capacity - 1)].load(std::memory_order_relaxed) };
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) { return nullptr; }
+		return value;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	job_system::job_system(size_t thread_count, allocator_type alloc)
+		: m_alloc		{ alloc }
+		, m_owner		{ std::this_thread::get_id() }
+		, m_lane_count	{}
+		, m_lanes		{}
+		, m_records		{}
+		, m_threads		{ alloc }
+		, m_pending		{}
+		, m_running		{}
+		, m_sleeping	{}
+		, m_stop		{}
+		, m_mutex		{}
+		, m_wake		{}
+	{
+		if (!thread_count) { thread_count = ML_max(std::thread::hardware_concurrency(), 1u); }
+		m_lane_count = thread_count + 1;
+
+		pmr::memory_resource * const mres{ m_alloc.resource() };
+		m_lanes = static_cast<lane *>(mres->allocate(m_lane_count * sizeof(lane), alignof(lane)));
+		m_records = static_cast<job *>(mres->allocate(m_lane_count * lane_capacity * sizeof(job), alignof(job)));
+		for (size_t i = 0; i < m_lane_count; ++i)
+		{
+			lane & l{ *::new (m_lanes + i) lane{} };
+			l.slots = static_cast<std::atomic<job *> *>(mres->allocate(lane_capacity * sizeof(std::atomic<job *>), alignof(std::atomic<job *>)));
+			for (size_t j = 0; j < lane_capacity; ++j) { ::new (l.slots + j) std::atomic<job *>{}; }
+
+			// thread the pool into a free list
+			job * const first{ m_records + i * lane_capacity };
+			for (size_t j = 0; j < lane_capacity; ++j)
+			{
+				first[j].lane = (uint32)i;
+				first[j].next = (j + 1 < lane_capacity) ? &first[j + 1] : nullptr;
+			}
+			l.free = first;
+		}
+
+		m_threads.reserve(thread_count - 1);
+		for (size_t i = 1; i < thread_count; ++i)
+		{
+			m_threads.emplace_back(&job_system::worker_main, this, i);
+		}
+	}
+
+	job_system::~job_system() noexcept
+	{
+		// help drain whatever is still queued
+		while (m_pending.load(std::memory_order_acquire) > 0)
+		{
+			if (job * const j{ find_job(0) }) { execute(0, *j); }
+			else { std::this_thread::yield(); }
+		}
+
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_stop.store(true, std::memory_order_seq_cst);
+		}
+		m_wake.notify_all();
+		for (std::thread & t : m_threads) { t.join(); }
+
+		pmr::memory_resource * const mres{ m_alloc.resource() };
+		for (size_t i = 0; i < m_lane_count; ++i)
+		{
+			mres->deallocate(m_lanes[i].slots, lane_capacity * sizeof(std::atomic<job *>), alignof(std::atomic<job *>));
+			m_lanes[i].~lane();
+		}
+		mres->deallocate(m_records, m_lane_count * lane_capacity * sizeof(job), alignof(job));
+		mres->deallocate(m_lanes, m_lane_count * sizeof(lane), alignof(lane));
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void job_system::wait(job_counter & counter) noexcept
+	{
+		size_t const index{ current_lane() };
+		while (!counter.done())
+		{
+			if (job * const j{ find_job(index) }) { execute(index, *j); }
+			else { std::this_thread::yield(); }
+		}
+	}
+
+	void job_system::wait_idle() noexcept
+	{
+		size_t const index{ current_lane() };
+		while (0 < m_pending.load(std::memory_order_acquire) || 0 < m_running.load(std::memory_order_acquire))
+		{
+			if (job * const j{ find_job(index) }) { execute(index, *j); }
+			else { std::this_thread::yield(); }
+		}
+	}
+
+	job_system::stats job_system::get_stats() const noexcept
+	{
+		stats temp{};
+		for (size_t i = 0; i < m_lane_count; ++i)
+		{
+			temp.executed += m_lanes[i].executed.load(std::memory_order_relaxed);
+			temp.stolen += m_lanes[i].stolen.load(std::memory_order_relaxed);
+			temp.inlined += m_lanes[i].inlined.load(std::memory_order_relaxed);
+		}
+		return temp;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	size_t job_system::current_lane() const noexcept
+	{
+		if (t_worker.system == this) { return t_worker.lane; }
+		else if (std::this_thread::get_id() == m_owner) { return 0; }
+		else { return m_lane_count - 1; } // shared by every other thread
+	}
+
+	job * job_system::acquire_job() noexcept
+	{
+		size_t const index{ current_lane() };
+		lane & l{ m_lanes[index] };
+		std::unique_lock<std::mutex> lock{ l.guard, std::defer_lock };
+		if (index == m_lane_count - 1) { lock.lock(); }
+
+		if (!l.free) { l.free = l.returned.exchange(nullptr, std::memory_order_acquire); }
+		job * const j{ l.free };
+		if (j) { l.free = j->next; }
+		return j;
+	}
+
+	void job_system::release_job(size_t lane_index, job & j) noexcept
+	{
+		if (j.lane == lane_index && lane_index != m_lane_count - 1)
+		{
+			j.next = m_lanes[lane_index].free;
+			m_lanes[lane_index].free = &j;
+		}
+		else
+		{
+			std::atomic<job *> & returned{ m_lanes[j.lane].returned };
+			j.next = returned.load(std::memory_order_relaxed);
+			while (!returned.compare_exchange_weak(j.next, &j, std::memory_order_release, std::memory_order_relaxed)) {}
+		}
+	}
+
+	void job_system::submit(job & j) noexcept
+	{
+		size_t const index{ current_lane() };
+		lane & l{ m_lanes[index] };
+
+		m_pending.fetch_add(1, std::memory_order_seq_cst);
+		bool pushed;
+		if (index == m_lane_count - 1)
+		{
+			std::lock_guard<std::mutex> lock{ l.guard };
+			pushed = deque_push(l.top, l.bottom, l.slots, &j);
+		}
+		else
+		{
+			pushed = deque_push(l.top, l.bottom, l.slots, &j);
+		}
+
+		if (!pushed)
+		{
+			// deque full, run it here
+			m_running.fetch_add(1, std::memory_order_relaxed);
+			m_pending.fetch_sub(1, std::memory_order_release);
+			l.inlined.fetch_add(1, std::memory_order_relaxed);
+			execute(index, j);
+		}
+		else if (m_sleeping.load(std::memory_order_seq_cst) > 0)
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_wake.notify_one();
+		}
+	}
+
+	void job_system::submit_after(job_counter & dependency, job & j) noexcept
+	{
+		j.next = dependency.m_waiting.load(std::memory_order_relaxed);
+		while (!dependency.m_waiting.compare_exchange_weak(j.next, &j, std::memory_order_release, std::memory_order_relaxed)) {}
+
+		// it may have finished before we were linked in, whoever takes the list queues it
+		if (!dependency.m_value.load(std::memory_order_seq_cst))
+		{
+			for (job * w{ dependency.m_waiting.exchange(nullptr, std::memory_order_acquire) }; w;)
+			{
+				job * const next{ w->next };
+				submit(*w);
+				w = next;
+			}
+		}
+	}
+
+	void job_system::finish(job_counter & counter) noexcept
+	{
+		counter.m_finishing.fetch_add(1, std::memory_order_seq_cst);
+		if (counter.m_value.fetch_sub(1, std::memory_order_seq_cst) == 1)
+		{
+			for (job * w{ counter.m_waiting.exchange(nullptr, std::memory_order_acquire) }; w;)
+			{
+				job * const next{ w->next };
+				submit(*w);
+				w = next;
+			}
+		}
+		counter.m_finishing.fetch_sub(1, std::memory_order_seq_cst); // last touch, waiters may return now
+	}
+
+	void job_system::execute(size_t lane_index, job & j) noexcept
+	{
+		job_counter * const counter{ j.counter };
+		j.invoke(j);
+		release_job(lane_index, j);
+		m_lanes[lane_index].executed.fetch_add(1, std::memory_order_relaxed);
+		if (counter) { finish(*counter); }
+
+		// after finish, which may have queued jobs waiting on the counter
+		m_running.fetch_sub(1, std::memory_order_release);
+	}
+
+	job * job_system::find_job(size_t lane_index) noexcept
+	{
+		// the shared lane is only ever stolen from
+		if (lane_index != m_lane_count - 1)
+		{
+			lane & l{ m_lanes[lane_index] };
+			if (job * const j{ deque_pop(l.top, l.bottom, l.slots) })
+			{
+				// counted as running before it stops counting as pending, so wait_idle never sees a gap
+				m_running.fetch_add(1, std::memory_order_relaxed);
+				m_pending.fetch_sub(1, std::memory_order_release);
+				return j;
+			}
+		}
+
+		t_seed ^= t_seed << 13; t_seed ^= t_seed >> 17; t_seed ^= t_seed << 5;
+		size_t const start{ t_seed % m_lane_count };
+		for (size_t n = 0; n < m_lane_count; ++n)
+		{
+			size_t const victim{ (start + n) % m_lane_count };
+			if (victim == lane_index && victim != m_lane_count - 1) { continue; }
+
+			lane & l{ m_lanes[victim] };
+			if (job * const j{ deque_steal(l.top, l.bottom, l.slots) })
+			{
+				m_running.fetch_add(1, std::memory_order_relaxed);
+				m_pending.fetch_sub(1, std::memory_order_release);
+				m_lanes[lane_index].stolen.fetch_add(1, std::memory_order_relaxed);
+				return j;
+			}
+		}
+		return nullptr;
+	}
+
+	void job_system::worker_main(size_t lane_index)
+	{
+		t_worker = { this, lane_index };
+		t_seed += (uint32)lane_index * 0x85ebca6bu;
+
+		while (!m_stop.load(std::memory_order_acquire))
+		{
+			// spin briefly before sleeping
+			job * j{};
+			for (size_t spin = 0; !j && spin < 64; ++spin)
+			{
+				if (!(j = find_job(lane_index))) { std::this_thread::yield(); }
+			}
+			if (j) { execute(lane_index, *j); continue; }
+
+			std::unique_lock<std::mutex> lock{ m_mutex };
+			m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+			m_wake.wait(lock, [&]() { return m_stop.load(std::memory_order_seq_cst) || m_pending.load(std::memory_order_seq_cst) > 0; });
+			m_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// global job system
+namespace ml::globals
+{
+	static job_system * g_job_system{};
+
+	ML_impl_global(job_system) get_global() { return g_job_system; }
+
+	ML_impl_global(job_system) set_global(job_system * value) { return g_job_system = value; }
+}
\ No newline at end of file
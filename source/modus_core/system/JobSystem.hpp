@@ -0,0 +1,228 @@
+#ifndef _ML_JOB_SYSTEM_HPP_
+#define _ML_JOB_SYSTEM_HPP_
+
+#include <modus_core/system/Memory.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	struct job_system;
+
+	struct job_counter;
+
+	// one unit of work, records come from a fixed pool and are never allocated per job
+	struct alignas(64) job final
+	{
+		static constexpr size_t payload_size{ 96 }; // largest callable stored inline
+
+		void (*invoke)(job &)	; // runs and destroys the payload
+		job_counter * counter	; // decremented when finished
+		job * next				; // free list or waiting list
+		uint32 lane				; // pool the record belongs to
+
+		alignas(std::max_align_t) byte payload[payload_size]; // the callable
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// number of unfinished jobs, other jobs can be queued to run once it reaches zero
+	struct job_counter final : non_copyable
+	{
+		job_counter() noexcept : m_value{}, m_finishing{}, m_waiting{} {}
+
+		~job_counter() noexcept { ML_assert("job counter destroyed while in use" && done()); }
+
+		// also false while the last job is still releasing its dependents
+		ML_NODISCARD bool done() const noexcept
+		{
+			return !m_value.load(std::memory_order_seq_cst) && !m_finishing.load(std::memory_order_seq_cst);
+		}
+
+		ML_NODISCARD int32 get() const noexcept { return m_value.load(std::memory_order_acquire); }
+
+	private:
+		friend job_system;
+
+		std::atomic<int32>	m_value		; // unfinished jobs
+		std::atomic<int32>	m_finishing	; // jobs still touching the counter
+		std::atomic<job *>	m_waiting	; // jobs queued on this counter
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// work stealing scheduler, one chase-lev deque and job pool per thread,
+	// containers built inside a job allocate from get_shared_resource rather than the default resource
+	struct ML_CORE_API job_system final : non_copyable, trackable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		using allocator_type = typename pmr::polymorphic_allocator<byte>;
+
+		static constexpr size_t lane_capacity{ 1 << 10 }; // job records and deque slots per thread
+
+		struct ML_NODISCARD stats final
+		{
+			size_t executed, stolen, inlined;
+		};
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// thread count includes the creating thread, zero uses every core
+		explicit job_system(size_t thread_count = 0, allocator_type alloc = {});
+
+		// finishes queued jobs before joining
+		~job_system() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// queue fn(), the counter is incremented now and decremented once it has run
+		template <class Fn
+		> void run(Fn && fn, job_counter * counter = nullptr)
+		{
+			if (job * const j{ make_job(ML_forward(fn), counter) }) { submit(*j); }
+			else { run_inline(fn, counter); }
+		}
+
+		// queue fn() once the dependency reaches zero, the dependency must outlive the call
+		template <class Fn
+		> void run_after(job_counter & dependency, Fn && fn, job_counter * counter = nullptr)
+		{
+			if (job * const j{ make_job(ML_forward(fn), counter) }) { submit_after(dependency, *j); }
+			else { wait(dependency); run_inline(fn, counter); }
+		}
+
+		// runs other jobs until the counter reaches zero
+		void wait(job_counter & counter) noexcept;
+
+		// runs jobs until none are queued or running, not from inside a job
+		void wait_idle() noexcept;
+
+		// fn(first, last) over sub ranges of at most grain indices, returns when all are done
+		template <class Fn
+		> void parallel_for(size_t first, size_t last, size_t grain, Fn && fn)
+		{
+			if (first >= last) { return; }
+			job_counter counter{};
+			split_range(first, last, ML_max(grain, (size_t)1), std::addressof(fn), &counter);
+			wait(counter);
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD size_t get_thread_count() const noexcept { return m_threads.size() + 1; }
+
+		// jobs queued but not yet started
+		ML_NODISCARD bool has_pending() const noexcept { return 0 < m_pending.load(std::memory_order_acquire); }
+
+		ML_NODISCARD stats get_stats() const noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		struct alignas(64) lane final
+		{
+			alignas(64) std::atomic<int64>	top			; // stealing end
+			alignas(64) std::atomic<int64>	bottom		; // owning end
+			std::atomic<job *> *			slots		; // ring of lane_capacity
+			job *							free		; // records only the owner takes
+			std::atomic<job *>				returned	; // records freed by other threads
+			std::mutex						guard		; // serializes threads sharing the last lane
+			std::atomic<size_t>				executed	; // jobs run here
+			std::atomic<size_t>				stolen		; // jobs taken from other lanes
+			std::atomic<size_t>				inlined		; // jobs run without a record or slot
+		};
+
+		template <class Fn
+		> job * make_job(Fn && fn, job_counter * counter)
+		{
+			using F = typename std::decay_t<Fn>;
+			static_assert(sizeof(F) <= job::payload_size, "job callable too large");
+			static_assert(alignof(F) <= alignof(std::max_align_t), "job callable over aligned");
+
+			job * const j{ acquire_job() };
+			if (!j) { return nullptr; }
+			::new (j->payload) F{ ML_forward(fn) };
+			j->invoke = [](job & j)
+			{
+				F & f{ *std::launder(reinterpret_cast<F *>(j.payload)) };
+				std::invoke(f);
+				f.~F();
+			};
+			j->counter = counter;
+			if (counter) { counter->m_value.fetch_add(1, std::memory_order_relaxed); }
+			return j;
+		}
+
+		// pool exhausted, nothing was queued
+		template <class Fn
+		> void run_inline(Fn & fn, job_counter * counter)
+		{
+			m_lanes[current_lane()].inlined.fetch_add(1, std::memory_order_relaxed);
+			if (counter) { counter->m_value.fetch_add(1, std::memory_order_relaxed); }
+			std::invoke(fn);
+			if (counter) { finish(*counter); }
+		}
+
+		// halves are queued for thieves, the first piece runs here
+		template <class Fn
+		> void split_range(size_t first, size_t last, size_t grain, Fn * fn, job_counter * counter)
+		{
+			while (last - first > grain)
+			{
+				size_t const mid{ first + (last - first) / 2 };
+				run([this, mid, last, grain, fn, counter]() { split_range(mid, last, grain, fn, counter); }, counter);
+				last = mid;
+			}
+			std::invoke(*fn, first, last);
+		}
+
+		ML_NODISCARD size_t current_lane() const noexcept;
+
+		ML_NODISCARD job * acquire_job() noexcept;
+
+		void release_job(size_t lane_index, job & j) noexcept;
+
+		void submit(job & j) noexcept;
+
+		void submit_after(job_counter & dependency, job & j) noexcept;
+
+		void finish(job_counter & counter) noexcept;
+
+		void execute(size_t lane_index, job & j) noexcept;
+
+		ML_NODISCARD job * find_job(size_t lane_index) noexcept;
+
+		void worker_main(size_t lane_index);
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		allocator_type				m_alloc		; // allocator
+		std::thread::id				m_owner		; // thread using lane zero
+		size_t						m_lane_count; // threads plus the shared lane
+		lane *						m_lanes		; // per thread queues and pools
+		job *						m_records	; // every job record
+		list<std::thread>			m_threads	; // workers
+		std::atomic<int64>			m_pending	; // jobs sitting in deques
+		std::atomic<int64>			m_running	; // jobs taken out and not yet finished
+		std::atomic<int32>			m_sleeping	; // workers waiting for jobs
+		std::atomic<bool>			m_stop		; // shutting down
+		std::mutex					m_mutex		; // sleep lock
+		std::condition_variable		m_wake		; // sleep signal
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// global job system
+namespace ml::globals
+{
+	ML_decl_global(job_system) get_global();
+
+	ML_decl_global(job_system) set_global(job_system *);
+}
+
+#endif // !_ML_JOB_SYSTEM_HPP_
\ No newline at end of file
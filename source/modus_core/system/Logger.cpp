@@ -0,0 +1,322 @@
+#include <modus_core/system/Logger.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// live loggers, checked before a thread gives its rings back
+	static std::mutex		g_logger_mutex	{}; // also guards ring registration
+	static list<uint64>		g_logger_ids	{};
+	static uint64			g_logger_next	{ 1 };
+
+	// rings claimed by this thread
+	static thread_local struct logger_slots final
+	{
+		struct slot final { uint64 id; logger::ring * r; };
+
+		slot		data[4]	{}; // recent loggers
+		slot *		write	{}; // ring being written
+		uint32		size	{}; // size of the pending record
+
+		static void release(slot const & s) noexcept
+		{
+			if (!s.r) { return; }
+			std::lock_guard<std::mutex> lock{ g_logger_mutex };
+			if (std::find(g_logger_ids.begin(), g_logger_ids.end(), s.id) != g_logger_ids.end())
+			{
+				s.r->in_use.store(false, std::memory_order_release);
+			}
+		}
+
+		~logger_slots() noexcept
+		{
+			for (slot const & s : data) { release(s); }
+		}
+	}
+	t_logger_slots;
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	logger::logger(allocator_type alloc)
+		: m_id			{}
+		, m_level		{ ML_LOG_LEVEL }
+		, m_blocking	{}
+		, m_running		{ true }
+		, m_ring_count	{}
+		, m_written		{}
+		, m_rings		{}
+		, m_mutex		{}
+		, m_wake		{}
+		, m_sinks		{ alloc }
+		, m_thread		{}
+	{
+		{
+			std::lock_guard<std::mutex> lock{ g_logger_mutex };
+			m_id = g_logger_next++;
+			g_logger_ids.push_back(m_id);
+		}
+		m_thread = std::thread{ &logger::run, this };
+	}
+
+	logger::~logger() noexcept
+	{
+		if (ML_is_global(logger, this)) { (void)ML_set_global(logger, nullptr); }
+
+		m_running.store(false, std::memory_order_release);
+		m_wake.notify_one();
+		if (m_thread.joinable()) { m_thread.join(); }
+
+		std::lock_guard<std::mutex> lock{ g_logger_mutex };
+		g_logger_ids.erase(std::find(g_logger_ids.begin(), g_logger_ids.end(), m_id));
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	bool logger::submit(int32 level, cstring str, size_t size) noexcept
+	{
+		if (level < get_level()) { return true; }
+		byte * const ptr{ begin_write(size) };
+		if (!ptr) { return false; }
+		record & r{ *reinterpret_cast<record *>(ptr) };
+		r.length = (uint32)size;
+		r.level = level;
+		r.pattern = nullptr;
+		r.decode = nullptr;
+		std::memcpy(ptr + sizeof(record), str, size);
+		end_write();
+		return true;
+	}
+
+	void logger::flush() noexcept
+	{
+		if (std::this_thread::get_id() == m_thread.get_id()) { return; }
+
+		uint64 heads[max_threads]{};
+		size_t const count{ m_ring_count.load(std::memory_order_acquire) };
+		for (size_t i = 0; i < count; ++i)
+		{
+			heads[i] = m_rings[i].head.load(std::memory_order_acquire);
+		}
+		m_wake.notify_one();
+		for (size_t i = 0; i < count; ++i)
+		{
+			while (m_running.load(std::memory_order_acquire) && m_rings[i].tail.load(std::memory_order_acquire) < heads[i])
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	size_t logger::add_sink(sink_type const & value)
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		if (auto const it{ std::find(m_sinks.begin(), m_sinks.end(), nullptr) }; it != m_sinks.end())
+		{
+			*it = value;
+			return (size_t)std::distance(m_sinks.begin(), it);
+		}
+		m_sinks.push_back(value);
+		return m_sinks.size() - 1;
+	}
+
+	void logger::remove_sink(size_t id)
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		if (id < m_sinks.size()) { m_sinks[id] = nullptr; }
+	}
+
+	logger::sink_type logger::console_sink() noexcept
+	{
+		return [](int32 level, std::string_view line) noexcept
+		{
+			std::FILE * const file{ (level == log_level_error) ? stderr : stdout };
+			std::fputs(debug::get_prefix(level), file);
+			std::fwrite(line.data(), 1, line.size(), file);
+			std::fputc('\n', file);
+		};
+	}
+
+	logger::sink_type logger::file_sink(fs::path const & path)
+	{
+		auto const file{ std::make_shared<std::ofstream>(path, std::ios::app) };
+		return [file](int32 level, std::string_view line)
+		{
+			if (*file) { (*file << debug::get_prefix(level)).write(line.data(), (std::streamsize)line.size()).put('\n'); }
+		};
+	}
+
+	logger::stats logger::get_stats() const noexcept
+	{
+		stats temp{ 0, m_written.load(std::memory_order_relaxed), 0 };
+		for (size_t i = 0, n = m_ring_count.load(std::memory_order_acquire); i < n; ++i)
+		{
+			temp.submitted += m_rings[i].submitted.load(std::memory_order_relaxed);
+			temp.dropped += m_rings[i].dropped.load(std::memory_order_relaxed);
+		}
+		return temp;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	byte * logger::begin_write(size_t length) noexcept
+	{
+		ring * const r{ get_ring() };
+		if (!r) { return nullptr; }
+
+		size_t const size{ (sizeof(record) + length + record_align - 1) & ~(record_align - 1) };
+		if (size > ring_capacity / 2)
+		{
+			r->dropped.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		// wrap with a padding record when the end of the buffer is too short, wait or drop when full
+		uint64 head{ r->head.load(std::memory_order_relaxed) };
+		size_t const offset{ (size_t)(head & (ring_capacity - 1)) };
+		size_t const contiguous{ ring_capacity - offset };
+		size_t const needed{ size + ((size > contiguous) ? contiguous : 0) };
+		for (uint64 tail{ r->tail.load(std::memory_order_acquire) }; ring_capacity - (size_t)(head - tail) < needed;)
+		{
+			if (!m_blocking.load(std::memory_order_relaxed) || !m_running.load(std::memory_order_relaxed))
+			{
+				r->dropped.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+			m_wake.notify_one();
+			std::this_thread::yield();
+			tail = r->tail.load(std::memory_order_acquire);
+		}
+		if (size > contiguous)
+		{
+			record & pad{ *reinterpret_cast<record *>(r->data.get() + offset) };
+			pad.size = (uint32)contiguous;
+			pad.length = 0;
+			pad.level = -1;
+			head += contiguous;
+			r->head.store(head, std::memory_order_release);
+		}
+
+		byte * const ptr{ r->data.get() + (head & (ring_capacity - 1)) };
+		reinterpret_cast<record *>(ptr)->size = (uint32)size;
+		t_logger_slots.size = (uint32)size;
+		return ptr;
+	}
+
+	void logger::end_write() noexcept
+	{
+		ring * const r{ t_logger_slots.write->r };
+		r->head.store(r->head.load(std::memory_order_relaxed) + t_logger_slots.size, std::memory_order_release);
+		r->submitted.store(r->submitted.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	logger::ring * logger::get_ring() noexcept
+	{
+		auto & slots{ t_logger_slots };
+		for (auto & s : slots.data)
+		{
+			if (s.id == m_id) { return (slots.write = &s)->r; }
+		}
+
+		// claim a free ring, or a new one
+		ring * r{};
+		{
+			std::lock_guard<std::mutex> lock{ g_logger_mutex };
+			size_t const count{ m_ring_count.load(std::memory_order_relaxed) };
+			for (size_t i = 0; i < count && !r; ++i)
+			{
+				if (!m_rings[i].in_use.load(std::memory_order_acquire)) { r = &m_rings[i]; }
+			}
+			if (!r && count < max_threads)
+			{
+				r = &m_rings[count];
+				r->data.reset(new byte[ring_capacity]);
+				m_ring_count.store(count + 1, std::memory_order_release);
+			}
+			if (!r) { return nullptr; }
+			r->in_use.store(true, std::memory_order_relaxed);
+		}
+
+		// evict the oldest slot
+		logger_slots::release(slots.data[0]);
+		std::move(std::begin(slots.data) + 1, std::end(slots.data), std::begin(slots.data));
+		slots.write = &(slots.data[std::size(slots.data) - 1] = { m_id, r });
+		return r;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void logger::run()
+	{
+		string line{ get_shared_resource() }; // our thread, not the default resource
+		line.reserve(ML_DEBUG_BUFFER_SIZE);
+		while (true)
+		{
+			bool const running{ m_running.load(std::memory_order_acquire) };
+
+			bool any{};
+			for (size_t i = 0, n = m_ring_count.load(std::memory_order_acquire); i < n; ++i)
+			{
+				any |= drain(m_rings[i], line);
+			}
+
+			if (!any)
+			{
+				if (!running) { break; }
+				std::unique_lock<std::mutex> lock{ m_mutex };
+				m_wake.wait_for(lock, std::chrono::milliseconds{ 1 });
+			}
+		}
+	}
+
+	bool logger::drain(ring & r, string & line)
+	{
+		uint64 tail{ r.tail.load(std::memory_order_relaxed) };
+		uint64 const head{ r.head.load(std::memory_order_acquire) };
+		if (tail == head) { return false; }
+
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		while (tail != head)
+		{
+			byte const * const ptr{ r.data.get() + (tail & (ring_capacity - 1)) };
+			record const & rec{ *reinterpret_cast<record const *>(ptr) };
+			if (0 <= rec.level)
+			{
+				line.clear();
+				if (rec.pattern) { rec.decode(line, *rec.pattern, ptr + sizeof(record)); }
+				else { line.append((cstring)ptr + sizeof(record), rec.length); }
+				for (sink_type const & sink : m_sinks)
+				{
+					if (sink) { sink(rec.level, line); }
+				}
+				m_written.fetch_add(1, std::memory_order_relaxed);
+			}
+			tail += rec.size;
+			r.tail.store(tail, std::memory_order_release);
+		}
+		return true;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// debug backend
+namespace ml::debug
+{
+	bool submit(int32 level, cstring str, size_t size) noexcept
+	{
+		logger * const l{ ML_get_global(logger) };
+		return l && l->submit(level, str, size);
+	}
+}
+
+// global logger
+namespace ml::globals
+{
+	static logger * g_logger{};
+
+	ML_impl_global(logger) get_global() { return g_logger; }
+
+	ML_impl_global(logger) set_global(logger * value) { return g_logger = value; }
+}
\ No newline at end of file
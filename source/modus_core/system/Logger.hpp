@@ -0,0 +1,244 @@
+#ifndef _ML_LOGGER_HPP_
+#define _ML_LOGGER_HPP_
+
+#include <modus_core/detail/Method.hpp>
+#include <modus_core/system/Memory.hpp>
+
+// log with a compile time pattern, arguments are formatted on the logger thread
+#define ML_log(level, fmt, ...)														\
+	do { if constexpr (ML_LOG_LEVEL <= (level)) {									\
+		_ML logger::submit_global((level), ML_format(fmt), ##__VA_ARGS__);			\
+	} } while (0)
+
+#define ML_log_trace(fmt, ...)		ML_log(_ML log_level_trace, fmt, ##__VA_ARGS__)
+#define ML_log_info(fmt, ...)		ML_log(_ML log_level_info, fmt, ##__VA_ARGS__)
+#define ML_log_warning(fmt, ...)	ML_log(_ML log_level_warning, fmt, ##__VA_ARGS__)
+#define ML_log_error(fmt, ...)		ML_log(_ML log_level_error, fmt, ##__VA_ARGS__)
+
+namespace ml
+{
+	// asynchronous logger
+	struct ML_CORE_API logger final : non_copyable, trackable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		using allocator_type = typename pmr::polymorphic_allocator<byte>;
+
+		using sink_type = typename method< void(int32, std::string_view) >;
+
+		using decode_fn = typename void(*)(string &, util::format_pattern const &, byte const *);
+
+		static constexpr size_t max_threads{ 64 };
+
+		static constexpr size_t ring_capacity{ 1 << 18 }; // bytes per thread
+
+		// record header, payload follows
+		struct ML_NODISCARD record final
+		{
+			uint32							size	; // header + payload, padded
+			uint32							length	; // payload
+			int32							level	; // level, or -1 for padding
+			util::format_pattern const *	pattern	; // pattern, or nullptr for text
+			decode_fn						decode	; // payload decoder
+		};
+
+		static constexpr size_t record_align{ 32 };
+
+		static_assert(sizeof(record) <= record_align);
+
+		// single producer single consumer byte ring
+		struct ML_NODISCARD ring final
+		{
+			alignas(64) std::atomic<uint64>	head		{}; // written by the producer
+			std::atomic<uint64>				submitted	{}; // records written by the producer
+			std::atomic<uint64>				dropped		{}; // records that did not fit
+			alignas(64) std::atomic<uint64>	tail		{}; // written by the consumer
+			alignas(64) std::atomic<bool>	in_use		{}; // owned by a thread
+			std::unique_ptr<byte[]>			data		{}; // allocated on first use
+		};
+
+		struct ML_NODISCARD stats final
+		{
+			uint64 submitted, written, dropped;
+		};
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		logger(allocator_type alloc = {});
+
+		~logger() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// submit preformatted text, returns false if it had to be dropped
+		bool submit(int32 level, cstring str, size_t size) noexcept;
+
+		// submit a pattern and its arguments, formatted later
+		template <class ... Args
+		> bool submit(int32 level, util::format_pattern const & fmt, Args const & ... args) noexcept
+		{
+			if (level < get_level()) { return true; }
+			size_t const length{ (encoded_size(args) + ... + 0) };
+			byte * const ptr{ begin_write(length) };
+			if (!ptr) { return false; }
+			record & r{ *reinterpret_cast<record *>(ptr) };
+			r.length = (uint32)length;
+			r.level = level;
+			r.pattern = &fmt;
+			r.decode = &decode<Args...>;
+			byte * payload{ ptr + sizeof(record) };
+			((payload = encode(payload, args)), ...);
+			end_write();
+			return true;
+		}
+
+		// submit through the global logger, or print directly if there is none
+		template <class ... Args
+		> static void submit_global(int32 level, util::format_pattern const & fmt, Args const & ... args) noexcept
+		{
+			if (logger * const l{ ML_get_global(logger) }) { (void)l->submit(level, fmt, args...); }
+			else { (void)debug::print(level, fmt, args...); }
+		}
+
+		// block until everything submitted so far reached the sinks
+		void flush() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// sinks are called on the logger thread
+		size_t add_sink(sink_type const & value);
+
+		void remove_sink(size_t id);
+
+		// writes to stdout, errors to stderr
+		ML_NODISCARD static sink_type console_sink() noexcept;
+
+		// appends to a file
+		ML_NODISCARD static sink_type file_sink(fs::path const & path);
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD int32 get_level() const noexcept { return m_level.load(std::memory_order_relaxed); }
+
+		void set_level(int32 value) noexcept { m_level.store(value, std::memory_order_relaxed); }
+
+		// wait for space instead of dropping when a ring is full
+		ML_NODISCARD bool get_blocking() const noexcept { return m_blocking.load(std::memory_order_relaxed); }
+
+		void set_blocking(bool value) noexcept { m_blocking.store(value, std::memory_order_relaxed); }
+
+		ML_NODISCARD stats get_stats() const noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		// per argument storage, strings are copied inline
+		template <class T
+		> using storage_t = std::conditional_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, T, std::string_view>;
+
+		template <class T
+		> static size_t encoded_size(T const & value) noexcept
+		{
+			if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) { return sizeof(T); }
+			else if constexpr (std::is_convertible_v<T const &, std::string_view>) { return sizeof(uint32) + std::string_view{ value }.size(); }
+			else
+			{
+				util::format_buffer_sink sink{ nullptr, 0, 0 };
+				util::format_value(sink, value);
+				return sizeof(uint32) + sink.count;
+			}
+		}
+
+		template <class T
+		> static byte * encode(byte * ptr, T const & value) noexcept
+		{
+			if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+			{
+				std::memcpy(ptr, &value, sizeof(T));
+				return ptr + sizeof(T);
+			}
+			else if constexpr (std::is_convertible_v<T const &, std::string_view>)
+			{
+				std::string_view const str{ value };
+				uint32 const size{ (uint32)str.size() };
+				std::memcpy(ptr, &size, sizeof(uint32));
+				std::memcpy(ptr + sizeof(uint32), str.data(), size);
+				return ptr + sizeof(uint32) + size;
+			}
+			else
+			{
+				// anything else is formatted now, it may not outlive the call
+				util::format_buffer_sink sink{ (char *)ptr + sizeof(uint32), (size_t)-1, 0 };
+				util::format_value(sink, value);
+				uint32 const size{ (uint32)sink.count };
+				std::memcpy(ptr, &size, sizeof(uint32));
+				return ptr + sizeof(uint32) + size;
+			}
+		}
+
+		template <class T
+		> static T decode_one(byte const *& ptr) noexcept
+		{
+			if constexpr (std::is_same_v<T, std::string_view>)
+			{
+				uint32 size{};
+				std::memcpy(&size, ptr, sizeof(uint32));
+				T const temp{ (cstring)ptr + sizeof(uint32), size };
+				ptr += sizeof(uint32) + size;
+				return temp;
+			}
+			else
+			{
+				T temp{};
+				std::memcpy(&temp, ptr, sizeof(T));
+				ptr += sizeof(T);
+				return temp;
+			}
+		}
+
+		template <class ... Args
+		> static void decode(string & out, util::format_pattern const & fmt, byte const * ptr)
+		{
+			std::tuple<storage_t<Args>...> const values{ decode_one<storage_t<Args>>(ptr)... };
+			std::apply([&](auto const & ... v) {
+				util::format_to(std::back_inserter(out), fmt, v...);
+			}, values);
+		}
+
+		// reserve space in this thread's ring, nullptr if full
+		byte * begin_write(size_t length) noexcept;
+
+		void end_write() noexcept;
+
+		ring * get_ring() noexcept;
+
+		void run();
+
+		bool drain(ring & r, string & line);
+
+		uint64					m_id		; // unique id
+		std::atomic<int32>		m_level		; // runtime level
+		std::atomic<bool>		m_blocking	; // wait when full
+		std::atomic<bool>		m_running	; // consumer running
+		std::atomic<size_t>		m_ring_count; // rings handed out
+		std::atomic<uint64>		m_written	; // records written
+		ring					m_rings[max_threads]; // per thread rings
+		std::mutex				m_mutex		; // sinks
+		std::condition_variable	m_wake		; // wakes the consumer
+		list<sink_type>			m_sinks		; // sinks
+		std::thread				m_thread	; // consumer
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+// global logger
+namespace ml::globals
+{
+	ML_decl_global(logger) get_global();
+
+	ML_decl_global(logger) set_global(logger *);
+}
+
+#endif // !_ML_LOGGER_HPP_
\ No newline at end of file
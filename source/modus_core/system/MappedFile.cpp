@@ -0,0 +1,71 @@
+#include <modus_core/system/MappedFile.hpp>
+
+#if defined(ML_os_windows)
+#	include <Windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	bool mapped_file::open(fs::path const & path) noexcept
+	{
+		this->close();
+
+#if defined(ML_os_windows)
+		HANDLE const file{ CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+		if (file == INVALID_HANDLE_VALUE) { return false; }
+
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) { CloseHandle(file); return false; }
+
+		HANDLE const mapping{ CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) };
+		if (!mapping) { CloseHandle(file); return false; }
+
+		void * const view{ MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) };
+		if (!view) { CloseHandle(mapping); CloseHandle(file); return false; }
+
+		m_file = file;
+		m_mapping = mapping;
+		m_data = (byte const *)view;
+		m_size = (size_t)size.QuadPart;
+#else
+		int32 const file{ ::open(path.c_str(), O_RDONLY) };
+		if (file < 0) { return false; }
+
+		struct stat st{};
+		if (::fstat(file, &st) != 0 || st.st_size <= 0) { ::close(file); return false; }
+
+		void * const view{ ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, file, 0) };
+		::close(file);
+		if (view == MAP_FAILED) { return false; }
+
+		m_data = (byte const *)view;
+		m_size = (size_t)st.st_size;
+#endif
+		return true;
+	}
+
+	void mapped_file::close() noexcept
+	{
+		if (!m_data) { return; }
+
+#if defined(ML_os_windows)
+		UnmapViewOfFile(m_data);
+		CloseHandle((HANDLE)m_mapping);
+		CloseHandle((HANDLE)m_file);
+#else
+		::munmap((void *)m_data, m_size);
+#endif
+		m_data = nullptr;
+		m_size = 0;
+		m_file = m_mapping = nullptr;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef _ML_MAPPED_FILE_HPP_
+#define _ML_MAPPED_FILE_HPP_
+
+#include <modus_core/Standard.hpp>
+#include <modus_core/detail/NonCopyable.hpp>
+
+namespace ml
+{
+	// read only memory mapped file
+	struct ML_CORE_API mapped_file final : non_copyable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		mapped_file() noexcept
+			: m_data	{}
+			, m_size	{}
+			, m_file	{}
+			, m_mapping	{}
+		{
+		}
+
+		explicit mapped_file(fs::path const & path) noexcept : mapped_file{}
+		{
+			this->open(path);
+		}
+
+		mapped_file(mapped_file && other) noexcept : mapped_file{}
+		{
+			this->swap(std::move(other));
+		}
+
+		mapped_file & operator=(mapped_file && other) noexcept
+		{
+			this->swap(std::move(other));
+			return (*this);
+		}
+
+		~mapped_file() noexcept { this->close(); }
+
+		void swap(mapped_file & other) noexcept
+		{
+			if (this != std::addressof(other))
+			{
+				std::swap(m_data, other.m_data);
+				std::swap(m_size, other.m_size);
+				std::swap(m_file, other.m_file);
+				std::swap(m_mapping, other.m_mapping);
+			}
+		}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		bool open(fs::path const & path) noexcept;
+
+		void close() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD operator bool() const noexcept { return m_data != nullptr; }
+
+		ML_NODISCARD byte const * data() const noexcept { return m_data; }
+
+		ML_NODISCARD size_t size() const noexcept { return m_size; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		byte const *	m_data		; // view
+		size_t			m_size		; // size in bytes
+		void *			m_file		; // file handle
+		void *			m_mapping	; // mapping handle
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+}
+
+#endif // !_ML_MAPPED_FILE_HPP_
\ No newline at end of file
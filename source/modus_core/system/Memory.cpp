@@ -4,11 +4,20 @@ namespace ml
 {
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+	pmr::memory_resource * get_shared_resource() noexcept
+	{
+		static pmr::synchronized_pool_resource instance{ pmr::new_delete_resource() };
+		return &instance;
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 	memory_manager::memory_manager(passthrough_resource * mres)
 		: m_resource{ ML_check(mres) }
 		, m_alloc	{ m_resource }
 		, m_records	{ m_alloc }
 		, m_counter	{}
+		, m_mutex	{}
 	{
 		ML_ctor_global(memory_manager);
 	}
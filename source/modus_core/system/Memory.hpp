@@ -2,6 +2,7 @@
 #define _ML_MEMORY_HPP_
 
 #include <modus_core/detail/BatchVector.hpp>
+#include <modus_core/detail/SoaVector.hpp>
 #include <modus_core/detail/Globals.hpp>
 
 // simplified interface
@@ -47,7 +48,9 @@ namespace ml
 
 		ML_NODISCARD auto get_resource() const noexcept -> pmr::memory_resource * const { return m_resource; }
 
-		ML_NODISCARD auto num_allocations() const noexcept -> size_t { return m_num_allocations; }
+		ML_NODISCARD auto num_allocations() const noexcept -> size_t { return m_num_allocations.load(std::memory_order_relaxed); }
+
+		ML_NODISCARD auto total_allocations() const noexcept -> size_t { return m_total_allocations.load(std::memory_order_relaxed); }
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
@@ -57,9 +60,9 @@ namespace ml
 
 		ML_NODISCARD auto buffer_size() const noexcept -> size_t { return m_buffer_size; }
 
-		ML_NODISCARD auto buffer_used() const noexcept -> size_t { return m_buffer_used; }
+		ML_NODISCARD auto buffer_used() const noexcept -> size_t { return m_buffer_used.load(std::memory_order_relaxed); }
 
-		ML_NODISCARD auto buffer_free() const noexcept -> size_t { return m_buffer_size - m_buffer_used; }
+		ML_NODISCARD auto buffer_free() const noexcept -> size_t { return m_buffer_size - buffer_used(); }
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
@@ -102,15 +105,17 @@ namespace ml
 	private:
 		void * do_allocate(size_t bytes, size_t align) override
 		{
-			++m_num_allocations;
-			m_buffer_used += bytes;
+			// counters only, thread safety of the allocation itself is up to the upstream resource
+			m_num_allocations.fetch_add(1, std::memory_order_relaxed);
+			m_total_allocations.fetch_add(1, std::memory_order_relaxed);
+			m_buffer_used.fetch_add(bytes, std::memory_order_relaxed);
 			return m_resource->allocate(bytes, align);
 		}
 
 		void do_deallocate(void * ptr, size_t bytes, size_t align) override
 		{
-			--m_num_allocations;
-			m_buffer_used -= bytes;
+			m_num_allocations.fetch_sub(1, std::memory_order_relaxed);
+			m_buffer_used.fetch_sub(bytes, std::memory_order_relaxed);
 			return m_resource->deallocate(ptr, bytes, align);
 		}
 
@@ -126,13 +131,22 @@ namespace ml
 		pointer const m_buffer_data;
 		size_t const m_buffer_size;
 
-		size_t m_num_allocations{};
-		size_t m_buffer_used{};
+		std::atomic<size_t> m_num_allocations{};
+		std::atomic<size_t> m_total_allocations{};
+		std::atomic<size_t> m_buffer_used{};
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	};
 }
 
+// shared resource
+namespace ml
+{
+	// thread safe resource for containers built off the main thread,
+	// safe whatever the default resource is
+	ML_NODISCARD ML_CORE_API pmr::memory_resource * get_shared_resource() noexcept;
+}
+
 // smart pointers
 namespace ml
 {
@@ -260,7 +274,7 @@ namespace ml
 
 		enum : size_t { ID_index, ID_count, ID_size, ID_addr };
 
-		using record_storage = typename batch_vector
+		using record_storage = typename soa_vector
 		<
 			size_t,	// index
 			size_t,	// count
@@ -414,6 +428,7 @@ namespace ml
 	private:
 		void * do_allocate(size_t count, size_t size) noexcept
 		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
 			return std::get<ID_addr>(m_records.push_back
 			(
 				++m_counter, count, size, m_alloc.allocate(count * size))
@@ -422,6 +437,7 @@ namespace ml
 
 		void do_deallocate(void * addr) noexcept
 		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
 			if (size_t const i{ m_records.lookup<ID_addr>(addr) }; i != m_records.npos)
 			{
 				m_alloc.deallocate(
@@ -429,7 +445,7 @@ namespace ml
 					m_records.get<ID_count>(i) *
 					m_records.get<ID_size>(i));
 
-				m_records.erase(i);
+				m_records.swap_remove(i);
 			}
 		}
 
@@ -440,6 +456,7 @@ namespace ml
 		allocator_type					m_alloc		; // allocator
 		record_storage					m_records	; // records
 		size_t							m_counter	; // counter
+		std::mutex						m_mutex		; // records lock, trackables are created on any thread
 
 		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	};
@@ -0,0 +1,89 @@
+#include <modus_core/system/StringTable.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	string_table::string_table(allocator_type alloc)
+		: m_mutex	{}
+		, m_arena	{ 64 * 1024, alloc.resource() }
+		, m_lookup	{ alloc }
+		, m_chunks	{}
+		, m_count	{}
+		, m_requests{}
+		, m_bytes	{}
+	{
+		// id zero is the empty string
+		entry * const first{ static_cast<entry *>(m_arena.allocate(chunk_size * sizeof(entry), alignof(entry))) };
+		first[0] = { "", 0, 0 };
+		m_chunks[0].store(first, std::memory_order_release);
+		m_count.store(1, std::memory_order_release);
+
+		ML_ctor_global(string_table);
+	}
+
+	string_table::~string_table() noexcept
+	{
+		ML_dtor_global(string_table);
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	uint32 string_table::intern(std::string_view value, hash_t hash)
+	{
+		m_requests.fetch_add(1, std::memory_order_relaxed);
+		if (value.empty()) { return 0; }
+
+		// most calls find an existing string
+		{
+			std::shared_lock<std::shared_mutex> lock{ m_mutex };
+			if (auto const it{ m_lookup.find(key{ value, hash }) }) { return *it->second; }
+		}
+
+		std::unique_lock<std::shared_mutex> lock{ m_mutex };
+		if (auto const it{ m_lookup.find(key{ value, hash }) }) { return *it->second; }
+
+		uint32 const id{ m_count.load(std::memory_order_relaxed) };
+		ML_assert("string table is full" && id < chunk_size * max_chunks);
+		if (!(id % chunk_size))
+		{
+			m_chunks[id / chunk_size].store(static_cast<entry *>(m_arena.allocate(chunk_size * sizeof(entry), alignof(entry))), std::memory_order_release);
+		}
+
+		char * const data{ static_cast<char *>(m_arena.allocate(value.size() + 1, 1)) };
+		std::memcpy(data, value.data(), value.size());
+		data[value.size()] = 0;
+		m_bytes += value.size() + 1;
+
+		m_chunks[id / chunk_size].load(std::memory_order_relaxed)[id % chunk_size] = { data, (uint32)value.size(), hash };
+		m_lookup.insert(key{ { data, value.size() }, hash }, id);
+		m_count.store(id + 1, std::memory_order_release);
+		return id;
+	}
+
+	uint32 string_table::find(std::string_view value, hash_t hash) const noexcept
+	{
+		if (value.empty()) { return 0; }
+		std::shared_lock<std::shared_mutex> lock{ m_mutex };
+		auto const it{ m_lookup.find(key{ value, hash }) };
+		return it ? *it->second : 0;
+	}
+
+	string_table::stats string_table::get_stats() const noexcept
+	{
+		std::shared_lock<std::shared_mutex> lock{ m_mutex };
+		return { size(), m_bytes, m_requests.load(std::memory_order_relaxed) };
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// global string table
+namespace ml::globals
+{
+	static string_table * g_string_table{};
+
+	ML_impl_global(string_table) get_global() { return g_string_table; }
+
+	ML_impl_global(string_table) set_global(string_table * value) { return g_string_table = value; }
+}
\ No newline at end of file
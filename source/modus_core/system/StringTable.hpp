@@ -0,0 +1,189 @@
+#ifndef _ML_STRING_TABLE_HPP_
+#define _ML_STRING_TABLE_HPP_
+
+#include <modus_core/detail/DenseHashMap.hpp>
+#include <modus_core/system/Memory.hpp>
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// append only table of unique strings, ids are stable for its lifetime
+	struct ML_CORE_API string_table final : non_copyable, trackable
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	public:
+		using allocator_type = typename pmr::polymorphic_allocator<byte>;
+
+		static constexpr size_t chunk_size{ 1 << 12 }; // entries per chunk
+
+		static constexpr size_t max_chunks{ 1 << 10 }; // chunks are never moved
+
+		struct ML_NODISCARD entry final
+		{
+			cstring	data; // null terminated, owned by the arena
+			uint32	size; // length
+			hash_t	hash; // fast_hash of the text
+		};
+
+		struct ML_NODISCARD stats final
+		{
+			size_t count, bytes, requests;
+		};
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		string_table(allocator_type alloc = {});
+
+		~string_table() noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		// find or add, zero is the empty string
+		ML_NODISCARD uint32 intern(std::string_view value, hash_t hash);
+
+		// zero if not present
+		ML_NODISCARD uint32 find(std::string_view value, hash_t hash) const noexcept;
+
+		// lock free, the id must have come from this table
+		ML_NODISCARD entry const & get(uint32 id) const noexcept
+		{
+			return m_chunks[id / chunk_size].load(std::memory_order_acquire)[id % chunk_size];
+		}
+
+		ML_NODISCARD size_t size() const noexcept { return m_count.load(std::memory_order_acquire); }
+
+		ML_NODISCARD stats get_stats() const noexcept;
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		struct ML_NODISCARD key final
+		{
+			std::string_view	str	;
+			hash_t				hash;
+
+			ML_NODISCARD bool operator==(key const & other) const noexcept
+			{
+				return hash == other.hash && str == other.str;
+			}
+		};
+
+		struct key_hash final
+		{
+			ML_NODISCARD size_t operator()(key const & k) const noexcept { return (size_t)k.hash; }
+		};
+
+		mutable std::shared_mutex				m_mutex		; // guards everything but the chunks
+		pmr::monotonic_buffer_resource			m_arena		; // text and chunks
+		dense_hash_map<key, uint32, key_hash>	m_lookup	; // text to id
+		std::atomic<entry *>					m_chunks[max_chunks]; // entries by id
+		std::atomic<uint32>						m_count		; // entries
+		std::atomic<size_t>						m_requests	; // intern calls
+		size_t									m_bytes		; // text bytes
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+// global string table
+namespace ml::globals
+{
+	ML_decl_global(string_table) get_global();
+
+	ML_decl_global(string_table) set_global(string_table *);
+}
+
+namespace ml
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// handle to a string in the global table, equal text gives an equal id
+	struct ML_NODISCARD interned_string final
+	{
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		constexpr interned_string() noexcept : m_id{}, m_hash{} {}
+
+		interned_string(std::string_view value) noexcept : interned_string{}
+		{
+			if (value.empty()) { return; }
+			m_hash = fast_hash{}(value);
+			m_id = ML_check(ML_get_global(string_table))->intern(value, m_hash);
+		}
+
+		interned_string(cstring value) noexcept : interned_string{ std::string_view{ value ? value : "" } } {}
+
+		interned_string(string const & value) noexcept : interned_string{ std::string_view{ value } } {}
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD uint32 id() const noexcept { return m_id; }
+
+		ML_NODISCARD hash_t hash() const noexcept { return m_hash; }
+
+		ML_NODISCARD bool empty() const noexcept { return !m_id; }
+
+		ML_NODISCARD size_t size() const noexcept { return m_id ? entry().size : 0; }
+
+		ML_NODISCARD cstring c_str() const noexcept { return m_id ? entry().data : ""; }
+
+		ML_NODISCARD std::string_view view() const noexcept { return m_id ? std::string_view{ entry().data, entry().size } : std::string_view{}; }
+
+		ML_NODISCARD string str() const { return string{ view() }; }
+
+		ML_NODISCARD operator std::string_view() const noexcept { return view(); }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+		ML_NODISCARD bool operator==(interned_string const & other) const noexcept { return m_id == other.m_id; }
+
+		ML_NODISCARD bool operator!=(interned_string const & other) const noexcept { return m_id != other.m_id; }
+
+		// by id, not alphabetical
+		ML_NODISCARD bool operator<(interned_string const & other) const noexcept { return m_id < other.m_id; }
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	private:
+		ML_NODISCARD string_table::entry const & entry() const noexcept
+		{
+			return ML_get_global(string_table)->get(m_id);
+		}
+
+		uint32	m_id	; // table id
+		hash_t	m_hash	; // cached hash
+
+		/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	inline void to_json(json & j, interned_string const & v)
+	{
+		j = json::string_t{ v.view() };
+	}
+
+	inline void from_json(json const & j, interned_string & v)
+	{
+		v = interned_string{ std::string_view{ j.get_ref<json::string_t const &>() } };
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
+
+namespace std
+{
+	template <> struct hash<_ML interned_string>
+	{
+		ML_NODISCARD size_t operator()(_ML interned_string const & value) const noexcept
+		{
+			return (size_t)value.hash();
+		}
+	};
+}
+
+#endif // !_ML_STRING_TABLE_HPP_
\ No newline at end of file
@@ -146,6 +146,12 @@ namespace ml
 
 		static void poll_events();
 
+		// blocks until an event arrives or the timeout in seconds passes
+		static void wait_events(float64 timeout);
+
+		// wakes a thread blocked in wait_events, callable from any thread
+		static void post_empty_event();
+
 		static void swap_buffers(window_handle handle);
 
 		static void swap_interval(int32 value);
@@ -18,9 +18,10 @@ static class memcfg final : public singleton<memcfg>
 
 	array<byte, RESERVE_MEMORY>			data{};
 	pmr::monotonic_buffer_resource		mono{ data.data(), data.size() };
-	pmr::unsynchronized_pool_resource	pool{ &mono };
+	pmr::synchronized_pool_resource		pool{ &mono }; // jobs, scripts and watchers allocate beside the main thread
 	passthrough_resource				view{ &pool, data.data(), data.size() };
 	memory_manager						mman{ &view };
+	string_table						strs{ mman.get_allocator() };
 
 	memcfg() { pmr::set_default_resource(mman.get_resource()); }
 
@@ -42,18 +43,47 @@ static json const default_settings{ R"(
 	"app_version": "alpha",
 	"app_data_path": "../../../",
 
+	"log": {
+		"level": 0,
+		"console": true
+	},
+
+	"jobs": {
+		"threads": 0
+	},
+
+	"loop": {
+		"fixed_rate": 60,
+		"max_steps": 5,
+		"frame_rate": 0,
+		"idle_rate": 10,
+		"idle_timeout": 0.5
+	},
+
 	"imgui": {
 		"style": { "path": "resource/modus_launcher.style" }
 	},
 
 	"addons": [
-		{ "path": "addons/sandbox" }
+		{ "path": "addons/sandbox", "hot_reload": true },
+		{ "path": "addons/bench", "hot_reload": true }
 	],
 
 	"scripts": [
 		{ "path": "resource/modus_launcher.py" }
 	],
 
+	"python": {
+		"frame_budget": 0.002,
+		"switch_interval": 0.001,
+		"cache_path": "cache/python"
+	},
+
+	"assets": {
+		"hot_reload": true,
+		"debounce": 0.05
+	},
+
 	"window": {
 		"title": "modus",
 		"display": {
@@ -113,19 +143,27 @@ int32 main(int32 argc, char * argv[])
 	{
 		if (auto const it{ j.find("path") }; it != j.end() && it->is_string())
 		{
-			app.install_addon(*it);
+			if (j.value("hot_reload", false)) { app.watch_addon(*it); }
+			else { app.install_addon(*it); }
 		}
 	}
+	app.trace_startup("addons");
 
 	// run scripts
 	for (json const & j : app.get_attr("scripts"))
 	{
 		if (auto const it{ j.find("path") }; it != j.end() && it->is_string())
 		{
-			py::eval_file(app.get_path_to(*it));
+			app.get_scripts()->run_file(app.get_path_to(*it));
 		}
 	}
 
+	// the startup trace gets a mark once the scripts are through
+	app.get_scripts()->post([&app]()
+	{
+		app.get_scripts()->post_main([&app, time = app.get_time()]() { app.trace_startup("scripts", time); });
+	});
+
 	return app.run();
 }
 
@@ -0,0 +1,215 @@
+#include "./Tests.hpp"
+
+#include <modus_core/detail/Bitset.hpp>
+#include <modus_core/detail/DenseHashMap.hpp>
+#include <modus_core/detail/SmallVector.hpp>
+#include <modus_core/detail/SoaVector.hpp>
+
+namespace ml::tests
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// counts what goes through it, for checking when containers touch the heap
+	struct counting_resource final : pmr::memory_resource
+	{
+		size_t allocations{}, live{};
+
+		void * do_allocate(size_t n, size_t a) override { ++allocations; live += n; return pmr::new_delete_resource()->allocate(n, a); }
+
+		void do_deallocate(void * p, size_t n, size_t a) override { live -= n; pmr::new_delete_resource()->deallocate(p, n, a); }
+
+		bool do_is_equal(pmr::memory_resource const & o) const noexcept override { return this == &o; }
+	};
+
+	// every key lands in the same group, lookups have to probe past it
+	struct colliding_hash final
+	{
+		size_t operator()(int32) const noexcept { return 0; }
+	};
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void test_dense_hash_map()
+	{
+		// insert and find
+		dense_hash_map<int32, int32> m{};
+		for (int32 i = 0; i < 1000; ++i) { m.insert(i, i * 2); }
+		TEST_check(m.size() == 1000);
+		bool all_found{ true };
+		for (int32 i = 0; i < 1000; ++i) { auto const it{ m.find(i) }; all_found &= it && *it->second == i * 2; }
+		TEST_check(all_found);
+		TEST_check(!m.contains(1000));
+		TEST_check(!m.find(-1));
+
+		// existing keys are kept
+		auto const [it, inserted] { m.try_emplace(7, 0) };
+		TEST_check(!inserted);
+		TEST_check(*it.second == 14);
+
+		// erase moves the last entry into the hole
+		for (int32 i = 1; i < 1000; i += 2) { TEST_check(m.erase(i)); }
+		TEST_check(!m.erase(1));
+		TEST_check(m.size() == 500);
+		bool erased_ok{ true };
+		for (int32 i = 0; i < 1000; ++i) { auto const it{ m.find(i) }; erased_ok &= (i % 2) ? !it : (it && *it->second == i * 2); }
+		TEST_check(erased_ok);
+		TEST_check(m.keys().size() == m.values().size());
+
+		// churn leaves deleted slots behind, the table must not keep growing
+		dense_hash_map<int32, int32> churn{};
+		for (int32 i = 0; i < 100; ++i) { churn.insert(i, i); }
+		for (int32 i = 100; i < 20'000; ++i) { churn.erase(i - 100); churn.insert(i, i); }
+		TEST_check(churn.size() == 100);
+		TEST_check(churn.capacity() <= 512);
+		TEST_check(churn.contains(19'999) && !churn.contains(19'899));
+
+		// one hash for everything
+		dense_hash_map<int32, int32, colliding_hash> same{};
+		for (int32 i = 0; i < 100; ++i) { same[i] = i; }
+		for (int32 i = 0; i < 100; i += 3) { same.erase(i); }
+		bool probed_ok{ true };
+		for (int32 i = 0; i < 100; ++i) { probed_ok &= same.contains(i) == (i % 3 != 0); }
+		TEST_check(probed_ok);
+		same[0] = 42;
+		TEST_check(same.contains(0) && *same.find(0)->second == 42);
+
+		// copies are independent, clear keeps the table
+		dense_hash_map<int32, int32> copy{ m };
+		copy.erase(0);
+		TEST_check(m.contains(0) && !copy.contains(0));
+		size_t const capacity{ m.capacity() };
+		m.clear();
+		TEST_check(m.empty() && !m.contains(0) && m.capacity() == capacity);
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void test_small_vector()
+	{
+		counting_resource heap{};
+
+		// nothing is allocated until the inline slots run out
+		small_vector<int32, 4> v{ &heap };
+		for (int32 i = 0; i < 4; ++i) { v.push_back(i); }
+		TEST_check(v.is_inline());
+		TEST_check(heap.allocations == 0);
+		v.push_back(v[0]); // refers to an element while growing
+		TEST_check(!v.is_inline());
+		TEST_check(heap.allocations == 1);
+		TEST_check((v == small_vector<int32, 4>{ 0, 1, 2, 3, 0 }));
+
+		// insert and erase keep the order
+		v.insert(v.begin(), -1);
+		v.erase(v.begin() + 2, v.begin() + 4);
+		TEST_check((v == small_vector<int32, 4>{ -1, 0, 3, 0 }));
+
+		// shrinking back under the inline capacity returns the buffer
+		v.pop_back();
+		v.shrink_to_fit();
+		TEST_check(v.is_inline());
+		TEST_check(heap.live == 0);
+
+		// moving a heap vector takes its buffer, an inline one is moved element-wise
+		small_vector<string, 2> a{ &heap };
+		for (int32 i = 0; i < 3; ++i) { a.emplace_back(32, (char)('a' + i)); }
+		string const * const data{ a.data() };
+		small_vector<string, 2> b{ std::move(a), &heap };
+		TEST_check(b.data() == data && b.size() == 3 && a.empty() && a.is_inline());
+		TEST_check(b.back() == string(32, 'c'));
+		small_vector<string, 2> c{ &heap };
+		c.emplace_back("inline");
+		small_vector<string, 2> d{ std::move(c), &heap };
+		TEST_check(d.is_inline() && d.front() == "inline" && c.empty());
+
+		b.clear(); b.shrink_to_fit();
+		TEST_check(b.is_inline());
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void test_soa_vector()
+	{
+		counting_resource heap{};
+		{
+			soa_vector<float32, int32, string> v{ &heap };
+			for (int32 i = 0; i < 100; ++i) { v.push_back((float32)i, i, string(32, (char)('a' + i % 26))); }
+			TEST_check(v.size() == 100 && 100 <= v.capacity());
+
+			// every column starts on its own aligned block
+			TEST_check((uintptr_t)v.data<0>() % decltype(v)::alignment == 0);
+			TEST_check((uintptr_t)v.data<1>() % decltype(v)::alignment == 0);
+			TEST_check((uintptr_t)v.data<2>() % decltype(v)::alignment == 0);
+
+			// rows stay together through growth
+			bool rows_ok{ true };
+			for (int32 i = 0; i < 100; ++i) { rows_ok &= v.get<0>(i) == (float32)i && v.get<int32>(i) == i && v.get<2>(i)[0] == (char)('a' + i % 26); }
+			TEST_check(rows_ok);
+
+			// erase shifts, swap_remove moves the last row in
+			v.erase(0);
+			TEST_check(v.size() == 99 && v.get<1>(0) == 1);
+			v.swap_remove(0);
+			TEST_check(v.size() == 98 && v.get<1>(0) == 99 && v.get<2>(0)[0] == (char)('a' + 99 % 26));
+			TEST_check(v.lookup<1>(50) != decltype(v)::npos);
+			TEST_check(v.lookup<1>(1) == decltype(v)::npos);
+
+			// copies are deep
+			soa_vector<float32, int32, string> copy{ v, &heap };
+			copy.get<2>(0) = "changed";
+			TEST_check(copy.size() == v.size() && v.get<2>(0) != "changed");
+
+			v.resize(10);
+			TEST_check(v.size() == 10 && v.get<1>(9) == copy.get<1>(9));
+			v.clear();
+			TEST_check(v.empty());
+		}
+		// destroyed rows and blocks are all handed back
+		TEST_check(heap.live == 0);
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void test_bitset()
+	{
+		ds::bitset<100> b{};
+		TEST_check(b.none() && b.count() == 0);
+		b.set(0); b.set(63); b.set(64); b.set(99);
+		TEST_check(b.read(63) && b.read(64) && !b.read(65));
+		TEST_check(b.count() == 4);
+		TEST_check(b.find_first() == 0 && b.find_next(0) == 63 && b.find_next(63) == 64 && b.find_next(64) == 99);
+		TEST_check(b.find_next(99) == decltype(b)::npos);
+
+		// flipping leaves the bits past the end clear
+		ds::bitset<100> const f{ ~b };
+		TEST_check(f.count() == 96);
+		TEST_check(!(~ds::bitset<100>{}).none() && (~ds::bitset<100>{}).all());
+
+		ds::bitset<100> mask{};
+		mask.set(63); mask.set(99);
+		TEST_check(b.contains(mask) && !mask.contains(b));
+		TEST_check(b.intersects(mask) && !f.intersects(mask));
+		TEST_check((b & mask) == mask && (b | mask) == b && (b ^ b).none());
+
+		// the batched match agrees with contains on every width
+		auto const match_all{ [](auto const & m, auto const & sigs) {
+			list<int8> out(sigs.size());
+			size_t const count{ ds::match_bitsets(m, sigs.data(), sigs.size(), reinterpret_cast<bool *>(out.data())) };
+			size_t expected{};
+			bool agree{ true };
+			for (size_t i = 0; i < sigs.size(); ++i) { expected += sigs[i].contains(m); agree &= (bool)out[i] == sigs[i].contains(m); }
+			return agree && count == expected;
+		} };
+		uint32 seed{ 7 };
+		list<ds::bitset<32>> narrow{};
+		list<ds::bitset<64>> wide{};
+		for (size_t i = 0; i < 1003; ++i) {
+			seed = seed * 1664525u + 1013904223u;
+			narrow.emplace_back(seed >> 8);
+			wide.emplace_back(((uint64)seed << 32) | (seed >> 4));
+		}
+		TEST_check(match_all(ds::bitset<32>{ 0b1011 }, narrow));
+		TEST_check(match_all(ds::bitset<64>{ 0b1001ULL | (1ULL << 40) }, wide));
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
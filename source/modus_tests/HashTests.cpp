@@ -0,0 +1,53 @@
+#include "./Tests.hpp"
+
+#include <modus_core/detail/Hash.hpp>
+
+namespace ml::tests
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void test_fast_hash()
+	{
+		fast_hash const h{};
+		string data(512, '\0');
+		for (size_t i = 0; i < data.size(); ++i) { data[i] = (char)('a' + (i * 7) % 26); }
+
+		// every overload sees the same bytes
+		std::string_view const text{ "props/environment/rock_large_0" };
+		TEST_check(h(text) == h(text.data(), text.size()));
+		TEST_check(h(text.data(), text.size()) == h(string{ text }.c_str()));
+		TEST_check(h(text) != h(text.data(), text.size(), 1));
+
+		// each length goes down a different path, none of them should collide
+		list<hash_t> lengths{};
+		for (size_t n = 0; n <= 256; ++n) { lengths.push_back(h(data.data(), n)); }
+		std::sort(lengths.begin(), lengths.end());
+		TEST_check(std::adjacent_find(lengths.begin(), lengths.end()) == lengths.end());
+
+		// reads don't depend on alignment
+		bool aligned_ok{ true };
+		for (size_t offset = 1; offset < 16; ++offset)
+		{
+			string moved(offset, '\0');
+			moved.append(data, 0, 100);
+			for (size_t n : { 3, 8, 16, 40, 100 }) { aligned_ok &= h(moved.data() + offset, n) == h(data.data(), n); }
+		}
+		TEST_check(aligned_ok);
+
+		// any single flipped bit changes the hash, on both sides of the 16 and 48 byte paths
+		for (size_t const n : { 4, 12, 16, 17, 48, 49, 200 })
+		{
+			hash_t const base{ h(data.data(), n) };
+			bool flips_ok{ true };
+			for (size_t bit = 0; bit < n * 8; ++bit)
+			{
+				string flipped{ data };
+				flipped[bit / 8] ^= (char)(1 << (bit % 8));
+				flips_ok &= h(flipped.data(), n) != base;
+			}
+			TEST_check(flips_ok);
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
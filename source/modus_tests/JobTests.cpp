@@ -0,0 +1,92 @@
+#include "./Tests.hpp"
+
+#include <modus_core/system/JobSystem.hpp>
+
+namespace ml::tests
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	static int64 fib_serial(int32 n) noexcept
+	{
+		return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+	}
+
+	// jobs spawning jobs and waiting on them from inside a job
+	static void fib_jobs(job_system & js, int32 n, int64 * out)
+	{
+		if (n < 12) { *out = fib_serial(n); return; }
+		int64 a{}, b{};
+		job_counter c{};
+		js.run([&js, n, &a]() { fib_jobs(js, n - 1, &a); }, &c);
+		fib_jobs(js, n - 2, &b);
+		js.wait(c);
+		*out = a + b;
+	}
+
+	void test_job_system()
+	{
+		size_t const max_threads{ ML_max(std::thread::hardware_concurrency(), 1u) };
+		for (size_t const n : { (size_t)1, (size_t)2, max_threads })
+		{
+			// the pools are shared by every thread
+			job_system js{ n, pmr::new_delete_resource() };
+			TEST_check(js.get_thread_count() == n);
+
+			// every index is visited exactly once
+			list<int32> visits(100'003, 0, pmr::new_delete_resource());
+			js.parallel_for(0, visits.size(), 1'000, [&visits](size_t first, size_t last) {
+				for (size_t i = first; i < last; ++i) { ++visits[i]; }
+			});
+			TEST_check(std::all_of(visits.begin(), visits.end(), [](int32 e) { return e == 1; }));
+
+			// nested spawns and waits
+			int64 f{};
+			fib_jobs(js, 24, &f);
+			TEST_check(f == fib_serial(24));
+
+			// more jobs than a lane holds, the overflow runs inline
+			std::atomic<int32> ran{};
+			job_counter many{};
+			for (size_t i = 0; i < job_system::lane_capacity * 4; ++i)
+			{
+				js.run([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); }, &many);
+			}
+			js.wait(many);
+			TEST_check(many.done());
+			TEST_check(ran.load() == (int32)job_system::lane_capacity * 4);
+
+			// a layer only starts once the one before it has finished
+			size_t constexpr layer_count{ 6 }, layer_size{ 50 };
+			std::atomic<int32> finished[layer_count]{};
+			std::atomic<bool> ordered{ true };
+			job_counter layers[layer_count]{};
+			for (size_t i = 0; i < layer_count; ++i)
+			{
+				for (size_t j = 0; j < layer_size; ++j)
+				{
+					auto const task{ [&finished, &ordered, i]() {
+						if (i && finished[i - 1].load() != (int32)layer_size) { ordered = false; }
+						finished[i].fetch_add(1);
+					} };
+					if (!i) { js.run(task, &layers[i]); }
+					else { js.run_after(layers[i - 1], task, &layers[i]); }
+				}
+			}
+			js.wait(layers[layer_count - 1]);
+			TEST_check(ordered.load());
+			TEST_check(finished[layer_count - 1].load() == (int32)layer_size);
+
+			// fire and forget, then drain
+			std::atomic<int32> loose{};
+			for (size_t i = 0; i < 100; ++i) { js.run([&loose]() { loose.fetch_add(1); }); }
+			js.wait_idle();
+			TEST_check(loose.load() == 100 && !js.has_pending());
+
+			job_system::stats const s{ js.get_stats() };
+			TEST_check(0 < s.executed);
+			TEST_check(1 < n || s.stolen == 0);
+		}
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
@@ -0,0 +1,50 @@
+#include "./Tests.hpp"
+
+#include <modus_core/system/Memory.hpp>
+#include <modus_core/system/StringTable.hpp>
+
+using namespace ml;
+using namespace ml::byte_literals;
+
+// MEMORY
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static array<byte, 64_MiB>					g_data{};
+static pmr::monotonic_buffer_resource		g_mono{ g_data.data(), g_data.size() };
+static pmr::unsynchronized_pool_resource	g_pool{ &g_mono };
+static passthrough_resource					g_view{ &g_pool, g_data.data(), g_data.size() };
+static memory_manager						g_mman{ &g_view };
+
+// MAIN
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 main(int32 argc, char * argv[])
+{
+	pmr::set_default_resource(g_mman.get_resource());
+	{
+		// interned names are used by the scene
+		string_table strings{};
+
+		struct { cstring name; void (*fn)(); } const suites[]
+		{
+			{ "dense_hash_map", &tests::test_dense_hash_map },
+			{ "small_vector", &tests::test_small_vector },
+			{ "soa_vector", &tests::test_soa_vector },
+			{ "bitset", &tests::test_bitset },
+			{ "fast_hash", &tests::test_fast_hash },
+			{ "matrix inverse", &tests::test_matrix_inverse },
+			{ "job_system", &tests::test_job_system },
+			{ "scene loader", &tests::test_scene_loader },
+		};
+		for (auto const & e : suites)
+		{
+			int32 const before{ tests::g_failures };
+			e.fn();
+			std::cout << e.name << ": " << (before == tests::g_failures ? "passed" : "failed") << "\n";
+		}
+	}
+	pmr::set_default_resource(nullptr);
+
+	std::cout << (tests::g_failures ? "tests: failed\n" : "tests: passed\n");
+	return tests::g_failures ? 1 : 0;
+}
@@ -0,0 +1,73 @@
+#include "./Tests.hpp"
+
+#include <modus_core/detail/MatrixMath.hpp>
+
+namespace ml::tests
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	static bool nearly_equal(mat4 const & lhs, mat4 const & rhs, float32 eps) noexcept
+	{
+		for (size_t i = 0; i < 16; ++i)
+		{
+			float32 const a{ lhs.data()[i] }, b{ rhs.data()[i] };
+			if (std::abs(a - b) > eps * ML_max(1.f, ML_max(std::abs(a), std::abs(b)))) { return false; }
+		}
+		return true;
+	}
+
+	void test_matrix_inverse()
+	{
+		mat4_kernels const & scalar{ util::get_mat4_kernels(simd_level_scalar) };
+
+		uint32 seed{ 3 };
+		auto const next{ [&seed]() noexcept { return (float32)((seed = seed * 1664525u + 1013904223u) >> 8) / (float32)(1u << 24); } };
+
+		list<mat4> inputs{};
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			// transforms like the scene makes
+			inputs.push_back(util::compose(
+				vec3{ next() * 200.f - 100.f, next() * 200.f - 100.f, next() * 200.f - 100.f },
+				util::quaternion(vec3{ next() * 6.f, next() * 6.f, next() * 6.f }),
+				vec3{ .5f + next() * 2.f, .5f + next() * 2.f, .5f + next() * 2.f }));
+
+			// and general ones, kept away from singular by a heavy diagonal
+			mat4 m{};
+			for (size_t j = 0; j < 16; ++j) { m.data()[j] = next() * 2.f - 1.f + ((j % 5 == 0) ? 4.f : 0.f); }
+			inputs.push_back(m);
+		}
+
+		for (int32 level = simd_level_scalar + 1; level <= util::get_simd_level(); ++level)
+		{
+			mat4_kernels const & k{ util::get_mat4_kernels(level) };
+			bool same{ true }, inverts{ true };
+			for (mat4 const & m : inputs)
+			{
+				mat4 expected{}, actual{}, product{};
+				same &= scalar.inverse(m, expected) && k.inverse(m, actual) && nearly_equal(expected, actual, 1e-4f);
+				scalar.multiply(m, actual, product);
+				inverts &= nearly_equal(product, mat4::identity(), 1e-4f);
+			}
+			TEST_check(same);
+			TEST_check(inverts);
+
+			// small integers keep the determinant exact, two equal columns make it zero
+			mat4 const singular{
+				1.f, 2.f, 3.f, 4.f,
+				0.f, 1.f, 5.f, 2.f,
+				1.f, 2.f, 3.f, 4.f,
+				7.f, 1.f, 0.f, 3.f
+			};
+			mat4 out{};
+			TEST_check(!scalar.inverse(singular, out));
+			TEST_check(!k.inverse(singular, out));
+			TEST_check(!k.inverse(mat4{}, out));
+		}
+
+		// the generic entry point agrees with the kernels
+		TEST_check(nearly_equal(util::multiply(util::inverse(inputs[0]), inputs[0]), mat4::identity(), 1e-4f));
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
@@ -0,0 +1,160 @@
+#include "./Tests.hpp"
+
+#include <modus_core/scene/SceneSerializer.hpp>
+
+namespace ml::tests
+{
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	// what a node and its entity carry, in pre-order
+	struct scene_row final
+	{
+		std::string	name		;
+		int32		parent		;
+		bool		has_entity	;
+		std::string	tag			;
+		bool		has_xform	;
+		vec3		position	;
+		bool		has_bounds	;
+		aabb		bounds		;
+
+		ML_NODISCARD bool operator==(scene_row const & o) const noexcept
+		{
+			return name == o.name && parent == o.parent && has_entity == o.has_entity && tag == o.tag
+				&& has_xform == o.has_xform && (!has_xform || position == o.position)
+				&& has_bounds == o.has_bounds && (!has_bounds || (bounds.min == o.bounds.min && bounds.max == o.bounds.max));
+		}
+	};
+
+	static void describe(scene_tree const & tree, ref<node> const & n, int32 parent, std::vector<scene_row> & out)
+	{
+		entt::registry const & reg{ tree.get_reg() };
+		scene_row row{ std::string{ n->get_name().view() }, parent };
+		if (n->has<entity>())
+		{
+			entt::entity const e{ n->get<entity>().get_handle() };
+			row.has_entity = reg.valid(e);
+			if (row.has_entity && reg.has<tag_component>(e)) { row.tag = std::string{ reg.get<tag_component>(e).tag.view() }; }
+			if ((row.has_xform = row.has_entity && reg.has<transform_component>(e))) { row.position = reg.get<transform_component>(e).position; }
+			if ((row.has_bounds = row.has_entity && reg.has<bounds_component>(e))) { row.bounds = reg.get<bounds_component>(e).bounds; }
+		}
+		int32 const self{ (int32)out.size() };
+		out.push_back(row);
+		for (ref<node> const & child : n->get_children()) { if (child) { describe(tree, child, self, out); } }
+	}
+
+	ML_NODISCARD static std::vector<scene_row> describe(scene_tree const & tree)
+	{
+		std::vector<scene_row> out{};
+		if (tree.get_root()) { describe(tree, tree.get_root(), -1, out); }
+		return out;
+	}
+
+	ML_NODISCARD static std::string read_bytes(fs::path const & path)
+	{
+		std::ifstream file{ path, std::ios_base::binary };
+		return { std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+	}
+
+	static void write_bytes(fs::path const & path, std::string_view bytes)
+	{
+		std::ofstream{ path, std::ios_base::binary }.write(bytes.data(), (std::streamsize)bytes.size());
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+	void test_scene_loader()
+	{
+		// groups of leaves, a few without bounds and one node without an entity
+		scene_tree src{ "loader test" };
+		for (int32 i = 0; i < 10; ++i)
+		{
+			ref<node> const group{ src.get_root()->new_child(interned_string{ "group_" + std::to_string(i) }) };
+			auto & g{ group->emplace<entity>(&src) };
+			g.add<tag_component>(group->get_name());
+			g.add<transform_component>(transform_component{ { (float32)i, 0.f, 0.f }, {}, vec3::one() });
+			for (int32 j = 0; j < 5; ++j)
+			{
+				ref<node> const leaf{ group->new_child(interned_string{ "leaf_" + std::to_string(i * 5 + j) }) };
+				auto & l{ leaf->emplace<entity>(&src) };
+				l.add<tag_component>(leaf->get_name());
+				l.add<transform_component>(transform_component{ { (float32)i, (float32)j, -1.f }, {}, vec3::one() });
+				if (j % 2) { l.add<bounds_component>(bounds_component{ aabb::from_sphere({}, .5f + (float32)j) }); }
+			}
+		}
+		src.get_root()->new_child("empty");
+		std::vector<scene_row> const expected{ describe(src) };
+
+		fs::path const dir{ fs::temp_directory_path() };
+		fs::path const path{ dir / "modus_tests.scene" };
+		TEST_check(save_scene(path, src));
+
+		// all at once
+		scene_tree whole{ "" };
+		TEST_check(load_scene(path, whole));
+		TEST_check(whole.get_name() == src.get_name());
+		TEST_check(describe(whole) == expected);
+
+		// a few bytes per step, like a frame budget
+		scene_tree streamed{ "" };
+		scene_loader loader{ path };
+		TEST_check(loader.is_open());
+		size_t steps{};
+		float32 progress{}, last{};
+		bool monotonic{ true };
+		while (loader.is_open() && !loader.has_error() && !loader.step(streamed, 64) && steps < 100'000)
+		{
+			++steps;
+			progress = loader.get_progress();
+			monotonic &= last <= progress;
+			last = progress;
+		}
+		TEST_check(loader.is_done() && !loader.has_error());
+		TEST_check(10 < steps && monotonic && loader.get_progress() == 1.f);
+		TEST_check(describe(streamed) == expected);
+		loader.close();
+
+		std::string const bytes{ read_bytes(path) };
+		fs::path const broken{ dir / "modus_tests_broken.scene" };
+
+		// cut short in the middle of a chunk
+		write_bytes(broken, std::string_view{ bytes }.substr(0, bytes.size() / 2));
+		scene_tree truncated{ "" };
+		TEST_check(!load_scene(broken, truncated));
+
+		// not a scene
+		std::string bad_magic{ bytes };
+		bad_magic[0] ^= 0xFF;
+		write_bytes(broken, bad_magic);
+		TEST_check(!scene_loader{ broken }.is_open());
+
+		// written on a host of the other byte order
+		std::string swapped{ bytes };
+		std::reverse(swapped.begin() + 8, swapped.begin() + 12);
+		write_bytes(broken, swapped);
+		TEST_check(!scene_loader{ broken }.is_open());
+
+		// newer than this build
+		std::string newer{ bytes };
+		uint32 const next_version{ scene_format_version + 1 };
+		std::memcpy(newer.data() + 4, &next_version, sizeof(next_version));
+		write_bytes(broken, newer);
+		TEST_check(!scene_loader{ broken }.is_open());
+
+		// version 1 had no byte order mark and still loads
+		std::string v1{ bytes };
+		uint32 const first_version{ 1 };
+		std::memcpy(v1.data() + 4, &first_version, sizeof(first_version));
+		v1.erase(8, 4);
+		write_bytes(broken, v1);
+		scene_tree old{ "" };
+		TEST_check(load_scene(broken, old));
+		TEST_check(describe(old) == expected);
+
+		std::error_code ec{};
+		fs::remove(path, ec);
+		fs::remove(broken, ec);
+	}
+
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+}
@@ -0,0 +1,40 @@
+#ifndef _ML_TESTS_HPP_
+#define _ML_TESTS_HPP_
+
+#include <modus_core/detail/Utility.hpp>
+
+// CHECKS
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+namespace ml::tests
+{
+	// failed checks across every suite
+	inline int32 g_failures{};
+}
+
+#define TEST_check(expr) \
+	do { if (!(expr)) { ++_ML tests::g_failures; std::cerr << "failed: " << #expr << " (" << __FILE__ << ":" << __LINE__ << ")\n"; } } while (0)
+
+// SUITES
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+namespace ml::tests
+{
+	void test_dense_hash_map();
+
+	void test_small_vector();
+
+	void test_soa_vector();
+
+	void test_bitset();
+
+	void test_fast_hash();
+
+	void test_matrix_inverse();
+
+	void test_job_system();
+
+	void test_scene_loader();
+}
+
+#endif // !_ML_TESTS_HPP_